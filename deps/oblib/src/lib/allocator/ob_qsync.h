@@ -61,8 +61,9 @@ public:
     for(int64_t i = 0; i < MAX_REF_CNT; i++) {
       Ref* ref = ref_array_ + i;
       if (NULL != ref) {
-        while(ATOMIC_LOAD(&ref->ref_) != 0)
-          ;
+        while(ATOMIC_LOAD(&ref->ref_) != 0) {
+          PAUSE();
+        }
       }
     }
   }
@@ -189,8 +190,9 @@ public:
     for(int64_t i = 0; i < ref_num_; i++) {
       Ref* ref = ref_array_ + i;
       if (NULL != ref) {
-        while(ATOMIC_LOAD(&ref->ref_) != 0)
-          ;
+        while(ATOMIC_LOAD(&ref->ref_) != 0) {
+          PAUSE();
+        }
       }
     }
   }
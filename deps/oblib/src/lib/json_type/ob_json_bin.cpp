@@ -2258,6 +2258,55 @@ int ObJsonBin::lookup(const ObString &key)
   return ret;
 }
 
+int ObJsonBin::seek_simple_path(const ObJsonPath &path, uint32_t node_cnt, bool is_auto_wrap, bool &is_found)
+{
+  INIT_SUCC(ret);
+  is_found = true;
+  JsonPathIterator cur_node = path.begin();
+  JsonPathIterator last_node = path.begin() + node_cnt;
+  for (; OB_SUCC(ret) && is_found && cur_node < last_node; ++cur_node) {
+    const ObJsonPathBasicNode *path_node = static_cast<const ObJsonPathBasicNode *>(*cur_node);
+    ObJsonNodeType node_type = json_type();
+    switch (path_node->get_node_type()) {
+      case JPN_MEMBER: {
+        if (node_type != ObJsonNodeType::J_OBJECT) {
+          is_found = false;
+        } else {
+          ObString key_name(path_node->get_object().len_, path_node->get_object().object_name_);
+          ret = lookup(key_name);
+          if (ret == OB_SEARCH_NOT_FOUND) {
+            ret = OB_SUCCESS;
+            is_found = false;
+          } else if (OB_FAIL(ret)) {
+            LOG_WARN("fail to lookup member.", K(ret), K(key_name));
+          }
+        }
+        break;
+      }
+      case JPN_ARRAY_CELL: {
+        if (node_type == ObJsonNodeType::J_ARRAY) {
+          ObJsonArrayIndex array_index;
+          if (OB_FAIL(path_node->get_first_array_index(element_count_, array_index))) {
+            LOG_WARN("fail to get array index.", K(ret), K(element_count_));
+          } else if (!array_index.is_within_bounds()) {
+            is_found = false;
+          } else if (OB_FAIL(element(array_index.get_array_index()))) {
+            LOG_WARN("fail to move iter to array cell.", K(ret), K(array_index.get_array_index()));
+          }
+        } else if (!is_auto_wrap || !path_node->is_autowrap()) {
+          is_found = false;
+        } // autowrap: scalar or object is treated as [0], stay on current node
+        break;
+      }
+      default: {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("not simple path node.", K(ret), K(path_node->get_node_type()));
+      }
+    }
+  }
+  return ret;
+}
+
 void ObJsonBin::parse_obj_header(const char *data, uint64_t &offset,
      uint8_t &node_type, uint8_t &type, uint8_t& obj_size_type, uint64_t &count, uint64_t &obj_size) const
 {
@@ -302,6 +302,17 @@ public:
   */
   int lookup(const ObString &key);
 
+  /*
+  Move iter to the node matched by simple path(see ObJsonPath::is_simple_path) in place,
+  each step does binary search on object keys or jumps to array cell without creating sub binary.
+  @param[in] path          The simple path.
+  @param[in] node_cnt      Number of path nodes to seek.
+  @param[in] is_auto_wrap  Whether scalar is treated as single element array, same as seek.
+  @param[out] is_found     Whether path is matched, iter is undefined if not found.
+  @return Returns OB_SUCCESS on success, error code otherwise.
+  */
+  int seek_simple_path(const ObJsonPath &path, uint32_t node_cnt, bool is_auto_wrap, bool &is_found);
+
   /*
   Update child node by key, first try inplace update.
   @param[in] key       The key.
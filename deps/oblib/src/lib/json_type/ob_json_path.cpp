@@ -928,6 +928,23 @@ bool ObJsonPath::can_match_many() const
   return ret_bool;
 }
 
+bool ObJsonPath::is_simple_path() const
+{
+  bool ret_bool = is_mysql_;
+  for (uint32_t i = 0; i < path_nodes_.size() && ret_bool; ++i) {
+    switch(path_nodes_[i]->get_node_type()) {
+      case JPN_MEMBER:
+      case JPN_ARRAY_CELL: {
+        break;
+      }
+      default: {
+        ret_bool = false;
+      }
+    }
+  }
+  return ret_bool;
+}
+
 inline bool ObJsonPath::is_contained_wildcard_or_ellipsis() const
 {
   return is_contained_wildcard_or_ellipsis_;
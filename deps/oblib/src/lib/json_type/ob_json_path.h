@@ -300,6 +300,8 @@ public:
   int to_string(ObJsonBuffer& str);          // transfer all pathnodes to string
   int parse_path();                         // do parse 
   bool can_match_many() const;
+  // mysql path only made up of member and array cell, matches at most one node
+  bool is_simple_path() const;
   bool is_contained_wildcard_or_ellipsis() const;
   ObString& get_path_string();
   ObJsonPathBasicNode* path_node(int index);
@@ -41,6 +41,7 @@ ObBaseLogWriter::ObBaseLogWriter()
     max_buffer_item_cnt_(0),
     log_item_push_idx_(0),
     log_item_pop_idx_(0),
+    is_flush_waiting_(false),
     log_write_cond_(nullptr),
     log_flush_cond_(nullptr)
 {
@@ -76,6 +77,7 @@ int ObBaseLogWriter::init(
   } else {
     log_item_push_idx_ = 0;
     log_item_pop_idx_ = 0;
+    is_flush_waiting_ = false;
     log_cfg_ = log_cfg;
     max_buffer_item_cnt_ = log_cfg.max_buffer_item_cnt_;
     memset((void*) log_items_, 0, sizeof(ObIBaseLogItem*) * max_buffer_item_cnt_);
@@ -207,26 +209,34 @@ int ObBaseLogWriter::append_log(ObIBaseLogItem &log_item, const uint64_t timeout
     ret = OB_NOT_INIT;
     LOG_STDERR("The ObBaseLogWriter has not been inited.\n");
   } else {
-    int64_t abs_time = ObTimeUtility::current_time() + timeout_us;
+    int64_t abs_time = 0;
     while (OB_SUCC(ret)) {
-      auto key = log_write_cond_->get_key();
       int64_t push_idx = ATOMIC_LOAD(&log_item_push_idx_);
       int64_t pop_idx = ATOMIC_LOAD(&log_item_pop_idx_);
       if (push_idx - pop_idx < max_buffer_item_cnt_) {
         if (OB_LIKELY(ATOMIC_BCAS(&log_item_push_idx_, push_idx, push_idx + 1))) {
           ATOMIC_STORE(log_items_ + push_idx % max_buffer_item_cnt_, &log_item);
-          if (need_flush()) {
+          // only wake up the flush thread when it is sleeping, avoid every appender writing the
+          // shared futex of log_flush_cond_
+          if (ATOMIC_LOAD(&is_flush_waiting_)
+              && need_flush()
+              && ATOMIC_BCAS(&is_flush_waiting_, true, false)) {
             log_flush_cond_->signal(UINT32_MAX);
           }
           break;
         }
       } else {
+        // the queue is full, the clock and log_write_cond_ are only touched on this slow path
+        auto key = log_write_cond_->get_key();
         int64_t current_time = ObTimeUtility::current_time();
+        if (0 == abs_time) {
+          abs_time = current_time + timeout_us;
+        }
         if (OB_UNLIKELY(!ATOMIC_LOAD(&is_inited_))) {
           ret = OB_CANCELED;
         } else if (current_time >= abs_time && timeout_us != UINT64_MAX) {
           ret = OB_TIMEOUT;
-        } else {
+        } else if (ATOMIC_LOAD(&log_item_push_idx_) - ATOMIC_LOAD(&log_item_pop_idx_) >= max_buffer_item_cnt_) {
           log_write_cond_->wait(key, abs_time - current_time);
         }
       }
@@ -278,9 +288,14 @@ void ObBaseLogWriter::do_flush_log()
   int64_t process_item_cnt = 0;
   int64_t item_cnt = 0;
   auto key = log_flush_cond_->get_key();
+  // publish is_flush_waiting_ before checking the queue, appenders check it after pushing,
+  // so either the new item is seen here or the appender signals log_flush_cond_
+  ATOMIC_STORE(&is_flush_waiting_, true);
+  MEM_BARRIER();
   if (!need_flush()) {
     log_flush_cond_->wait(key, log_cfg_.group_commit_max_wait_us_);
   }
+  ATOMIC_STORE(&is_flush_waiting_, false);
   while (OB_LIKELY(need_flush() && !has_stopped_)) {
     // flush log will not block append any more, so there is no need to limit process_item_cnt
     //if (process_item_cnt > log_cfg_.group_commit_max_item_cnt_) {
@@ -111,6 +111,8 @@ protected:
   uint64_t max_buffer_item_cnt_ CACHE_ALIGNED;
   int64_t log_item_push_idx_ CACHE_ALIGNED;
   int64_t log_item_pop_idx_ CACHE_ALIGNED;
+  // set by the flush thread before sleeping on log_flush_cond_
+  bool is_flush_waiting_ CACHE_ALIGNED;
 
   pthread_mutex_t thread_mutex_;
 
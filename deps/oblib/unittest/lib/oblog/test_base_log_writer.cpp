@@ -14,6 +14,8 @@
 #include <thread>
 #include "lib/oblog/ob_base_log_writer.h"
 #include "lib/ob_errno.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/time/ob_time_utility.h"
 
 //using namespace ::oblib;
 
@@ -115,6 +117,44 @@ TEST(ObBaseLogWriter, normal)
   writer.destroy();
 }
 
+TEST(ObBaseLogWriter, multi_append)
+{
+  ObTLogWriter writer;
+  ObBaseLogWriterCfg cfg(512 << 10, 500000, 1, 4);
+  ASSERT_EQ(OB_SUCCESS, writer.init(cfg));
+  ASSERT_EQ(OB_SUCCESS, writer.start());
+
+  constexpr int64_t thread_cnt = 8;
+  constexpr int64_t log_cnt = 100000;
+  ObTLogItem log_items[thread_cnt];
+  int64_t fail_cnt = 0;
+  std::thread threads[thread_cnt];
+  const int64_t begin_ts = ObTimeUtility::current_time();
+  for (int64_t j = 0; j < thread_cnt; ++j) {
+    threads[j] = std::thread([&, j]() {
+      for (int64_t i = 0; i < log_cnt; ++i) {
+        if (OB_SUCCESS != writer.append_log(log_items[j], 10000000)) {
+          ATOMIC_INC(&fail_cnt);
+        }
+      }
+    });
+  }
+  for (int64_t j = 0; j < thread_cnt; ++j) {
+    threads[j].join();
+  }
+  const int64_t cost_ts = ObTimeUtility::current_time() - begin_ts;
+  fprintf(stdout, "append %ld logs by %ld threads, cost %ld us, %.1f ns per append\n",
+          thread_cnt * log_cnt, thread_cnt, cost_ts, cost_ts * 1000.0 / (thread_cnt * log_cnt));
+
+  // all appended items are flushed before stop
+  writer.stop();
+  writer.wait();
+  ASSERT_EQ(0, fail_cnt);
+  ASSERT_EQ(0, writer.get_queued_item_cnt());
+  ASSERT_EQ(thread_cnt * log_cnt, writer.process_cnt_);
+  writer.destroy();
+}
+
 
 }
 }
@@ -135,6 +135,11 @@ public:
     uint64_t len,
     bool set_uft8,
     ObString& data);
+  void check_partial_update(
+    ObIAllocator &allocator,
+    ObCollationType coll_type,
+    const std::string &old_str,
+    const std::string &new_str);
 protected:
   uint64_t tenant_id_;
   share::ObLSID ls_id_;
@@ -1849,6 +1854,224 @@ TEST_F(TestLobManager, inrow_utf8_reverse_query)
 
 }
 
+TEST_F(TestLobManager, partial_update_check)
+{
+  ObLobCommon out_row_lob;
+  out_row_lob.in_row_ = 0;
+  out_row_lob.is_init_ = 1;
+  const int64_t large_len = 1024 * 1024;
+  ASSERT_TRUE(ObLobManager::can_do_partial_update(out_row_lob, large_len, ObLongTextType, CS_TYPE_BINARY, large_len));
+  // json is utf8mb4_bin
+  ASSERT_TRUE(ObLobManager::can_do_partial_update(out_row_lob, large_len, ObJsonType, CS_TYPE_UTF8MB4_BIN, large_len));
+  // new data can be stored in row
+  ASSERT_FALSE(ObLobManager::can_do_partial_update(out_row_lob, large_len, ObLongTextType, CS_TYPE_BINARY, 100));
+  ASSERT_FALSE(ObLobManager::can_do_partial_update(out_row_lob, large_len, ObJsonType, CS_TYPE_UTF8MB4_BIN, 100));
+  // text is not supported
+  ASSERT_FALSE(ObLobManager::can_do_partial_update(out_row_lob, large_len, ObLongTextType, CS_TYPE_UTF8MB4_GENERAL_CI, large_len));
+  // old data is read fully for diff, too large lob does full update
+  const int64_t max_len = ObLobManager::LOB_PARTIAL_UPDATE_MAX_LENGTH;
+  ASSERT_TRUE(ObLobManager::can_do_partial_update(out_row_lob, max_len, ObLongTextType, CS_TYPE_BINARY, max_len));
+  ASSERT_FALSE(ObLobManager::can_do_partial_update(out_row_lob, max_len + 1, ObLongTextType, CS_TYPE_BINARY, large_len));
+  ASSERT_FALSE(ObLobManager::can_do_partial_update(out_row_lob, large_len, ObLongTextType, CS_TYPE_BINARY, max_len + 1));
+  ASSERT_FALSE(ObLobManager::can_do_partial_update(out_row_lob, max_len + 1, ObJsonType, CS_TYPE_UTF8MB4_BIN, large_len));
+
+  ObLobCommon in_row_lob;
+  ASSERT_FALSE(ObLobManager::can_do_partial_update(in_row_lob, 100, ObLongTextType, CS_TYPE_BINARY, large_len));
+  ASSERT_FALSE(ObLobManager::can_do_partial_update(in_row_lob, 100, ObJsonType, CS_TYPE_UTF8MB4_BIN, large_len));
+}
+
+// apply the diff range to old data as process_diff does, result must be new data
+static void check_diff_range(const char *old_str, const char *new_str,
+                             const uint64_t expect_offset,
+                             const uint64_t expect_old_range_len,
+                             const uint64_t expect_new_range_len,
+                             const ObCollationType coll_type = CS_TYPE_BINARY)
+{
+  ObString old_data(strlen(old_str), old_str);
+  ObString new_data(strlen(new_str), new_str);
+  uint64_t offset = 0;
+  uint64_t old_range_len = 0;
+  uint64_t new_range_len = 0;
+  ObLobManager::calc_diff_range(old_data, new_data, coll_type, offset, old_range_len, new_range_len);
+  ASSERT_EQ(expect_offset, offset) << old_str << " " << new_str;
+  ASSERT_EQ(expect_old_range_len, old_range_len) << old_str << " " << new_str;
+  ASSERT_EQ(expect_new_range_len, new_range_len) << old_str << " " << new_str;
+  std::string result(old_str, offset);
+  result.append(new_str + offset, new_range_len);
+  result.append(old_str + offset + old_range_len);
+  ASSERT_EQ(std::string(new_str), result);
+}
+
+TEST_F(TestLobManager, partial_update_diff_range)
+{
+  // same length
+  check_diff_range("abcdefgh", "abcdefgh", 8, 0, 0);
+  check_diff_range("abcdefgh", "abcXYfgh", 3, 2, 2);
+  check_diff_range("abcdefgh", "Xbcdefgh", 0, 1, 1);
+  check_diff_range("abcdefgh", "abcdefgX", 7, 1, 1);
+  // grow, suffix is kept
+  check_diff_range("abcdefgh", "abcdXYZefgh", 3, 1, 4);
+  check_diff_range("abcdefgh", "abcXYZZfgh", 3, 2, 4);
+  check_diff_range("abcdefgh", "XYabcdefgh", 0, 1, 3);
+  check_diff_range("abcdefgh", "abcdefghXY", 7, 1, 3);
+  check_diff_range("aaaa", "aaaaaa", 3, 1, 3);
+  // shrink, suffix is kept
+  check_diff_range("abcdefgh", "abcfgh", 3, 2, 0);
+  check_diff_range("abcdefgh", "abXfgh", 2, 3, 1);
+  check_diff_range("abcdefgh", "cdefgh", 0, 2, 0);
+  check_diff_range("abcdefgh", "abcdef", 6, 2, 0);
+  check_diff_range("aaaaaa", "aaaa", 4, 2, 0);
+  check_diff_range("abcdefgh", "XY", 0, 8, 2);
+  // utf8, range is aligned to chars
+  const ObCollationType utf8_bin = CS_TYPE_UTF8MB4_BIN;
+  check_diff_range("ab\xC3\xA9" "cd", "ab\xC3\xA9" "cd", 6, 0, 0, utf8_bin);
+  check_diff_range("ab\xC3\xA9" "cd", "ab\xC3\xAA" "cd", 2, 2, 2, utf8_bin);
+  check_diff_range("a\xC3\xA9", "a\xC3\xA8\xC3\xA9", 1, 2, 4, utf8_bin);
+  check_diff_range("a\xE4\xB8\xAD" "b", "a\xE4\xB8\xAD\xE4\xB8\xAD" "b", 1, 3, 6, utf8_bin);
+  check_diff_range("\xE4\xB8\xAD" "ab", "\xE4\xB8\xAD\xE4\xB8\xAD" "ab", 0, 3, 6, utf8_bin);
+  check_diff_range("\xE4\xB8\xAD" "ab", "x\xE4\xB8\xAD" "ab", 0, 3, 4, utf8_bin);
+  check_diff_range("a\xE4\xB8\xAD\xE6\x96\x87" "b", "a\xE6\x96\x87" "b", 1, 3, 0, utf8_bin);
+}
+
+void TestLobManager::check_partial_update(
+    ObIAllocator &allocator,
+    ObCollationType coll_type,
+    const std::string &old_str,
+    const std::string &new_str)
+{
+  ObLobManager *mgr = MTL(ObLobManager*);
+  transaction::ObTransService *tx_service = MTL(transaction::ObTransService*);
+  share::schema::ObTableSchema table_schema;
+  TestLobCommon::build_lob_meta_table_schema(tenant_id_, table_schema);
+  share::schema::ObTableParam table_param(allocator);
+  ObSArray<uint64_t> colunm_ids;
+  for (int i = 0; i < ObLobMetaUtil::LOB_META_COLUMN_CNT; i++) {
+    colunm_ids.push_back(OB_APP_MIN_COLUMN_ID + i);
+  }
+  ASSERT_EQ(OB_SUCCESS, TestDmlCommon::build_table_param(table_schema, colunm_ids, table_param));
+
+  transaction::ObTxDesc *tx_desc = nullptr;
+  ASSERT_EQ(OB_SUCCESS, TestDmlCommon::build_tx_desc(tenant_id_, tx_desc));
+  ObTxParam tx_param;
+  TestDmlCommon::build_tx_param(tx_param);
+  int64_t savepoint = 0;
+  ObTxIsolationLevel isolation = ObTxIsolationLevel::RC;
+  int64_t expire_ts = ObTimeUtility::current_time() + TestDmlCommon::TX_EXPIRE_TIME_US;
+
+  ObLobAccessParam param;
+  param.tx_desc_ = tx_desc;
+  param.tx_id_ = tx_desc->get_tx_id();
+  param.sql_mode_ = SMO_DEFAULT;
+  param.allocator_ = &allocator;
+  param.meta_table_schema_ = &table_schema;
+  param.meta_tablet_param_ = &table_param;
+  param.ls_id_ = ls_id_;
+  param.tablet_id_ = tablet_id_;
+  param.coll_type_ = coll_type;
+  param.timeout_ = expire_ts;
+  param.scan_backward_ = false;
+
+  // 1. insert old lob, it is stored out row
+  ObString old_data(old_str.length(), old_str.data());
+  ASSERT_EQ(OB_SUCCESS, tx_service->create_implicit_savepoint(*tx_desc, tx_param, savepoint, true));
+  ASSERT_EQ(OB_SUCCESS, tx_service->get_read_snapshot(*tx_desc, isolation, expire_ts, param.snapshot_));
+  param.lob_common_ = nullptr;
+  param.offset_ = 0;
+  param.len_ = old_data.length();
+  ASSERT_EQ(OB_SUCCESS, mgr->append(param, old_data));
+  ASSERT_NE(nullptr, param.lob_common_);
+  ASSERT_FALSE(param.lob_common_->in_row_);
+
+  // 2. update with full new data as ObLSTabletService::process_diff_lob does
+  ObLobLocatorV2 new_lob;
+  ObString new_data(new_str.length(), new_str.data());
+  ASSERT_EQ(OB_SUCCESS, mgr->build_tmp_full_lob_locator(allocator, new_data, coll_type, new_lob));
+  ASSERT_EQ(OB_SUCCESS, tx_service->create_implicit_savepoint(*tx_desc, tx_param, savepoint, true));
+  ASSERT_EQ(OB_SUCCESS, tx_service->get_read_snapshot(*tx_desc, isolation, expire_ts, param.snapshot_));
+  param.lob_locator_ = nullptr;
+  param.byte_size_ = param.lob_common_->get_byte_size(param.handle_size_);
+  ASSERT_EQ(OB_SUCCESS, mgr->process_diff(param, new_lob));
+  ASSERT_EQ(new_str.length(), param.lob_common_->get_byte_size(param.handle_size_));
+  ASSERT_GE(param.handle_size_, ObLobManager::LOB_OUTROW_FULL_SIZE);
+  int64_t char_len = *reinterpret_cast<int64_t*>(reinterpret_cast<char*>(param.lob_common_)
+                                                 + ObLobManager::LOB_WITH_OUTROW_CTX_SIZE);
+  ASSERT_EQ(ObCharset::strlen_char(coll_type, new_str.data(), new_str.length()), char_len);
+
+  // 3. read back, the lob must be the same as new data
+  char *buf = reinterpret_cast<char*>(allocator.alloc(new_str.length()));
+  ASSERT_NE(nullptr, buf);
+  ObString read_data;
+  read_data.assign_buffer(buf, new_str.length());
+  ASSERT_EQ(OB_SUCCESS, tx_service->create_implicit_savepoint(*tx_desc, tx_param, savepoint, true));
+  ASSERT_EQ(OB_SUCCESS, tx_service->get_read_snapshot(*tx_desc, isolation, expire_ts, param.snapshot_));
+  param.byte_size_ = param.lob_common_->get_byte_size(param.handle_size_);
+  param.offset_ = 0;
+  param.len_ = new_str.length();
+  param.scan_backward_ = false;
+  ASSERT_EQ(OB_SUCCESS, mgr->query(param, read_data));
+  ASSERT_EQ(new_str.length(), read_data.length());
+  ASSERT_EQ(0, MEMCMP(new_str.data(), read_data.ptr(), new_str.length()));
+
+  expire_ts = ObTimeUtility::current_time() + TestDmlCommon::TX_EXPIRE_TIME_US;
+  ASSERT_EQ(OB_SUCCESS, tx_service->commit_tx(*tx_desc, expire_ts));
+  tx_service->release_tx(*tx_desc);
+}
+
+TEST_F(TestLobManager, partial_update_outrow)
+{
+  ObArenaAllocator allocator;
+  ASSERT_EQ(OB_SUCCESS, TestLobCommon::create_data_tablet(tenant_id_, ls_id_, tablet_id_,
+                                                          lob_meta_tablet_id_, lob_piece_tablet_id_));
+  ObLSTabletService *tablet_service = nullptr;
+  ASSERT_EQ(OB_SUCCESS, TestDmlCommon::mock_ls_tablet_service(ls_id_, tablet_service));
+  ASSERT_NE(nullptr, tablet_service);
+  MockObAccessService *access_service = nullptr;
+  ASSERT_EQ(OB_SUCCESS, TestDmlCommon::mock_access_service(tablet_service, access_service));
+  ASSERT_NE(nullptr, access_service);
+
+  // binary lob of several pieces
+  std::string old_str;
+  for (int64_t i = 0; i < 1024 * 1024; i++) {
+    old_str.push_back(static_cast<char>(ObRandom::rand('a', 'z')));
+  }
+  std::string new_str = old_str;
+  new_str.insert(300 * 1024, 1000, 'X');
+  check_partial_update(allocator, CS_TYPE_BINARY, old_str, new_str);
+  new_str = old_str;
+  new_str.erase(500 * 1024, 5000);
+  check_partial_update(allocator, CS_TYPE_BINARY, old_str, new_str);
+  new_str = old_str;
+  new_str.replace(700 * 1024, 3, "XYZ");
+  check_partial_update(allocator, CS_TYPE_BINARY, old_str, new_str);
+  // pure insertion
+  check_partial_update(allocator, CS_TYPE_BINARY, old_str, "XYZ" + old_str);
+  check_partial_update(allocator, CS_TYPE_BINARY, old_str, old_str + "XYZ");
+  new_str = old_str;
+  new_str.insert(600 * 1024, "XYZ");
+  check_partial_update(allocator, CS_TYPE_BINARY, old_str, new_str);
+
+  // json column is utf8mb4_bin, lob meta is located by char
+  const char *record = "{\"k\":\"\xE4\xB8\xAD\xE6\x96\x87\xC3\xA9\"},";
+  std::string json_str;
+  while (json_str.length() < 1024 * 1024) {
+    json_str.append(record);
+  }
+  const size_t pos = json_str.find("\xC3\xA9", json_str.length() / 2);
+  new_str = json_str;
+  new_str.replace(pos, 2, "\xC3\xAA");
+  check_partial_update(allocator, CS_TYPE_UTF8MB4_BIN, json_str, new_str);
+  new_str = json_str;
+  new_str.insert(pos, "\xE4\xB8\xAD");
+  check_partial_update(allocator, CS_TYPE_UTF8MB4_BIN, json_str, new_str);
+  new_str = json_str;
+  new_str.erase(pos + 4, strlen(record));
+  check_partial_update(allocator, CS_TYPE_UTF8MB4_BIN, json_str, new_str);
+
+  TestDmlCommon::delete_mocked_access_service(access_service);
+  TestDmlCommon::delete_mocked_ls_tablet_service(tablet_service);
+  ASSERT_EQ(OB_SUCCESS, MTL(ObLSService*)->remove_ls(ls_id_, false));
+}
+
 } // end unittest
 } // end oceanbase
 
@@ -104,7 +104,8 @@ public:
   void prepare_merge_context(const ObMergeType &merge_type,
                              const bool is_full_merge,
                              const ObVersionRange &trans_version_range,
-                             ObTabletMergeCtx &merge_context);
+                             ObTabletMergeCtx &merge_context,
+                             const ObMergeLevel merge_level = MACRO_BLOCK_MERGE_LEVEL);
   void build_sstable(
       ObTabletMergeCtx &ctx,
       ObSSTable *&merged_sstable);
@@ -221,7 +222,8 @@ void TestMultiVersionMerge::prepare_query_param(const ObVersionRange &version_ra
 void TestMultiVersionMerge::prepare_merge_context(const ObMergeType &merge_type,
                                                   const bool is_full_merge,
                                                   const ObVersionRange &trans_version_range,
-                                                  ObTabletMergeCtx &merge_context)
+                                                  ObTabletMergeCtx &merge_context,
+                                                  const ObMergeLevel merge_level)
 {
   bool has_lob = false;
   ObLSID ls_id(ls_id_);
@@ -242,7 +244,7 @@ void TestMultiVersionMerge::prepare_merge_context(const ObMergeType &merge_type,
   merge_context.schema_ctx_.storage_schema_ = &table_merge_schema_;
 
   merge_context.is_full_merge_ = is_full_merge;
-  merge_context.merge_level_ = MACRO_BLOCK_MERGE_LEVEL;
+  merge_context.merge_level_ = merge_level;
   merge_context.param_.merge_type_ = merge_type;
   merge_context.param_.merge_version_ = 0;
   merge_context.param_.ls_id_ = ls_id_;
@@ -3027,6 +3029,104 @@ TEST_F(TestMultiVersionMerge, test_major_range_cross_macro)
   merger.reset();
 }
 
+TEST_F(TestMultiVersionMerge, test_minor_merge_with_micro_reused)
+{
+  int ret = OB_SUCCESS;
+  ObPartitionMinorMerger merger;
+  ObTabletMergeDagParam param;
+  ObTabletMergeCtx merge_context(param, allocator_);
+
+  ObTableHandleV2 handle1;
+  const char *micro_data[4];
+  micro_data[0] =
+      "bigint   var   bigint   bigint   bigint bigint flag    multi_version_row_flag\n"
+      "0        var0  -20      0        20      20    EXIST   CLF\n";
+
+  // max version is not greater than base version, opened to be recycled
+  micro_data[1] =
+      "bigint   var   bigint   bigint   bigint bigint flag    multi_version_row_flag\n"
+      "1        var1  -6       0        6       6     EXIST   CLF\n";
+
+  micro_data[2] =
+      "bigint   var   bigint   bigint   bigint bigint flag    multi_version_row_flag\n"
+      "2        var2  -20      0        20      20    EXIST   CLF\n";
+
+  micro_data[3] =
+      "bigint   var   bigint   bigint   bigint bigint flag    multi_version_row_flag\n"
+      "3        var3  -20      0        20      20    EXIST   CLF\n";
+
+  int schema_rowkey_cnt = 2;
+  int64_t snapshot_version = 10;
+  ObScnRange scn_range;
+  scn_range.start_scn_.set_min();
+  scn_range.end_scn_.convert_for_tx(30);
+  prepare_table_schema(micro_data, schema_rowkey_cnt, scn_range, snapshot_version);
+  reset_writer(snapshot_version);
+  prepare_one_macro(micro_data, 4);
+  prepare_data_end(handle1);
+  merge_context.tables_handle_.add_table(handle1);
+  STORAGE_LOG(INFO, "finish prepare sstable1");
+
+  // only crosses the third micro block of sstable1
+  ObTableHandleV2 handle2;
+  const char *micro_data2[1];
+  micro_data2[0] =
+      "bigint   var   bigint   bigint   bigint bigint  flag    multi_version_row_flag\n"
+      "2        var2  -30      0        30      NOP    EXIST   LF\n";
+
+  snapshot_version = 20;
+  scn_range.start_scn_.convert_for_tx(30);
+  scn_range.end_scn_.convert_for_tx(50);
+  table_key_.scn_range_ = scn_range;
+  reset_writer(snapshot_version);
+  prepare_one_macro(micro_data2, 1);
+  prepare_data_end(handle2);
+  merge_context.tables_handle_.add_table(handle2);
+  STORAGE_LOG(INFO, "finish prepare sstable2");
+
+  ObVersionRange trans_version_range;
+  trans_version_range.snapshot_version_ = 100;
+  trans_version_range.multi_version_start_ = 10;
+  trans_version_range.base_version_ = 8;
+
+  prepare_merge_context(MINOR_MERGE, false, trans_version_range, merge_context, MICRO_BLOCK_MERGE_LEVEL);
+  // minor mrege
+  ObSSTable *merged_sstable = nullptr;
+  ASSERT_EQ(OB_SUCCESS, merger.merge_partition(merge_context, 0));
+  // the first and the last micro blocks of sstable1 are reused
+  ASSERT_EQ(0, merger.merge_info_.multiplexed_macro_block_count_);
+  ASSERT_EQ(2, merger.merge_info_.multiplexed_micro_count_in_new_macro_);
+  build_sstable(merge_context, merged_sstable);
+
+  const char *result1 =
+      "bigint   var   bigint   bigint   bigint  bigint  flag    multi_version_row_flag\n"
+      "0        var0  -20      0        20      20      EXIST   CLF\n"
+      "1        var1  -6       0        6       6       EXIST   CLF\n"
+      "2        var2  -30      MIN      30      20      EXIST   SCF\n"
+      "2        var2  -30      0        30      NOP     EXIST   N\n"
+      "2        var2  -20      0        20      20      EXIST   CL\n"
+      "3        var3  -20      0        20      20      EXIST   CLF\n";
+
+  ObMockIterator res_iter;
+  ObStoreRowIterator *scanner = NULL;
+  ObDatumRange range;
+  res_iter.reset();
+  range.set_whole_range();
+  trans_version_range.base_version_ = 1;
+  trans_version_range.multi_version_start_ = 1;
+  trans_version_range.snapshot_version_ = INT64_MAX;
+  prepare_query_param(trans_version_range);
+  ASSERT_EQ(OB_SUCCESS, merged_sstable->scan(iter_param_, context_, range, scanner));
+  ASSERT_EQ(OB_SUCCESS, res_iter.from(result1));
+  ObMockDirectReadIterator sstable_iter;
+  ASSERT_EQ(OB_SUCCESS, sstable_iter.init(scanner, allocator_, full_read_info_));
+  ASSERT_TRUE(res_iter.equals(sstable_iter, true/*cmp multi version row flag*/));
+  scanner->~ObStoreRowIterator();
+  handle1.reset();
+  handle2.reset();
+  merger.reset();
+}
+
 }
 }
 
@@ -615,6 +615,90 @@ TEST_F(TestTenantMetaMemMgr, test_wash_tablet)
   ASSERT_EQ(0, t3m_.tablet_pool_.inner_used_num_);
 }
 
+TEST_F(TestTenantMetaMemMgr, test_wash_resident_tablets)
+{
+  int ret = OB_SUCCESS;
+  const int64_t tablet_cnt = 4;
+  ObLSHandle ls_handle;
+  ObTabletHandle handles[tablet_cnt];
+
+  ObLSService *ls_svr = MTL(ObLSService*);
+  ret = ls_svr->get_ls(ls_id_, ls_handle, ObLSGetMod::STORAGE_MOD);
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  ObLS ls;
+  ObFreezer freezer;
+  ObTableSchema table_schema;
+  prepare_data_schema(table_schema);
+  ret = freezer.init(&ls);
+  ASSERT_EQ(common::OB_SUCCESS, ret);
+
+  ObMetaDiskAddr addr;
+  addr.first_id_ = 1;
+  addr.second_id_ = 2;
+  addr.offset_ = 0;
+  addr.size_ = 4096;
+  addr.type_ = ObMetaDiskAddr::DiskType::BLOCK;
+
+  for (int64_t i = 0; i < tablet_cnt; ++i) {
+    const ObTabletID tablet_id(1000000001 + i);
+    const ObTabletMapKey key(ls_id_, tablet_id);
+    ret = t3m_.acquire_tablet(WashTabletPriority::WTP_HIGH, key, ls_handle, handles[i], false);
+    ASSERT_EQ(common::OB_SUCCESS, ret);
+    ObTablet *tablet = handles[i].get_obj();
+    ASSERT_TRUE(nullptr != tablet);
+
+    ObTabletTxMultiSourceDataUnit &tx_data = tablet->tablet_meta_.tx_data_;
+    tx_data.tx_id_ = ObTabletCommon::FINAL_TX_ID;
+    share::SCN scn;
+    scn.convert_for_logservice(12345);
+    tx_data.tx_scn_ = scn;
+    tx_data.tablet_status_ = ObTabletStatus::NORMAL;
+
+    ObTableHandleV2 table_handle;
+    ret = t3m_.acquire_sstable(table_handle);
+    ASSERT_EQ(common::OB_SUCCESS, ret);
+    table_handle.get_table()->set_table_type(ObITable::TableType::MAJOR_SSTABLE);
+
+    share::SCN create_scn;
+    create_scn.convert_from_ts(ObTimeUtility::fast_current_time());
+    ObTabletID empty_tablet_id;
+    ObTabletTableStoreFlag store_flag;
+    store_flag.set_with_major_sstable();
+    ret = tablet->init(ls_id_, tablet_id, tablet_id, empty_tablet_id, empty_tablet_id,
+        create_scn, create_scn.get_val_for_tx(), table_schema,
+        lib::Worker::CompatMode::MYSQL, store_flag, table_handle, &freezer);
+    ASSERT_EQ(common::OB_SUCCESS, ret);
+    ret = t3m_.compare_and_swap_tablet(key, addr, handles[i], handles[i]);
+    ASSERT_EQ(common::OB_SUCCESS, ret);
+  }
+  ASSERT_EQ(tablet_cnt, t3m_.tablet_map_.map_.size());
+  ASSERT_EQ(tablet_cnt, t3m_.tablet_pool_.inner_used_num_);
+
+  // no limit, or under the limit
+  for (int64_t i = 0; i < tablet_cnt; ++i) {
+    handles[i].reset();
+  }
+  ASSERT_EQ(OB_SUCCESS, t3m_.wash_resident_tablets_(0));
+  ASSERT_EQ(tablet_cnt, t3m_.tablet_pool_.inner_used_num_);
+  ASSERT_EQ(OB_SUCCESS, t3m_.wash_resident_tablets_(tablet_cnt));
+  ASSERT_EQ(tablet_cnt, t3m_.tablet_pool_.inner_used_num_);
+
+  // over the limit, wash to 90% of the limit
+  ASSERT_EQ(OB_SUCCESS, t3m_.wash_resident_tablets_(2));
+  ASSERT_EQ(2 * ObTenantMetaMemMgr::RESIDENT_TABLET_LOW_WATERMARK_PCT / 100,
+            t3m_.tablet_pool_.inner_used_num_);
+  ASSERT_EQ(tablet_cnt, t3m_.tablet_map_.map_.size());
+
+  for (int64_t i = 0; i < tablet_cnt; ++i) {
+    const ObTabletMapKey key(ls_id_, ObTabletID(1000000001 + i));
+    ret = t3m_.tablet_map_.erase(key);
+    ASSERT_EQ(common::OB_SUCCESS, ret);
+  }
+  ASSERT_EQ(0, t3m_.tablet_map_.map_.size());
+  ASSERT_EQ(0, t3m_.tablet_pool_.inner_used_num_);
+}
+
 TEST_F(TestTenantMetaMemMgr, test_wash_inner_tablet)
 {
   int ret = OB_SUCCESS;
@@ -71,6 +71,9 @@ public:
   void insert_and_freeze();
   void empty_memtable_flush();
   void all_virtual_minor_freeze_info();
+  void wait_frozen_memtable_released(int64_t &wait_time);
+  void parallel_mini_merge(const bool enable_parallel, int64_t &release_time, int64_t &parallel_degree);
+  void get_mini_merge_parallel_degree(const int64_t start_time, int64_t &parallel_degree);
 private:
   int insert_thread_num_ = 3;
   int insert_num_ = 200000;
@@ -327,6 +330,96 @@ void ObMinorFreezeTest::empty_memtable_flush()
   }
 }
 
+void ObMinorFreezeTest::wait_frozen_memtable_released(int64_t &wait_time)
+{
+  share::ObTenantSwitchGuard tenant_guard;
+  ASSERT_EQ(OB_SUCCESS, tenant_guard.switch_to(RunCtx.tenant_id_));
+  const int64_t start_time = ObTimeUtility::current_time();
+  bool released = false;
+  while (!released && ObTimeUtility::current_time() - start_time <= freeze_duration_) {
+    ObTabletHandle tablet_handle;
+    ObSEArray<ObITable *, 4> frozen_memtables;
+    ASSERT_EQ(OB_SUCCESS, ls_handle_.get_ls()->get_tablet(tablet_id_, tablet_handle));
+    ASSERT_EQ(OB_SUCCESS, tablet_handle.get_obj()->get_memtables(frozen_memtables, false/*need_active*/));
+    if (frozen_memtables.empty()) {
+      released = true;
+    } else {
+      usleep(10 * 1000);
+    }
+  }
+  ASSERT_TRUE(released);
+  wait_time = ObTimeUtility::current_time() - start_time;
+}
+
+void ObMinorFreezeTest::get_mini_merge_parallel_degree(const int64_t start_time, int64_t &parallel_degree)
+{
+  common::ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy();
+  ObSqlString sql;
+  int64_t merge_cnt = 0;
+  parallel_degree = 0;
+  ASSERT_EQ(OB_SUCCESS, sql.assign_fmt("select count(*) as merge_cnt, max(parallel_degree) as parallel_degree"
+                                       " from oceanbase.__all_virtual_tablet_compaction_history"
+                                       " where tenant_id = %ld and tablet_id = %ld and type = 'MINI_MERGE'"
+                                       " and start_time >= usec_to_time(%ld)",
+                                       RunCtx.tenant_id_, tablet_id_.id(), start_time));
+  // the merge history is added after the memtable is released
+  for (int64_t retry = 0; 0 == merge_cnt && retry < 100; ++retry) {
+    SMART_VAR(ObMySQLProxy::MySQLResult, res) {
+      ASSERT_EQ(OB_SUCCESS, sql_proxy.read(res, sql.ptr()));
+      sqlclient::ObMySQLResult *result = res.get_result();
+      ASSERT_NE(nullptr, result);
+      ASSERT_EQ(OB_SUCCESS, result->next());
+      ASSERT_EQ(OB_SUCCESS, result->get_int("merge_cnt", merge_cnt));
+      if (merge_cnt > 0) {
+        ASSERT_EQ(OB_SUCCESS, result->get_int("parallel_degree", parallel_degree));
+      }
+    }
+    if (0 == merge_cnt) {
+      usleep(100 * 1000);
+    }
+  }
+  ASSERT_GT(merge_cnt, 0);
+}
+
+void ObMinorFreezeTest::parallel_mini_merge(const bool enable_parallel, int64_t &release_time, int64_t &parallel_degree)
+{
+  common::ObMySQLProxy &sql_proxy = get_curr_simple_server().get_sql_proxy2();
+  const int64_t batch_row_cnt = 1000;
+  const int64_t batch_cnt = 500;
+  const int64_t start_key = enable_parallel ? 1500000000 : 1000000000;
+  int64_t affected_rows = 0;
+  int64_t wait_time = 0;
+  ObSqlString sql;
+
+  ASSERT_EQ(OB_SUCCESS, sql.assign_fmt("alter system set _enable_parallel_minor_merge = %s",
+                                       enable_parallel ? "true" : "false"));
+  ASSERT_EQ(OB_SUCCESS, sql_proxy.write(sql.ptr(), affected_rows));
+  // wait the tenant config refreshed
+  sleep(5);
+
+  // make sure the data of previous cases are dumped
+  ASSERT_EQ(OB_SUCCESS, ls_handle_.get_ls()->tablet_freeze(tablet_id_, true/*is_sync*/));
+  wait_frozen_memtable_released(wait_time);
+
+  for (int64_t i = 0; i < batch_cnt; ++i) {
+    sql.reuse();
+    ASSERT_EQ(OB_SUCCESS, sql.assign("insert into t1 values"));
+    for (int64_t j = 0; j < batch_row_cnt; ++j) {
+      const int64_t key = start_key + i * batch_row_cnt + j;
+      ASSERT_EQ(OB_SUCCESS, sql.append_fmt("%s(%ld, %ld)", 0 == j ? "" : ",", key, key));
+    }
+    ASSERT_EQ(OB_SUCCESS, sql_proxy.write(sql.ptr(), affected_rows));
+    ASSERT_EQ(batch_row_cnt, affected_rows);
+  }
+
+  const int64_t freeze_time = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_SUCCESS, ls_handle_.get_ls()->tablet_freeze(tablet_id_, false/*is_sync*/));
+  wait_frozen_memtable_released(wait_time);
+  release_time = ObTimeUtility::current_time() - freeze_time;
+  get_mini_merge_parallel_degree(freeze_time, parallel_degree);
+  LOG_INFO("memstore released after mini merge", K(enable_parallel), K(release_time), K(parallel_degree));
+}
+
 TEST_F(ObMinorFreezeTest, observer_start)
 {
   SERVER_LOG(INFO, "observer_start succ");
@@ -365,6 +458,23 @@ TEST_F(ObMinorFreezeTest, insert_and_freeze)
   empty_memtable_flush();
 }
 
+TEST_F(ObMinorFreezeTest, parallel_mini_merge)
+{
+  int64_t serial_release_time = 0;
+  int64_t parallel_release_time = 0;
+  int64_t serial_degree = 0;
+  int64_t parallel_degree = 0;
+  get_tablet_id_and_ls_id();
+  get_ls();
+  parallel_mini_merge(false, serial_release_time, serial_degree);
+  parallel_mini_merge(true, parallel_release_time, parallel_degree);
+  LOG_INFO("memstore release time of mini merge", K(serial_release_time), K(parallel_release_time),
+           K(serial_degree), K(parallel_degree));
+  ASSERT_EQ(1, serial_degree);
+  // 500k rows are far more than one 32MB task, the mini merge must be split
+  ASSERT_GT(parallel_degree, 1);
+}
+
 } // end unittest
 } // end oceanbase
 
@@ -11,6 +11,7 @@
  */
 
 #include "large_buffer_pool.h"
+#include "lib/atomic/ob_atomic.h"
 #include "lib/ob_define.h"
 #include "lib/ob_errno.h"
 #include "lib/time/ob_time_utility.h"
@@ -24,6 +25,7 @@ namespace archive
 LargeBufferPool::LargeBufferPool() :
   inited_(false),
   total_limit_(0),
+  hold_size_(0),
   label_(),
   array_(),
   rwlock_()
@@ -65,6 +67,7 @@ void LargeBufferPool::destroy()
   }
   inited_ = false;
   total_limit_ = 0;
+  hold_size_ = 0;
   label_.reset();
 }
 
@@ -93,6 +96,10 @@ char *LargeBufferPool::acquire(const int64_t size)
       ARCHIVE_LOG(WARN, "acquire failed", K(ret));
     }
   }
+
+  if (NULL != data) {
+    ATOMIC_AAF(&hold_size_, size);
+  }
   return data;
 }
 
@@ -140,8 +147,10 @@ int LargeBufferPool::acquire_(const int64_t size, char *&data)
 void LargeBufferPool::reclaim_(void *ptr)
 {
   int ret = OB_SUCCESS;
+  int64_t issued_size = 0;
   for (int64_t i = 0; i < array_.count(); i++) {
-    if (array_.at(i).reclaim(ptr)) {
+    if (array_.at(i).reclaim(ptr, issued_size)) {
+      ATOMIC_SAF(&hold_size_, issued_size);
       break;
     }
   }
@@ -159,6 +168,7 @@ int LargeBufferPool::reserve_()
 
 LargeBufferPool::BufferNode::BufferNode(const char *label) :
   issued_(false),
+  issued_size_(0),
   last_used_timestamp_(OB_INVALID_TIMESTAMP),
   buffer_(label),
   rwlock_()
@@ -188,19 +198,22 @@ char *LargeBufferPool::BufferNode::acquire(const int64_t size, bool &issued)
   if (! issued) {
     if (NULL != (data = buffer_.acquire(size))) {
       issued_ = true;
+      issued_size_ = size;
       last_used_timestamp_ = common::ObTimeUtility::fast_current_time();
     }
   }
   return data;
 }
 
-bool LargeBufferPool::BufferNode::reclaim(void *ptr)
+bool LargeBufferPool::BufferNode::reclaim(void *ptr, int64_t &issued_size)
 {
   WLockGuard guard(rwlock_);
   bool bret = false;
   if (issued_ && buffer_.alloc_from(ptr)) {
     buffer_.reclaim(ptr);
     issued_ = false;
+    issued_size = issued_size_;
+    issued_size_ = 0;
     bret = true;
   }
   return bret;
@@ -222,6 +235,7 @@ int LargeBufferPool::BufferNode::purge()
 int LargeBufferPool::BufferNode::assign(const BufferNode &other)
 {
   issued_ = other.issued_;
+  issued_size_ = other.issued_size_;
   last_used_timestamp_ = other.last_used_timestamp_;
   return buffer_.assign(other.buffer_);
 }
@@ -14,6 +14,7 @@
 #define OCEANBASE_ARCHIVE_LARGE_BUFFER_POOL_H_
 
 #include "lib/alloc/alloc_struct.h"             // AOBJECT_TAIL_SIZE
+#include "lib/atomic/ob_atomic.h"               // ATOMIC_*
 #include "lib/container/ob_se_array.h"
 #include "lib/lock/ob_spin_rwlock.h"            // RWLock
 #include "lib/string/ob_fixed_length_string.h"  // ObFixedLengthString
@@ -40,11 +41,14 @@ public:
 public:
   char *acquire(const int64_t size);
   void reclaim(void *ptr);
-  // TODO total memory limit not support, memory limit with scheduler
+  // total memory limit is not enforced by acquire, users limit memory with scheduler
+  // according to the size of buffers issued and not reclaimed
+  int64_t get_hold_size() const { return ATOMIC_LOAD(&hold_size_); }
+  int64_t get_total_limit() const { return total_limit_; }
 
   void weed_out();
 
-  TO_STRING_KV(K_(inited), K_(total_limit), K_(label), K_(array));
+  TO_STRING_KV(K_(inited), K_(total_limit), K_(hold_size), K_(label), K_(array));
 private:
   typedef common::SpinRWLock RWLock;
   typedef common::SpinRLockGuard  RLockGuard;
@@ -53,20 +57,21 @@ private:
   class BufferNode
   {
   public:
-    BufferNode() : issued_(false), last_used_timestamp_(OB_INVALID_TIMESTAMP), buffer_() {}
+    BufferNode() : issued_(false), issued_size_(0), last_used_timestamp_(OB_INVALID_TIMESTAMP), buffer_() {}
     BufferNode(const BufferNode &other);
     explicit BufferNode(const char *buffer);
     ~BufferNode();
 
     char *acquire(const int64_t size, bool &issued);
-    bool reclaim(void *ptr);
+    bool reclaim(void *ptr, int64_t &issued_size);
     int purge();
     int assign(const BufferNode &other);
     int check_and_purge(const int64_t purge_threshold, bool &is_purged);
 
-    TO_STRING_KV(K_(issued), K_(last_used_timestamp), K_(buffer));
+    TO_STRING_KV(K_(issued), K_(issued_size), K_(last_used_timestamp), K_(buffer));
   private:
     bool issued_;
+    int64_t issued_size_;
     int64_t last_used_timestamp_;
     DynamicBuffer buffer_;
     mutable RWLock rwlock_;
@@ -82,6 +87,7 @@ private:
 
   bool inited_;
   int64_t total_limit_;
+  int64_t hold_size_;
   common::ObFixedLengthString<lib::AOBJECT_TAIL_SIZE> label_;
   BufferNodeArray array_;
 
@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_archive_compress_util.h"
+#include "lib/compress/ob_compressor.h"               // ObCompressor
+#include "lib/compress/ob_compressor_pool.h"          // ObCompressorPool
+#include "lib/ob_errno.h"
+#include "lib/oblog/ob_log_module.h"
+#include "logservice/palf/log_group_entry_header.h"   // LogGroupEntryHeader
+#include "ob_archive_define.h"                        // ObArchiveBlockMeta
+
+namespace oceanbase
+{
+using namespace common;
+namespace archive
+{
+int ObArchiveCompressUtil::get_max_compressed_size(const ObCompressorType type,
+    const int64_t src_len,
+    int64_t &max_size)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  if (OB_UNLIKELY(src_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), K(type), K(src_len));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(type, compressor))) {
+    ARCHIVE_LOG(WARN, "get compressor failed", K(ret), K(type));
+  } else if (OB_ISNULL(compressor)) {
+    ret = OB_ERR_UNEXPECTED;
+    ARCHIVE_LOG(WARN, "compressor is NULL", K(ret), K(type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(MAX_ARCHIVE_COMPRESS_BLOCK_SIZE, max_overflow_size))) {
+    ARCHIVE_LOG(WARN, "get max overflow size failed", K(ret), K(type));
+  } else {
+    // 压缩结果不大于原数据, 额外空间仅用于压缩最后一个块时的临时溢出
+    max_size = src_len + ObArchiveBlockMeta::get_meta_size() + max_overflow_size;
+  }
+  return ret;
+}
+
+int ObArchiveCompressUtil::compress(const ObCompressorType type,
+    const char *src,
+    const int64_t src_len,
+    char *dst,
+    const int64_t dst_len,
+    int64_t &dst_pos)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  const int64_t meta_size = ObArchiveBlockMeta::get_meta_size();
+  if (OB_UNLIKELY(NULL == src || src_len <= 0 || NULL == dst || dst_pos < 0 || dst_pos > dst_len)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), KP(src), K(src_len), KP(dst), K(dst_len), K(dst_pos));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(type, compressor))) {
+    ARCHIVE_LOG(WARN, "get compressor failed", K(ret), K(type));
+  } else if (OB_ISNULL(compressor)) {
+    ret = OB_ERR_UNEXPECTED;
+    ARCHIVE_LOG(WARN, "compressor is NULL", K(ret), K(type));
+  } else {
+    int64_t src_pos = 0;
+    while (OB_SUCC(ret) && src_pos < src_len) {
+      int64_t origin_len = 0;
+      int64_t data_len = 0;
+      char *data = dst + dst_pos + meta_size;
+      ObArchiveBlockMeta meta;
+      int64_t meta_pos = dst_pos;
+      if (OB_FAIL(get_block_len_(src + src_pos, src_len - src_pos, origin_len))) {
+        ARCHIVE_LOG(WARN, "get block len failed", K(ret), K(src_len), K(src_pos));
+      } else if (OB_UNLIKELY(dst_len - dst_pos < meta_size + origin_len)) {
+        ret = OB_BUF_NOT_ENOUGH;
+        ARCHIVE_LOG(WARN, "buf not enough", K(ret), K(dst_len), K(dst_pos), K(origin_len));
+      } else if (OB_FAIL(compressor->compress(src + src_pos, origin_len,
+              data, dst_len - dst_pos - meta_size, data_len))) {
+        ARCHIVE_LOG(WARN, "compress failed", K(ret), K(type), K(origin_len));
+      } else if (meta_size + data_len >= origin_len) {
+        // 压缩收益不足, 原样保存LogGroupEntry, 保证归档文件不大于原日志
+        MEMCPY(dst + dst_pos, src + src_pos, origin_len);
+        src_pos += origin_len;
+        dst_pos += origin_len;
+      } else if (OB_FAIL(meta.generate_meta(static_cast<int32_t>(type), origin_len, data, data_len))) {
+        ARCHIVE_LOG(WARN, "generate block meta failed", K(ret), K(type), K(origin_len), K(data_len));
+      } else if (OB_FAIL(meta.serialize(dst, dst_len, meta_pos))) {
+        ARCHIVE_LOG(WARN, "block meta serialize failed", K(ret), K(meta));
+      } else {
+        src_pos += origin_len;
+        dst_pos += meta_size + data_len;
+      }
+    }
+    compressor->reset_mem();
+  }
+  return ret;
+}
+
+int ObArchiveCompressUtil::scan(const char *buf,
+    const int64_t buf_len,
+    bool &compressed,
+    int64_t &origin_len,
+    int64_t &consumed_len)
+{
+  int ret = OB_SUCCESS;
+  compressed = false;
+  origin_len = 0;
+  consumed_len = 0;
+  if (OB_UNLIKELY(NULL == buf || buf_len < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len));
+  } else {
+    bool is_block = false;
+    int64_t unit_len = 0;
+    int64_t unit_origin_len = 0;
+    do {
+      if (OB_FAIL(get_unit_(buf + consumed_len, buf_len - consumed_len,
+              is_block, unit_len, unit_origin_len))) {
+        ARCHIVE_LOG(WARN, "get unit failed", K(ret), K(buf_len), K(consumed_len));
+      } else if (unit_len > 0) {
+        compressed = compressed || is_block;
+        origin_len += unit_origin_len;
+        consumed_len += unit_len;
+      }
+    } while (OB_SUCC(ret) && unit_len > 0);
+  }
+  return ret;
+}
+
+int ObArchiveCompressUtil::decompress(const char *src,
+    const int64_t src_len,
+    char *dst,
+    const int64_t dst_len,
+    int64_t &dst_pos)
+{
+  int ret = OB_SUCCESS;
+  const int64_t meta_size = ObArchiveBlockMeta::get_meta_size();
+  int64_t src_pos = 0;
+  if (OB_UNLIKELY(NULL == src || src_len < 0 || NULL == dst || dst_pos < 0 || dst_pos > dst_len)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), KP(src), K(src_len), KP(dst), K(dst_len), K(dst_pos));
+  }
+  while (OB_SUCC(ret) && src_pos < src_len) {
+    bool is_block = false;
+    int64_t unit_len = 0;
+    int64_t origin_len = 0;
+    if (OB_FAIL(get_unit_(src + src_pos, src_len - src_pos, is_block, unit_len, origin_len))) {
+      ARCHIVE_LOG(WARN, "get unit failed", K(ret), K(src_len), K(src_pos));
+    } else if (OB_UNLIKELY(0 == unit_len)) {
+      ret = OB_INVALID_DATA;
+      ARCHIVE_LOG(WARN, "incomplete archive data", K(ret), K(src_len), K(src_pos));
+    } else if (OB_UNLIKELY(dst_len - dst_pos < origin_len)) {
+      ret = OB_BUF_NOT_ENOUGH;
+      ARCHIVE_LOG(WARN, "buf not enough", K(ret), K(dst_len), K(dst_pos), K(origin_len));
+    } else if (! is_block) {
+      MEMCPY(dst + dst_pos, src + src_pos, origin_len);
+      dst_pos += origin_len;
+      src_pos += unit_len;
+    } else {
+      ObArchiveBlockMeta meta;
+      int64_t pos = 0;
+      const char *data = src + src_pos + meta_size;
+      ObCompressor *compressor = NULL;
+      int64_t data_len = 0;
+      if (OB_FAIL(meta.deserialize(src + src_pos, src_len - src_pos, pos))) {
+        ARCHIVE_LOG(WARN, "block meta deserialize failed", K(ret), K(src_pos));
+      } else if (OB_UNLIKELY(! meta.check_data_integrity(data, unit_len - meta_size))) {
+        ret = OB_INVALID_DATA;
+        ARCHIVE_LOG(ERROR, "compressed block checksum mismatch", K(ret), K(meta), K(src_pos));
+      } else if (NONE_COMPRESSOR == meta.flag_) {
+        MEMCPY(dst + dst_pos, data, meta.data_len_);
+        data_len = meta.data_len_;
+      } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(
+              static_cast<ObCompressorType>(meta.flag_), compressor))) {
+        ARCHIVE_LOG(WARN, "get compressor failed", K(ret), K(meta));
+      } else if (OB_ISNULL(compressor)) {
+        ret = OB_ERR_UNEXPECTED;
+        ARCHIVE_LOG(WARN, "compressor is NULL", K(ret), K(meta));
+      } else if (OB_FAIL(compressor->decompress(data, meta.data_len_,
+              dst + dst_pos, dst_len - dst_pos, data_len))) {
+        ARCHIVE_LOG(WARN, "decompress failed", K(ret), K(meta));
+      }
+
+      if (OB_FAIL(ret)) {
+      } else if (OB_UNLIKELY(data_len != meta.origin_data_len_)) {
+        ret = OB_INVALID_DATA;
+        ARCHIVE_LOG(ERROR, "decompressed data len mismatch", K(ret), K(meta), K(data_len));
+      } else {
+        dst_pos += data_len;
+        src_pos += unit_len;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObArchiveCompressUtil::get_unit_(const char *buf,
+    const int64_t buf_len,
+    bool &is_block,
+    int64_t &unit_len,
+    int64_t &origin_len)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  is_block = ObArchiveBlockMeta::is_block_meta(buf, buf_len);
+  unit_len = 0;
+  origin_len = 0;
+  if (is_block) {
+    ObArchiveBlockMeta meta;
+    if (buf_len < ObArchiveBlockMeta::get_meta_size()) {
+      // incomplete block meta
+    } else if (OB_FAIL(meta.deserialize(buf, buf_len, pos))) {
+      ARCHIVE_LOG(WARN, "block meta deserialize failed", K(ret), K(buf_len));
+    } else if (OB_UNLIKELY(! meta.is_valid())) {
+      ret = OB_INVALID_DATA;
+      ARCHIVE_LOG(ERROR, "invalid block meta", K(ret), K(meta));
+    } else if (pos + meta.data_len_ <= buf_len) {
+      unit_len = pos + meta.data_len_;
+      origin_len = meta.origin_data_len_;
+    }
+  } else {
+    palf::LogGroupEntryHeader header;
+    if (buf_len < palf::LogGroupEntryHeader::HEADER_SER_SIZE) {
+      // incomplete log group entry header
+    } else if (OB_FAIL(header.deserialize(buf, buf_len, pos))) {
+      ARCHIVE_LOG(WARN, "log group entry header deserialize failed", K(ret), K(buf_len));
+    } else if (OB_UNLIKELY(! header.check_header_integrity())) {
+      ret = OB_INVALID_DATA;
+      ARCHIVE_LOG(ERROR, "invalid log group entry header", K(ret), K(header));
+    } else if (pos + header.get_data_len() <= buf_len) {
+      unit_len = pos + header.get_data_len();
+      origin_len = unit_len;
+    }
+  }
+  return ret;
+}
+
+int ObArchiveCompressUtil::get_block_len_(const char *buf,
+    const int64_t buf_len,
+    int64_t &block_len)
+{
+  int ret = OB_SUCCESS;
+  bool is_block = false;
+  int64_t unit_len = 0;
+  int64_t origin_len = 0;
+  bool block_end = false;
+  block_len = 0;
+  // 压缩块只在LogGroupEntry边界切分, 解压后的数据总是以完整日志结束, 与归档文件offset对应的LSN一致
+  while (OB_SUCC(ret) && ! block_end && block_len < buf_len) {
+    if (OB_FAIL(get_unit_(buf + block_len, buf_len - block_len, is_block, unit_len, origin_len))) {
+      ARCHIVE_LOG(WARN, "get unit failed", K(ret), K(buf_len), K(block_len));
+    } else if (OB_UNLIKELY(is_block || 0 == unit_len)) {
+      ret = OB_INVALID_DATA;
+      ARCHIVE_LOG(WARN, "source data is not complete log group entries", K(ret), K(is_block),
+          K(unit_len), K(buf_len), K(block_len));
+    } else if (0 == block_len || block_len + unit_len <= ARCHIVE_COMPRESS_BLOCK_SIZE) {
+      block_len += unit_len;
+    } else {
+      block_end = true;
+    }
+  }
+  return ret;
+}
+} // namespace archive
+} // namespace oceanbase
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ARCHIVE_OB_ARCHIVE_COMPRESS_UTIL_H_
+#define OCEANBASE_ARCHIVE_OB_ARCHIVE_COMPRESS_UTIL_H_
+
+#include <cstdint>
+#include "lib/compress/ob_compress_util.h"  // ObCompressorType
+
+namespace oceanbase
+{
+namespace archive
+{
+using common::ObCompressorType;
+// 归档数据压缩和解压
+//
+// 归档时SendTask数据在LogGroupEntry边界切块(不超过ARCHIVE_COMPRESS_BLOCK_SIZE, 超大日志独占一块),
+// 每块独立压缩并以ObArchiveBlockMeta开头, 压缩后不小于原数据的块原样保存LogGroupEntry;
+// 同一归档文件中压缩块和未压缩的LogGroupEntry可能混合存在(如归档过程中修改压缩配置后重启),
+// 恢复时按magic区分, 仅解压压缩块
+class ObArchiveCompressUtil
+{
+public:
+  // 压缩src_len数据所需的最大buffer大小
+  static int get_max_compressed_size(const ObCompressorType type,
+      const int64_t src_len,
+      int64_t &max_size);
+
+  // 按块压缩[src, src + src_len), 压缩结果追加到dst + dst_pos, src必须为完整的LogGroupEntry
+  // 压缩结果不大于src_len, 但压缩过程需要get_max_compressed_size大小的buffer
+  static int compress(const ObCompressorType type,
+      const char *src,
+      const int64_t src_len,
+      char *dst,
+      const int64_t dst_len,
+      int64_t &dst_pos);
+
+  // 扫描归档数据中完整的压缩块和LogGroupEntry
+  //
+  // @param[out] compressed, 是否包含压缩块
+  // @param[out] origin_len, 完整的压缩块和LogGroupEntry解压后大小
+  // @param[out] consumed_len, 完整的压缩块和LogGroupEntry在buf中的大小, 不完整的尾部数据不计入
+  static int scan(const char *buf,
+      const int64_t buf_len,
+      bool &compressed,
+      int64_t &origin_len,
+      int64_t &consumed_len);
+
+  // 解压[src, src + src_len)中的压缩块, 并拷贝未压缩的LogGroupEntry, src必须以完整的块结束
+  static int decompress(const char *src,
+      const int64_t src_len,
+      char *dst,
+      const int64_t dst_len,
+      int64_t &dst_pos);
+
+private:
+  // 获取buf头部完整单元(压缩块或LogGroupEntry)的大小, 数据不完整时unit_len为0
+  static int get_unit_(const char *buf,
+      const int64_t buf_len,
+      bool &is_block,
+      int64_t &unit_len,
+      int64_t &origin_len);
+  // 获取buf头部不超过ARCHIVE_COMPRESS_BLOCK_SIZE的完整LogGroupEntry大小, 至少包含一条日志
+  static int get_block_len_(const char *buf,
+      const int64_t buf_len,
+      int64_t &block_len);
+};
+} // namespace archive
+} // namespace oceanbase
+#endif /* OCEANBASE_ARCHIVE_OB_ARCHIVE_COMPRESS_UTIL_H_ */
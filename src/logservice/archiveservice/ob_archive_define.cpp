@@ -288,7 +288,7 @@ bool ObArchiveFileHeader::is_valid() const
     && checksum_ == ob_crc64(this, sizeof(*this) - sizeof(checksum_));
 }
 
-int ObArchiveFileHeader::generate_header(const LSN &lsn)
+int ObArchiveFileHeader::generate_header(const LSN &lsn, const int32_t flag)
 {
   int ret = OB_SUCCESS;
   if (OB_UNLIKELY(! lsn.is_valid())) {
@@ -296,7 +296,7 @@ int ObArchiveFileHeader::generate_header(const LSN &lsn)
   } else {
     magic_ = ARCHIVE_FILE_HEADER_MAGIC;
     version_ = 1;
-    flag_ = 0;
+    flag_ = flag;
     unit_size_ = DEFAULT_ARCHIVE_UNIT_SIZE;
     start_lsn_ = lsn.val_;
     checksum_ = static_cast<int64_t>(ob_crc64(this, sizeof(*this) - sizeof(checksum_)));
@@ -304,6 +304,131 @@ int ObArchiveFileHeader::generate_header(const LSN &lsn)
   return ret;
 }
 
+void ObArchiveBlockMeta::reset()
+{
+  magic_ = 0;
+  version_ = 0;
+  flag_ = 0;
+  origin_data_len_ = 0;
+  data_len_ = 0;
+  data_checksum_ = 0;
+  meta_checksum_ = 0;
+}
+
+DEFINE_SERIALIZE(ObArchiveBlockMeta)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(0 >= buf_len)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid arguments", KP(buf), K(buf_len), K(ret));
+  } else if (OB_FAIL(serialization::encode_i16(buf, buf_len, pos, magic_))) {
+    ARCHIVE_LOG(WARN, "failed to encode magic_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i16(buf, buf_len, pos, version_))) {
+    ARCHIVE_LOG(WARN, "failed to encode version_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i32(buf, buf_len, pos, flag_))) {
+    ARCHIVE_LOG(WARN, "failed to encode flag_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, origin_data_len_))) {
+    ARCHIVE_LOG(WARN, "failed to encode origin_data_len_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, data_len_))) {
+    ARCHIVE_LOG(WARN, "failed to encode data_len_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, data_checksum_))) {
+    ARCHIVE_LOG(WARN, "failed to encode data_checksum_", KP(buf), K(buf_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, meta_checksum_))) {
+    ARCHIVE_LOG(WARN, "failed to encode meta_checksum_", KP(buf), K(buf_len), K(pos), K(ret));
+  }
+  return ret;
+}
+
+DEFINE_DESERIALIZE(ObArchiveBlockMeta)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || 0 > data_len) {
+    ret = OB_INVALID_DATA;
+    ARCHIVE_LOG(WARN, "invalid arguments", KP(buf), K(data_len), K(ret));
+  } else if (OB_FAIL(serialization::decode_i16(buf, data_len, pos, &magic_))) {
+    ARCHIVE_LOG(WARN, "failed to decode magic_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i16(buf, data_len, pos, &version_))) {
+    ARCHIVE_LOG(WARN, "failed to decode version_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i32(buf, data_len, pos, &flag_))) {
+    ARCHIVE_LOG(WARN, "failed to decode flag_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &origin_data_len_))) {
+    ARCHIVE_LOG(WARN, "failed to decode origin_data_len_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &data_len_))) {
+    ARCHIVE_LOG(WARN, "failed to decode data_len_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &data_checksum_))) {
+    ARCHIVE_LOG(WARN, "failed to decode data_checksum_", KP(buf), K(data_len), K(pos), K(ret));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &meta_checksum_))) {
+    ARCHIVE_LOG(WARN, "failed to decode meta_checksum_", KP(buf), K(data_len), K(pos), K(ret));
+  }
+  return ret;
+}
+
+DEFINE_GET_SERIALIZE_SIZE(ObArchiveBlockMeta)
+{
+  int64_t size = 0;
+  size += serialization::encoded_length_i16(magic_);
+  size += serialization::encoded_length_i16(version_);
+  size += serialization::encoded_length_i32(flag_);
+  size += serialization::encoded_length_i64(origin_data_len_);
+  size += serialization::encoded_length_i64(data_len_);
+  size += serialization::encoded_length_i64(data_checksum_);
+  size += serialization::encoded_length_i64(meta_checksum_);
+  return size;
+}
+
+bool ObArchiveBlockMeta::is_valid() const
+{
+  return ARCHIVE_BLOCK_META_MAGIC == magic_
+    && origin_data_len_ > 0
+    && origin_data_len_ <= MAX_ARCHIVE_COMPRESS_BLOCK_SIZE
+    && data_len_ > 0
+    && meta_checksum_ == static_cast<int64_t>(ob_crc64(this, sizeof(*this) - sizeof(meta_checksum_)));
+}
+
+int ObArchiveBlockMeta::generate_meta(const int32_t flag,
+    const int64_t origin_data_len,
+    const char *data,
+    const int64_t data_len)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(origin_data_len <= 0 || origin_data_len > MAX_ARCHIVE_COMPRESS_BLOCK_SIZE
+        || NULL == data || data_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    ARCHIVE_LOG(WARN, "invalid argument", K(ret), K(flag), K(origin_data_len), KP(data), K(data_len));
+  } else {
+    magic_ = ARCHIVE_BLOCK_META_MAGIC;
+    version_ = 1;
+    flag_ = flag;
+    origin_data_len_ = origin_data_len;
+    data_len_ = data_len;
+    data_checksum_ = static_cast<int64_t>(ob_crc64(data, data_len));
+    meta_checksum_ = static_cast<int64_t>(ob_crc64(this, sizeof(*this) - sizeof(meta_checksum_)));
+  }
+  return ret;
+}
+
+bool ObArchiveBlockMeta::check_data_integrity(const char *data, const int64_t data_len) const
+{
+  return NULL != data
+    && data_len == data_len_
+    && data_checksum_ == static_cast<int64_t>(ob_crc64(data, data_len));
+}
+
+bool ObArchiveBlockMeta::is_block_meta(const char *buf, const int64_t buf_len)
+{
+  int16_t magic = 0;
+  int64_t pos = 0;
+  return NULL != buf
+    && OB_SUCCESS == serialization::decode_i16(buf, buf_len, pos, &magic)
+    && ARCHIVE_BLOCK_META_MAGIC == magic;
+}
+
+int64_t ObArchiveBlockMeta::get_meta_size()
+{
+  static const ObArchiveBlockMeta meta;
+  return meta.get_serialize_size();
+}
+
 DEFINE_SERIALIZE(ObLSMetaFileHeader)
 {
   int ret = OB_SUCCESS;
@@ -48,7 +48,15 @@ const int64_t OB_INVALID_ARCHIVE_FILE_OFFSET = -1;
 const int64_t COMMON_HEADER_SIZE = 4 * 1024L;    // 4K
 const int64_t ARCHIVE_FILE_HEADER_SIZE = COMMON_HEADER_SIZE;
 const int64_t DEFAULT_ARCHIVE_UNIT_SIZE = 16 * 1024L;   // 归档压缩加密单元大小
+// 压缩块仅在压缩后(含ObArchiveBlockMeta)小于原数据时保存, 归档文件数据不会大于文件包含的日志大小
 const int64_t ARCHIVE_FILE_DATA_BUF_SIZE = MAX_ARCHIVE_FILE_SIZE + ARCHIVE_FILE_HEADER_SIZE;
+// 归档压缩块大小, 单个SendTask数据按LogGroupEntry边界切块独立压缩, 每个压缩块前为ObArchiveBlockMeta
+const int64_t ARCHIVE_COMPRESS_BLOCK_SIZE = 2 * 1024 * 1024L;
+// 压缩块至少包含一条LogGroupEntry, 单条日志大于ARCHIVE_COMPRESS_BLOCK_SIZE时独占一个压缩块
+const int64_t MAX_ARCHIVE_COMPRESS_BLOCK_SIZE = ARCHIVE_COMPRESS_BLOCK_SIZE > palf::MAX_LOG_BUFFER_SIZE
+  ? ARCHIVE_COMPRESS_BLOCK_SIZE : palf::MAX_LOG_BUFFER_SIZE;
+// 归档文件包含压缩块
+const int32_t ARCHIVE_FILE_COMPRESS_FLAG = 1;
 
 const int64_t DEFAULT_MAX_LOG_SIZE = palf::MAX_LOG_BUFFER_SIZE;
 const int64_t MAX_FETCH_TASK_NUM = 4;
@@ -180,7 +188,8 @@ struct ObArchiveFileHeader
   int64_t checksum_;
 
   bool is_valid() const;
-  int generate_header(const LSN &lsn);
+  int generate_header(const LSN &lsn, const int32_t flag);
+  bool is_compressed() const { return 0 != (flag_ & ARCHIVE_FILE_COMPRESS_FLAG); }
   NEED_SERIALIZE_AND_DESERIALIZE;
   TO_STRING_KV(K_(magic),
                K_(version),
@@ -193,6 +202,42 @@ private:
   static const int16_t ARCHIVE_FILE_HEADER_MAGIC = 0x4648; // FH means archive file header
 };
 
+// block meta for compressed archive data
+//
+// data of a SendTask is cut into blocks of whole LogGroupEntries up to ARCHIVE_COMPRESS_BLOCK_SIZE,
+// and each compressed block is prefixed with its meta; the magic differs from LogGroupEntryHeader,
+// so compressed blocks and uncompressed LogGroupEntry can be distinguished in the same archive file
+struct ObArchiveBlockMeta
+{
+  int16_t magic_;                    // BM
+  int16_t version_;
+  int32_t flag_;                     // compressor type of the block
+  int64_t origin_data_len_;
+  int64_t data_len_;
+  int64_t data_checksum_;
+  int64_t meta_checksum_;
+
+  ObArchiveBlockMeta() { reset(); }
+  void reset();
+  bool is_valid() const;
+  int generate_meta(const int32_t flag, const int64_t origin_data_len,
+      const char *data, const int64_t data_len);
+  bool check_data_integrity(const char *data, const int64_t data_len) const;
+  static bool is_block_meta(const char *buf, const int64_t buf_len);
+  static int64_t get_meta_size();
+  NEED_SERIALIZE_AND_DESERIALIZE;
+  TO_STRING_KV(K_(magic),
+               K_(version),
+               K_(flag),
+               K_(origin_data_len),
+               K_(data_len),
+               K_(data_checksum),
+               K_(meta_checksum));
+
+private:
+  static const int16_t ARCHIVE_BLOCK_META_MAGIC = 0x424D; // BM means archive block meta
+};
+
 // file header for ls meta file
 struct ObLSMetaFileHeader
 {
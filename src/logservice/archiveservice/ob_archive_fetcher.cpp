@@ -22,6 +22,7 @@
 #include "logservice/palf/log_group_entry.h"  // LogGroupEntry
 #include "logservice/palf_handle_guard.h"     // PalfHandleGuard
 #include "ob_archive_allocator.h"             // ObArchiveAllocator
+#include "ob_archive_compress_util.h"         // ObArchiveCompressUtil
 #include "ob_archive_define.h"                // ArchiveWorkStation
 #include "ob_archive_sender.h"                // ObArchiveSender
 #include "ob_ls_mgr.h"                        // ObArchiveLSMgr
@@ -181,8 +182,8 @@ int ObArchiveFetcher::set_archive_info(
     ARCHIVE_LOG(WARN, "invalid argument", K(ret), K(interval_us), K(genesis_scn), K(base_piece_id), K(unit_size));
   } else {
     piece_interval_ = interval_us;
-    UNUSED(need_compress);
-    UNUSED(type);
+    need_compress_ = need_compress;
+    compress_type_ = type;
     UNUSED(need_encrypt);
     genesis_scn_ = genesis_scn;
     base_piece_id_ = base_piece_id;
@@ -196,6 +197,7 @@ void ObArchiveFetcher::clear_archive_info()
 {
   piece_interval_ = 0;
   need_compress_ = false;
+  compress_type_ = INVALID_COMPRESSOR;
   unit_size_ = 0;
   ARCHIVE_LOG(INFO, "fetcher clear info succ");
 }
@@ -674,8 +676,6 @@ int ObArchiveFetcher::handle_origin_buffer_(TmpMemoryHelper &helper)
   } else if (0 == origin_buf_size) {
     // no data, just skip
     ARCHIVE_LOG(INFO, "no data exist, skip it", K(helper));
-  } else if (OB_FAIL(do_compress_(helper))) {
-    ARCHIVE_LOG(WARN, "do compress failed", K(ret), K(helper));
   } else if (OB_FAIL(do_encrypt_(helper))) {
     ARCHIVE_LOG(WARN, "do encrypt failed", K(ret), K(helper));
   } else {
@@ -691,10 +691,16 @@ int ObArchiveFetcher::handle_origin_buffer_(TmpMemoryHelper &helper)
   return ret;
 }
 
+// 以SendTask全部数据为单位在LogGroupEntry边界切块压缩, 压缩块独立解压, 压缩结果不大于原数据
 int ObArchiveFetcher::do_compress_(TmpMemoryHelper &helper)
 {
-  UNUSED(helper);
-  return OB_SUCCESS;
+  int ret = OB_SUCCESS;
+  if (! need_compress_ || helper.is_empty()) {
+    // skip
+  } else if (OB_FAIL(helper.compress(compress_type_))) {
+    ARCHIVE_LOG(WARN, "helper compress failed", K(ret), K(compress_type_), K(helper));
+  }
+  return ret;
 }
 
 int ObArchiveFetcher::do_encrypt_(TmpMemoryHelper &helper)
@@ -785,6 +791,8 @@ int ObArchiveFetcher::build_send_task_(const ObLSID &id,
   const SCN &max_scn = helper.get_unitized_scn();
   if (helper.is_empty()) {
     ARCHIVE_LOG(INFO, "helper is empty, just skip", K(helper));
+  } else if (OB_FAIL(do_compress_(helper))) {
+    ARCHIVE_LOG(WARN, "do compress failed", K(ret), K(id), K(helper));
   } else if (FALSE_IT(task = helper.gen_send_task())) {
   } else if (OB_FAIL(task->init(tenant_id_, id, station,
           piece, start_offset, end_offset, max_scn))) {
@@ -1169,6 +1177,35 @@ int ObArchiveFetcher::TmpMemoryHelper::get_handled_buf(char *&buf, int64_t &buf_
   return ret;
 }
 
+int ObArchiveFetcher::TmpMemoryHelper::compress(const ObCompressorType type)
+{
+  int ret = OB_SUCCESS;
+  char *data = NULL;
+  int64_t max_size = 0;
+  int64_t pos = 0;
+  const int64_t reserved_size = get_reserved_buf_size_();
+  if (OB_UNLIKELY(is_empty())) {
+    ret = OB_ERR_UNEXPECTED;
+    ARCHIVE_LOG(WARN, "helper is empty, no data to compress", K(ret), KPC(this));
+  } else if (OB_FAIL(ObArchiveCompressUtil::get_max_compressed_size(type, ec_buf_pos_, max_size))) {
+    ARCHIVE_LOG(WARN, "get max compressed size failed", K(ret), K(type), KPC(this));
+  } else if (OB_ISNULL(data = allocator_->alloc_send_task(max_size + reserved_size))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    ARCHIVE_LOG(WARN, "alloc memory failed", K(ret), K(max_size));
+  } else if (OB_FAIL(ObArchiveCompressUtil::compress(type, ec_buf_, ec_buf_pos_,
+          data + reserved_size, max_size, pos))) {
+    ARCHIVE_LOG(WARN, "compress failed", K(ret), K(type), KPC(this));
+    allocator_->free_send_task(data);
+  } else {
+    ARCHIVE_LOG(TRACE, "compress send buffer succ", K(type), "origin_size", ec_buf_pos_, "compressed_size", pos);
+    inner_free_send_buffer_();
+    ec_buf_ = data + reserved_size;
+    ec_buf_size_ = max_size;
+    ec_buf_pos_ = pos;
+  }
+  return ret;
+}
+
 int ObArchiveFetcher::TmpMemoryHelper::get_send_buffer_(const int64_t size)
 {
   int ret = OB_SUCCESS;
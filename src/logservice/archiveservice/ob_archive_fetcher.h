@@ -176,12 +176,12 @@ private:
   // 1.5 处理加密压缩
   int handle_origin_buffer_(TmpMemoryHelper &helper);
 
-  // 1.5.1 压缩
-  int do_compress_(TmpMemoryHelper &helper);
-
-  // 1.5.2 加密
+  // 1.5.1 加密
   int do_encrypt_(TmpMemoryHelper &helper);
 
+  // 1.5.2 压缩, 创建send_task前对全部数据按块压缩
+  int do_compress_(TmpMemoryHelper &helper);
+
   // 1.6 创建send_task
   int build_send_task_(const ObLSID &id,
       const ArchiveWorkStation &station, TmpMemoryHelper &helper, ObArchiveSendTask *&task);
@@ -257,6 +257,8 @@ private:
     bool is_empty() const { return NULL == ec_buf_ || 0 == ec_buf_pos_; }
     bool reach_end() { return cur_offset_ == end_offset_ || cur_offset_ == commit_offset_; }
     ObArchiveSendTask *gen_send_task();
+    // 按块压缩已处理数据, 替换send buffer
+    int compress(const ObCompressorType type);
 
     TO_STRING_KV(K_(tenant_id),
                  K_(id),
@@ -17,6 +17,7 @@
 #include "lib/ob_errno.h"
 #include "lib/utility/ob_macro_utils.h"
 #include "ob_archive_define.h"
+#include "ob_archive_compress_util.h"       // ObArchiveCompressUtil
 #include "logservice/palf/log_group_entry_header.h"
 #include "share/backup/ob_archive_path.h"
 #include "share/backup/ob_backup_io_adapter.h"
@@ -353,9 +354,18 @@ int ObArchiveFileUtils::extract_file_min_log_info_(const ObString &uri,
   } else if (OB_UNLIKELY(!file_header.is_valid())) {
     ret = OB_ERR_UNEXPECTED;
     ARCHIVE_LOG(ERROR, "invalid file header", K(ret), K(file_header));
+  } else if (ObArchiveBlockMeta::is_block_meta(data + ARCHIVE_FILE_HEADER_SIZE,
+          data_len - ARCHIVE_FILE_HEADER_SIZE)) {
+    if (OB_FAIL(extract_compressed_log_header_(uri, storage_info, data + ARCHIVE_FILE_HEADER_SIZE,
+            data_len - ARCHIVE_FILE_HEADER_SIZE, header))) {
+      ARCHIVE_LOG(WARN, "extract compressed log header failed", K(ret), K(file_header));
+    }
   } else if (OB_FAIL(header.deserialize(data + ARCHIVE_FILE_HEADER_SIZE,
           data_len - ARCHIVE_FILE_HEADER_SIZE, log_pos))) {
     ARCHIVE_LOG(WARN, "log header deserialize failed", K(ret), K(file_header));
+  }
+
+  if (OB_FAIL(ret)) {
   } else if (OB_UNLIKELY(! header.check_header_integrity())) {
     ret = OB_ERR_UNEXPECTED;
     ARCHIVE_LOG(ERROR, "invalid log header", K(ret), K(header));
@@ -371,6 +381,54 @@ int ObArchiveFileUtils::extract_file_min_log_info_(const ObString &uri,
   return ret;
 }
 
+int ObArchiveFileUtils::extract_compressed_log_header_(const ObString &uri,
+    share::ObBackupStorageInfo *storage_info,
+    const char *meta_buf,
+    const int64_t meta_buf_len,
+    palf::LogGroupEntryHeader &header)
+{
+  int ret = OB_SUCCESS;
+  ObArchiveBlockMeta meta;
+  int64_t pos = 0;
+  int64_t log_pos = 0;
+  int64_t read_size = 0;
+  int64_t origin_len = 0;
+  int64_t block_len = 0;
+  char *block = NULL;
+  char *origin = NULL;
+  if (OB_FAIL(meta.deserialize(meta_buf, meta_buf_len, pos))) {
+    ARCHIVE_LOG(WARN, "block meta deserialize failed", K(ret));
+  } else if (OB_UNLIKELY(! meta.is_valid())) {
+    ret = OB_INVALID_DATA;
+    ARCHIVE_LOG(ERROR, "invalid block meta", K(ret), K(meta));
+  } else if (FALSE_IT(block_len = pos + meta.data_len_)) {
+  } else if (OB_ISNULL(block = (char*)share::mtl_malloc(block_len, "ArcMinInfo"))
+      || OB_ISNULL(origin = (char*)share::mtl_malloc(meta.origin_data_len_, "ArcMinInfo"))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    ARCHIVE_LOG(WARN, "alloc memory failed", K(ret), K(meta));
+  } else if (OB_FAIL(range_read(uri, storage_info, block, block_len, ARCHIVE_FILE_HEADER_SIZE, read_size))) {
+    ARCHIVE_LOG(WARN, "read file failed", K(ret), K(meta));
+  } else if (OB_UNLIKELY(read_size != block_len)) {
+    ret = OB_INVALID_DATA;
+    ARCHIVE_LOG(WARN, "compressed block incomplete", K(ret), K(meta), K(read_size));
+  } else if (OB_FAIL(ObArchiveCompressUtil::decompress(block, block_len,
+          origin, meta.origin_data_len_, origin_len))) {
+    ARCHIVE_LOG(WARN, "decompress block failed", K(ret), K(meta));
+  } else if (OB_FAIL(header.deserialize(origin, origin_len, log_pos))) {
+    ARCHIVE_LOG(WARN, "log header deserialize failed", K(ret), K(meta));
+  }
+
+  if (NULL != block) {
+    share::mtl_free(block);
+    block = NULL;
+  }
+  if (NULL != origin) {
+    share::mtl_free(origin);
+    origin = NULL;
+  }
+  return ret;
+}
+
 int ObArchiveFileUtils::locate_(const int64_t min_file_id,
     const int64_t max_file_id,
     const SCN &ref_scn,int64_t &file_id,
@@ -20,6 +20,10 @@
 #include <cstdint>
 namespace oceanbase
 {
+namespace palf
+{
+class LogGroupEntryHeader;
+}
 namespace archive
 {
 using oceanbase::common::ObString;
@@ -90,6 +94,13 @@ private:
       palf::LSN &lsn,
       share::SCN &scn);
 
+  // 归档文件首个单元为压缩块时, 读取并解压该块获取首条日志header
+  static int extract_compressed_log_header_(const ObString &uri,
+      share::ObBackupStorageInfo *storage_info,
+      const char *meta_buf,
+      const int64_t meta_buf_len,
+      palf::LogGroupEntryHeader &header);
+
   static int locate_(const int64_t min_file_id,
       const int64_t max_file_id,
       const share::SCN &ref_scn,int64_t &file_id,
@@ -677,8 +677,14 @@ int ObArchiveSender::fill_file_header_if_needed_(const ObArchiveSendTask &task,
   int64_t pos = 0;
   ObArchiveFileHeader file_header;
   const palf::LSN &lsn = task.get_start_lsn();
+  char *data = NULL;
+  int64_t data_len = 0;
+  int32_t flag = 0;
   if (FALSE_IT(task.get_origin_buffer(filled_data, filled_data_len))) {
-  } else if (OB_FAIL(file_header.generate_header(lsn))) {
+  } else if (OB_FAIL(task.get_buffer(data, data_len))) {
+    ARCHIVE_LOG(WARN, "get buffer failed", K(ret), K(task));
+  } else if (FALSE_IT(flag = ObArchiveBlockMeta::is_block_meta(data, data_len) ? ARCHIVE_FILE_COMPRESS_FLAG : 0)) {
+  } else if (OB_FAIL(file_header.generate_header(lsn, flag))) {
     ARCHIVE_LOG(WARN, "generate archive file header failed", K(ret), K(lsn));
   } else if (OB_FAIL(file_header.serialize(filled_data, filled_data_len, pos))) {
     ARCHIVE_LOG(WARN, "archive file header serialize failed", K(ret));
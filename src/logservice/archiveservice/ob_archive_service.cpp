@@ -13,11 +13,13 @@
 #include "ob_archive_service.h"
 #include "lib/ob_define.h"                          // is_meta_tenant is_sys_tenant
 #include "lib/compress/ob_compress_util.h"          // ObCompressorType
+#include "lib/compress/ob_compressor_pool.h"        // ObCompressorPool
 #include "lib/ob_errno.h"
 #include "share/backup/ob_archive_struct.h"         // ObTenantArchiveRoundAttr
 #include "share/backup/ob_tenant_archive_round.h"   // ObArchiveRoundHandler
 #include "share/rc/ob_tenant_base.h"                // MTL_*
 #include "observer/ob_server_struct.h"              // GCTX
+#include "observer/omt/ob_tenant_config_mgr.h"     // tenant_config
 #include "logservice/palf/lsn.h"                    // LSN
 #include "share/scn.h"                    // LSN
 #include "share/backup/ob_backup_connectivity.h"
@@ -419,6 +421,23 @@ int ObArchiveService::start_archive_(const ObTenantArchiveRoundAttr &attr)
   return ret;
 }
 
+// 压缩配置仅在设置归档轮次信息时生效
+int ObArchiveService::get_compressor_type_(ObCompressorType &type) const
+{
+  int ret = OB_SUCCESS;
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id_));
+  type = NONE_COMPRESSOR;
+  if (! tenant_config.is_valid()) {
+    ARCHIVE_LOG(WARN, "tenant config is not valid, archive without compression", K_(tenant_id));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor_type(
+          tenant_config->log_archive_compress_func, type))) {
+    ARCHIVE_LOG(WARN, "log_archive_compress_func invalid", K(ret), K_(tenant_id));
+  } else {
+    ARCHIVE_LOG(INFO, "get archive compressor type succ", K_(tenant_id), K(type));
+  }
+  return ret;
+}
+
 int ObArchiveService::set_log_archive_info_(const ObTenantArchiveRoundAttr &attr)
 {
   int ret = OB_SUCCESS;
@@ -427,11 +446,14 @@ int ObArchiveService::set_log_archive_info_(const ObTenantArchiveRoundAttr &attr
   const SCN &genesis_scn = attr.start_scn_;
   const int64_t base_piece_id = attr.base_piece_id_;
   const int64_t unit_size = 100;
-  const bool need_compress = false;
+  bool need_compress = false;
   ObCompressorType type = INVALID_COMPRESSOR;
   const bool need_encrypt = false;
   const SCN &round_start_scn = attr.start_scn_;
-  if (OB_FAIL(fetcher_.set_archive_info(piece_interval, genesis_scn, base_piece_id,
+  if (OB_FAIL(get_compressor_type_(type))) {
+    ARCHIVE_LOG(WARN, "get archive compressor type failed", K(ret));
+  } else if (FALSE_IT(need_compress = NONE_COMPRESSOR != type)) {
+  } else if (OB_FAIL(fetcher_.set_archive_info(piece_interval, genesis_scn, base_piece_id,
                                         unit_size, need_compress, type, need_encrypt))) {
     ARCHIVE_LOG(ERROR, "archive fetcher set archive info failed", K(ret));
   } else if (OB_FAIL(ls_mgr_.set_archive_info(round_start_scn, piece_interval, genesis_scn, base_piece_id))) {
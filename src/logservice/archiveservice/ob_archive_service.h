@@ -140,6 +140,7 @@ private:
   int start_archive_(const ObTenantArchiveRoundAttr &attr);
   // 3.1 设置归档信息
   int set_log_archive_info_(const ObTenantArchiveRoundAttr &attr);
+  int get_compressor_type_(common::ObCompressorType &type) const;
   // 3.2 通知各模块开启归档
   void notify_start_();
 
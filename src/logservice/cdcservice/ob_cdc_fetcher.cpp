@@ -12,6 +12,7 @@
 
 #define USING_LOG_PREFIX EXTLOG
 #include "logservice/ob_log_service.h"          // ObLogService
+#include "logservice/ob_log_base_header.h"      // ObLogBaseHeader
 #include "ob_cdc_service_monitor.h"
 #include "ob_cdc_fetcher.h"
 #include "ob_cdc_define.h"
@@ -285,8 +286,8 @@ int ObCdcFetcher::do_fetch_log_(const ObCdcLSFetchLogReq &req,
   resp.set_ls_id(ls_id);
 
   // execute specific logging logic
-  if (OB_FAIL(ls_fetch_log_(ls_id, end_tstamp, fetch_flag, resp, frt, reach_upper_limit,
-          reach_max_lsn, scan_round_count, fetched_log_count, ctx))) {
+  if (OB_FAIL(ls_fetch_log_(ls_id, end_tstamp, fetch_flag, req.get_log_type_filter(), resp, frt,
+          reach_upper_limit, reach_max_lsn, scan_round_count, fetched_log_count, ctx))) {
     LOG_WARN("ls_fetch_log_ error", KR(ret), K(ls_id), K(frt));
   } else { }
 
@@ -439,6 +440,7 @@ FetchMode ObCdcFetcher::get_fetch_mode_when_fetching_log_(const ClientLSCtx &ctx
 int ObCdcFetcher::ls_fetch_log_(const ObLSID &ls_id,
     const int64_t end_tstamp,
     const int8_t fetch_flag,
+    const int64_t log_type_filter,
     obrpc::ObCdcLSFetchLogResp &resp,
     FetchRunTime &frt,
     bool &reach_upper_limit,
@@ -455,6 +457,7 @@ int ObCdcFetcher::ls_fetch_log_(const ObLSID &ls_id,
   bool ls_exist_in_palf = true;
   bool need_init_iter = true;
   int64_t retry_count = 0;
+  int64_t filtered_log_count = 0;
   const bool fetch_archive_only = ObCdcRpcTestFlag::is_fetch_archive_only(fetch_flag);
   // test switch fetch mode requires that the fetch mode should be FETCHMODE_ARCHIVE at first, and then
   // switch to FETCHMODE_ONLINE when processing next rpc
@@ -486,7 +489,7 @@ int ObCdcFetcher::ls_fetch_log_(const ObLSID &ls_id,
     int64_t start_fetch_ts = ObTimeUtility::current_time();
     bool fetch_log_succ = false;
     const int64_t MAX_RETRY_COUNT = 3;
-    if (is_time_up_(fetched_log_count, end_tstamp)) { // time up, stop fetching logs globally
+    if (is_time_up_(fetched_log_count + filtered_log_count, end_tstamp)) { // time up, stop fetching logs globally
       frt.stop("TimeUP");
       LOG_INFO("fetch log quit in time", K(end_tstamp), K(frt), K(fetched_log_count));
     } // time up
@@ -570,9 +573,23 @@ int ObCdcFetcher::ls_fetch_log_(const ObLSID &ls_id,
     // update the resp/frt/ctx when the logentry is successfully fetched
     if (OB_SUCC(ret) && fetch_log_succ) {
       resp.inc_log_fetch_time(ObTimeUtility::current_time() - start_fetch_ts);
-      check_next_group_entry_(lsn, log_group_entry, fetched_log_count, resp, frt, reach_upper_limit, ctx);
-      resp.set_progress(ctx.get_progress());
-      if (frt.is_stopped()) {
+      if (is_group_entry_filtered_(log_group_entry, log_type_filter)) {
+        ctx.set_progress(log_group_entry.get_scn().get_val_for_logservice());
+        resp.set_progress(ctx.get_progress());
+        if (OB_FAIL(filter_resp_with_group_entry_(ls_id, lsn, log_group_entry, resp))) {
+          if (OB_SIZE_OVERFLOW == ret) {
+            frt.stop("TooManyFilteredLog");
+            ret = OB_SUCCESS;
+          } else {
+            LOG_WARN("filter_resp_with_group_entry fail", KR(ret), K(frt), K(resp));
+          }
+        } else {
+          filtered_log_count++;
+        }
+      } else if (FALSE_IT(check_next_group_entry_(lsn, log_group_entry, fetched_log_count, resp,
+              frt, reach_upper_limit, ctx))) {
+      } else if (FALSE_IT(resp.set_progress(ctx.get_progress()))) {
+      } else if (frt.is_stopped()) {
         // Stop fetching log
       } else if (OB_FAIL(prefill_resp_with_group_entry_(ls_id, lsn, log_group_entry, resp))) {
         if (OB_BUF_NOT_ENOUGH == ret) {
@@ -608,7 +625,7 @@ int ObCdcFetcher::ls_fetch_log_(const ObLSID &ls_id,
     // other error code
   }
 
-  LOG_TRACE("LS fetch log done", KR(ret), K(fetched_log_count), K(frt), K(resp));
+  LOG_TRACE("LS fetch log done", KR(ret), K(fetched_log_count), K(filtered_log_count), K(frt), K(resp));
 
   return ret;
 }
@@ -685,6 +702,52 @@ int ObCdcFetcher::prefill_resp_with_group_entry_(const ObLSID &ls_id,
   return ret;
 }
 
+bool ObCdcFetcher::is_group_entry_filtered_(const LogGroupEntry &log_group_entry,
+    const int64_t log_type_filter) const
+{
+  int ret = OB_SUCCESS;
+  bool bool_ret = (0 != log_type_filter) && ! log_group_entry.get_header().is_padding_log();
+  const char *buf = log_group_entry.get_data_buf();
+  const int64_t data_len = log_group_entry.get_data_len();
+  int64_t pos = 0;
+
+  while (OB_SUCC(ret) && bool_ret && pos < data_len) {
+    LogEntry log_entry;
+    logservice::ObLogBaseHeader base_header;
+    int64_t header_pos = 0;
+    if (OB_FAIL(log_entry.deserialize(buf, data_len, pos))) {
+      LOG_WARN("LogEntry deserialize fail", KR(ret), K(data_len), K(pos), K(log_group_entry));
+    } else if (OB_FAIL(base_header.deserialize(log_entry.get_data_buf(), log_entry.get_data_len(),
+            header_pos))) {
+      LOG_WARN("ObLogBaseHeader deserialize fail", KR(ret), K(log_entry));
+    } else if (0 != (log_type_filter & (1LL << base_header.get_log_type()))) {
+      bool_ret = false;
+    }
+  }
+
+  return OB_SUCC(ret) && bool_ret;
+}
+
+int ObCdcFetcher::filter_resp_with_group_entry_(const ObLSID &ls_id,
+    const LSN &lsn,
+    const LogGroupEntry &log_group_entry,
+    obrpc::ObCdcLSFetchLogResp &resp)
+{
+  int ret = OB_SUCCESS;
+  const int64_t entry_size = log_group_entry.get_serialize_size();
+
+  if (OB_FAIL(resp.log_entry_filtered(entry_size))) {
+    if (OB_SIZE_OVERFLOW != ret) {
+      LOG_WARN("resp log_entry_filtered fail", KR(ret), K(ls_id), K(lsn), K(entry_size));
+    }
+  } else {
+    // the client skips the filtered logs and continues fetching from the next LogGroupEntry
+    resp.set_next_req_lsn(lsn + entry_size);
+  }
+
+  return ret;
+}
+
 void ObCdcFetcher::handle_when_buffer_full_(FetchRunTime &frt)
 {
   frt.stop("BufferFull");
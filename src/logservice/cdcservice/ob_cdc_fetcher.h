@@ -84,6 +84,7 @@ private:
   int ls_fetch_log_(const ObLSID &ls_id,
       const int64_t end_tstamp,
       const int8_t fetch_flag,
+      const int64_t log_type_filter,
       obrpc::ObCdcLSFetchLogResp &resp,
       FetchRunTime &frt,
       bool &reach_upper_limit,
@@ -155,6 +156,15 @@ private:
       const LSN &lsn,
       LogGroupEntry &log_group_entry,
       obrpc::ObCdcLSFetchLogResp &resp);
+  // Whether all LogEntries in the LogGroupEntry are of the log types which the client doesn't need,
+  // padding log and the LogGroupEntry which fails to parse are never filtered.
+  bool is_group_entry_filtered_(const LogGroupEntry &log_group_entry,
+      const int64_t log_type_filter) const;
+  // Skip the LogGroupEntry instead of filling it into resp_buf.
+  int filter_resp_with_group_entry_(const ObLSID &ls_id,
+      const LSN &lsn,
+      const LogGroupEntry &log_group_entry,
+      obrpc::ObCdcLSFetchLogResp &resp);
   void handle_when_buffer_full_(FetchRunTime &frt);
   // lsn of ls_id wantted does not exist on this server, feed this information back to CDC Connector,
   // CDC Connector needs to change search server.
@@ -249,7 +249,9 @@ OB_DEF_DESERIALIZE(ObCdcReqStartLSNByTsResp)
  *
  */
 OB_SERIALIZE_MEMBER(ObCdcLSFetchLogReq, rpc_ver_, ls_id_, start_lsn_,
-                    upper_limit_ts_, client_pid_, client_id_, progress_, flag_);
+                    upper_limit_ts_, client_pid_, client_id_, progress_, flag_,
+                    log_type_filter_);
+OB_SERIALIZE_MEMBER(ObCdcLSFetchLogResp::FilteredLog, pos_, log_num_, size_);
 OB_SERIALIZE_MEMBER(ObCdcFetchStatus,
                     is_reach_max_lsn_,
                     is_reach_upper_limit_ts_,
@@ -275,7 +277,7 @@ OB_DEF_SERIALIZE(ObCdcLSFetchLogResp)
       pos += pos_;
     }
   }
-  LST_DO_CODE(OB_UNIS_ENCODE, server_progress_);
+  LST_DO_CODE(OB_UNIS_ENCODE, server_progress_, filtered_logs_);
 
   return ret;
 }
@@ -291,7 +293,7 @@ OB_DEF_SERIALIZE_SIZE(ObCdcLSFetchLogResp)
                 log_num_, pos_);
     len += pos_;
 
-    LST_DO_CODE(OB_UNIS_ADD_LEN, server_progress_);
+    LST_DO_CODE(OB_UNIS_ADD_LEN, server_progress_, filtered_logs_);
   } else {
     tmp_ret = OB_NOT_SUPPORTED;
     EXTLOG_LOG_RET(ERROR, tmp_ret, "get serialize size error, version not match",
@@ -319,7 +321,7 @@ OB_DEF_DESERIALIZE(ObCdcLSFetchLogResp)
       pos += pos_;
     }
 
-    LST_DO_CODE(OB_UNIS_DECODE, server_progress_);
+    LST_DO_CODE(OB_UNIS_DECODE, server_progress_, filtered_logs_);
   } else {
     ret = OB_NOT_SUPPORTED;
     EXTLOG_LOG(ERROR, "deserialize error, version not match",
@@ -339,6 +341,7 @@ void ObCdcLSFetchLogReq::reset()
   client_id_.reset();
   progress_ = OB_INVALID_TIMESTAMP;
   flag_ = 0;
+  log_type_filter_ = 0;
 }
 
 ObCdcLSFetchLogReq& ObCdcLSFetchLogReq::operator=(const ObCdcLSFetchLogReq &other)
@@ -448,6 +451,9 @@ int ObCdcLSFetchLogResp::assign(const ObCdcLSFetchLogResp &other)
     if (log_num_ > 0 && pos_ > 0) {
       (void)MEMCPY(log_entry_buf_, other.log_entry_buf_, pos_);
     }
+    if (OB_FAIL(filtered_logs_.assign(other.filtered_logs_))) {
+      EXTLOG_LOG(WARN, "assign filtered logs failed", K(ret), K(other));
+    }
   }
 
   return ret;
@@ -466,6 +472,65 @@ void ObCdcLSFetchLogResp::reset()
   pos_ = 0;
   log_entry_buf_[0] = '\0';
   server_progress_ = OB_INVALID_TIMESTAMP;
+  filtered_logs_.reset();
+}
+
+int ObCdcLSFetchLogResp::log_entry_filtered(const int64_t filtered_size)
+{
+  int ret = OB_SUCCESS;
+  const int64_t cnt = filtered_logs_.count();
+
+  if (OB_UNLIKELY(filtered_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    EXTLOG_LOG(WARN, "invalid filtered size", K(ret), K(filtered_size));
+  } else if (cnt > 0 && filtered_logs_.at(cnt - 1).log_num_ == log_num_) {
+    // continuous with the last hole
+    filtered_logs_.at(cnt - 1).size_ += filtered_size;
+  } else if (cnt >= MAX_FILTERED_LOG_CNT) {
+    ret = OB_SIZE_OVERFLOW;
+  } else {
+    FilteredLog filtered_log;
+    filtered_log.pos_ = pos_;
+    filtered_log.log_num_ = log_num_;
+    filtered_log.size_ = filtered_size;
+    if (OB_FAIL(filtered_logs_.push_back(filtered_log))) {
+      EXTLOG_LOG(WARN, "push back filtered log failed", K(ret), K(filtered_log));
+    }
+  }
+
+  return ret;
+}
+
+int ObCdcLSFetchLogResp::get_log_segment(const int64_t seg_idx,
+    int64_t &start_pos,
+    int64_t &end_pos,
+    int64_t &log_cnt,
+    int64_t &filtered_size) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t cnt = filtered_logs_.count();
+
+  if (OB_UNLIKELY(seg_idx < 0 || seg_idx > cnt)) {
+    ret = OB_INVALID_ARGUMENT;
+    EXTLOG_LOG(WARN, "invalid segment idx", K(ret), K(seg_idx), K(cnt));
+  } else {
+    const int64_t start_log_num = (0 == seg_idx) ? 0 : filtered_logs_.at(seg_idx - 1).log_num_;
+    const int64_t end_log_num = (cnt == seg_idx) ? log_num_ : filtered_logs_.at(seg_idx).log_num_;
+    start_pos = (0 == seg_idx) ? 0 : filtered_logs_.at(seg_idx - 1).pos_;
+    end_pos = (cnt == seg_idx) ? pos_ : filtered_logs_.at(seg_idx).pos_;
+    filtered_size = (cnt == seg_idx) ? 0 : filtered_logs_.at(seg_idx).size_;
+    log_cnt = end_log_num - start_log_num;
+
+    if (OB_UNLIKELY(start_pos < 0 || end_pos < start_pos || end_pos > pos_
+        || log_cnt < 0 || end_log_num > log_num_ || filtered_size < 0
+        || (cnt != seg_idx && 0 == filtered_size))) {
+      ret = OB_INVALID_DATA;
+      EXTLOG_LOG(WARN, "invalid filtered log", K(ret), K(seg_idx), K(start_pos), K(end_pos),
+          K(log_cnt), K(filtered_size), KPC(this));
+    }
+  }
+
+  return ret;
 }
 
 /*
@@ -236,6 +236,9 @@ public:
   void set_flag(int8_t flag) { flag_ |= flag; }
   int8_t get_flag() const { return flag_; }
 
+  void set_log_type_filter(const int64_t log_type_filter) { log_type_filter_ = log_type_filter; }
+  int64_t get_log_type_filter() const { return log_type_filter_; }
+
   TO_STRING_KV(K_(rpc_ver),
       K_(ls_id),
       K_(start_lsn),
@@ -243,7 +246,8 @@ public:
       K_(client_pid),
       K_(client_id),
       K_(progress),
-      K_(flag));
+      K_(flag),
+      K_(log_type_filter));
 
   OB_UNIS_VERSION(1);
 
@@ -262,6 +266,10 @@ private:
   // server B can hardly locate log in archive.
   int64_t progress_;
   int8_t flag_;
+  // the log types which the client needs, bit (1 << ObLogBaseType) is set for each type, 0 means all.
+  // server skips the LogGroupEntry which doesn't contain any log the client needs, instead of
+  // shipping it, see ObCdcLSFetchLogResp::FilteredLog.
+  int64_t log_type_filter_;
 };
 
 // Statistics for LS
@@ -327,6 +335,22 @@ public:
     LOG_NOT_IN_THIS_SERVER = 1,  // this server does not server this log
     LS_OFFLINED = 2,             // LS offlined
   };
+  // Continuous LogGroupEntries skipped by the log type filter of request.
+  // Logs in log_entry_buf_ are continuous except these holes, the client needs to skip 'size_'
+  // bytes of LSN after the first 'log_num_' LogGroupEntries (ending at 'pos_') are consumed.
+  struct FilteredLog
+  {
+    int64_t pos_;
+    int64_t log_num_;
+    int64_t size_;
+
+    FilteredLog() : pos_(0), log_num_(0), size_(0) {}
+    TO_STRING_KV(K_(pos), K_(log_num), K_(size));
+    OB_UNIS_VERSION(1);
+  };
+  typedef common::ObSEArray<FilteredLog, 4> FilteredLogArray;
+  // stop filling the response if there are too many holes
+  static const int64_t MAX_FILTERED_LOG_CNT = 128;
 public:
   ObCdcLSFetchLogResp() { reset(); }
   ~ObCdcLSFetchLogResp() { reset(); }
@@ -401,6 +425,20 @@ public:
     pos_ += want_size;
     log_num_++;
   }
+  // @retval OB_SIZE_OVERFLOW too many holes in this response
+  int log_entry_filtered(const int64_t filtered_size);
+  const FilteredLogArray &get_filtered_logs() const { return filtered_logs_; }
+  bool has_filtered_log() const { return filtered_logs_.count() > 0; }
+  // Holes split logs into filtered_logs_.count() + 1 segments, the seg_idx-th segment holds
+  // log_cnt LogGroupEntries in [start_pos, end_pos) of log_entry_buf_, and is followed by
+  // filtered_size bytes of LSN skipped by server, filtered_size is 0 for the last segment.
+  // @retval OB_INVALID_DATA holes are not in order of logs
+  int64_t get_log_segment_count() const { return filtered_logs_.count() + 1; }
+  int get_log_segment(const int64_t seg_idx,
+      int64_t &start_pos,
+      int64_t &end_pos,
+      int64_t &log_cnt,
+      int64_t &filtered_size) const;
   bool is_valid() const
   {
     return pos_ >= 0 && pos_ <= FETCH_BUF_LEN;
@@ -415,7 +453,8 @@ public:
       K_(fetch_status),
       K_(next_req_lsn),
       K_(log_num),
-      K_(pos));
+      K_(pos),
+      K_(filtered_logs));
   OB_UNIS_VERSION(1);
 
 private:
@@ -433,6 +472,7 @@ private:
   int64_t pos_;
   char log_entry_buf_[FETCH_BUF_LEN];
   int64_t server_progress_;
+  FilteredLogArray filtered_logs_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObCdcLSFetchLogResp);
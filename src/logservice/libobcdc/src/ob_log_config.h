@@ -366,6 +366,8 @@ public:
   // Maximum number of RPC results per RPC
   T_DEF_INT_INFT(rpc_result_count_per_rpc_upper_limit, OB_CLUSTER_PARAMETER, 16, 1,
       "max rpc result count per rpc");
+  // Whether to let server skip the logs which are not handled by libobcdc, e.g. direct load logs
+  T_DEF_BOOL(enable_fetch_log_filter, OB_CLUSTER_PARAMETER, 1, "0:disabled, 1:enabled");
 
   // Whether to print RPC processing information
   // Print every RPC processing
@@ -245,15 +245,20 @@ int64_t FetchLogARpc::g_rpc_result_count_per_rpc_upper_limit =
 
 bool FetchLogARpc::g_print_rpc_handle_info = ObLogConfig::default_print_rpc_handle_info;
 
+bool FetchLogARpc::g_enable_fetch_log_filter = ObLogConfig::default_enable_fetch_log_filter;
+
 void FetchLogARpc::configure(const ObLogConfig &config)
 {
   int64_t rpc_result_count_per_rpc_upper_limit = config.rpc_result_count_per_rpc_upper_limit;
   bool print_rpc_handle_info = config.print_rpc_handle_info;
+  bool enable_fetch_log_filter = config.enable_fetch_log_filter;
 
   ATOMIC_STORE(&g_rpc_result_count_per_rpc_upper_limit, rpc_result_count_per_rpc_upper_limit);
   LOG_INFO("[CONFIG]", K(rpc_result_count_per_rpc_upper_limit));
   ATOMIC_STORE(&g_print_rpc_handle_info, print_rpc_handle_info);
   LOG_INFO("[CONFIG]", K(print_rpc_handle_info));
+  ATOMIC_STORE(&g_enable_fetch_log_filter, enable_fetch_log_filter);
+  LOG_INFO("[CONFIG]", K(enable_fetch_log_filter));
 }
 
 const char *FetchLogARpc::print_rpc_stop_reason(const RpcStopReason reason)
@@ -1055,8 +1060,8 @@ int FetchLogARpc::analyze_result_(RpcRequest &rpc_req,
     bool is_reach_upper_limit_ts = fetch_status.is_reach_upper_limit_ts_;
     // The LS reach maximum log
     bool is_reach_max_lsn = fetch_status.is_reach_max_lsn_;
-    // The LS fetch none log
-    bool fetch_no_log = (resp->get_log_num() <= 0);
+    // The LS fetch none log, the logs filtered by server are also regarded as fetched
+    bool fetch_no_log = (resp->get_log_num() <= 0 && ! resp->has_filtered_log());
 
     // If the LS have reached the maximum log, there is no need to continue fetching logs
     if (is_reach_max_lsn) {
@@ -1217,6 +1222,8 @@ int FetchLogARpc::RpcRequest::prepare(
     //
     // Set request parameter: upper limit
     req_.set_upper_limit_ts(upper_limit);
+    // Push the log types which libobcdc handles down to server, so that the irrelevant logs are not shipped
+    req_.set_log_type_filter(ATOMIC_LOAD(&g_enable_fetch_log_filter) ? LSFetchCtx::FETCH_LOG_TYPE_FILTER : 0);
 
     // Update the next round of RPC trace id
     trace_id_.init(get_self_addr());
@@ -147,6 +147,8 @@ public:
   // The maximum number of results each RPC can have, and stop sending RPCs if this number is exceeded
   static int64_t g_rpc_result_count_per_rpc_upper_limit;
   static bool g_print_rpc_handle_info;
+  // Whether to push the log type filter down to server
+  static bool g_enable_fetch_log_filter;
 
   static void configure(const ObLogConfig &config);
 
@@ -227,14 +227,21 @@ int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
     LOG_ERROR("invalid arguments", K(stmt_task));
     ret = OB_INVALID_ARGUMENT;
   } else {
-    // Ensure that all stmt of ObLogEntryTask are pushed to the same queue
-    const uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
+    // Stmts of a small ObLogEntryTask are pushed to the same queue, stmts of a large one are
+    // spread over all formatter threads in batches of PARALLEL_FORMAT_STMT_BATCH.
+    // It's safe to format stmts of one ObLogEntryTask concurrently: the last formatted stmt is
+    // counted atomically, and then rows are linked in the order of stmts.
+    uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
     int64_t stmt_count = 0;
 
     while (OB_SUCC(ret) && NULL != stmt_task) {
       IStmtTask *next = stmt_task->get_next();
       void *push_task = static_cast<void *>(stmt_task);
 
+      if (stmt_count > 0 && 0 == (stmt_count % PARALLEL_FORMAT_STMT_BATCH)) {
+        hash_value = ATOMIC_FAA(&round_value_, 1);
+      }
+
       RETRY_FUNC(stop_flag, *(static_cast<ObMQThread *>(this)), push, push_task, hash_value, DATA_OP_TIMEOUT);
 
       if (OB_SUCC(ret)) {
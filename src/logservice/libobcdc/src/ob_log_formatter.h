@@ -146,6 +146,8 @@ private:
   typedef share::schema::ObSimpleTableSchemaV2 TableSchemaType;
   static const int64_t DATA_OP_TIMEOUT = 1 * 1000 * 1000;
   static const int64_t PRINT_LOG_INTERVAL = 10 * 1000 * 1000;
+  // stmt count of a ObLogEntryTask formatted by one thread before switching to the next one
+  static const int64_t PARALLEL_FORMAT_STMT_BATCH = 256;
 
   int handle_dml_stmt_(
       DmlStmtTask &dml_stmt_task,
@@ -541,6 +541,30 @@ int LSFetchCtx::update_progress(
   return ret;
 }
 
+int LSFetchCtx::skip_filtered_log(const int64_t filtered_size)
+{
+  int ret = OB_SUCCESS;
+  const palf::LSN next_lsn = progress_.get_next_lsn() + filtered_size;
+
+  if (OB_UNLIKELY(filtered_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("invalid filtered size", KR(ret), K_(tls_id), K(filtered_size));
+  } else if (OB_FAIL(progress_.update_log_progress(next_lsn, filtered_size, OB_INVALID_TIMESTAMP))) {
+    LOG_ERROR("update log progress fail", KR(ret), K(next_lsn), K(filtered_size), K_(progress));
+  } else {
+    // logs in mem_storage_ must be continuous, restart iterating from the next LogGroupEntry
+    group_iterator_.destroy();
+    mem_storage_.destroy();
+    if (OB_FAIL(init_group_iterator_(next_lsn))) {
+      LOG_ERROR("init_group_iterator_ failed", KR(ret), K_(tls_id), K(next_lsn));
+    } else {
+      LOG_DEBUG("skip filtered log succ", K_(tls_id), K(filtered_size), K_(progress));
+    }
+  }
+
+  return ret;
+}
+
 int LSFetchCtx::handle_offline_ls_log_(const palf::LogEntry &log_entry,
     volatile bool &stop_flag)
 {
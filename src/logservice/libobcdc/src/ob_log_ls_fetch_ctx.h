@@ -86,6 +86,13 @@ public:
 public:
   static void configure(const ObLogConfig &config);
 
+  // Log types handled by read_log(), the server skips the LogGroupEntry without any of them
+  static const int64_t FETCH_LOG_TYPE_FILTER =
+      (1LL << logservice::ObLogBaseType::TRANS_SERVICE_LOG_BASE_TYPE)
+      | (1LL << logservice::ObLogBaseType::KEEP_ALIVE_LOG_BASE_TYPE)
+      | (1LL << logservice::ObLogBaseType::GC_LS_LOG_BASE_TYPE)
+      | (1LL << logservice::ObLogBaseType::DATA_DICT_LOG_BASE_TYPE);
+
 public:
   void reset();
   int init(
@@ -158,6 +165,14 @@ public:
       const palf::LogGroupEntry &group_entry,
       const palf::LSN &group_entry_lsn);
 
+  /// Skip the LogGroupEntries filtered by server, which follow the logs have been read
+  ///
+  /// @param [in]  filtered_size   total size of the continuous filtered LogGroupEntries
+  ///
+  /// @retval OB_SUCCESS          success
+  /// @retval Other error codes   Failed
+  int skip_filtered_log(const int64_t filtered_size);
+
   /// Offline LS, clear all unexported tasks and issue OFFLINE type tasks
   ///
   /// @retval OB_SUCCESS          success
@@ -1157,7 +1157,7 @@ int FetchStream::handle_fetch_log_result_(
         is_stream_valid = true;
 
         // When the fetched log is empty, it needs to sleep for a while
-        if (resp.get_log_num() <= 0) {
+        if (resp.get_log_num() <= 0 && ! resp.has_filtered_log()) {
           need_hibernate = true;
         }
 
@@ -1345,7 +1345,6 @@ int FetchStream::read_log_(
 {
   int ret = OB_SUCCESS;
   const char *buf = resp.get_log_entry_buf();
-  const int64_t len = resp.get_pos();
   const int64_t log_cnt = resp.get_log_num();
   int64_t pos = 0;
   int64_t start_read_time = get_timestamp();
@@ -1361,40 +1360,29 @@ int FetchStream::read_log_(
   } else if (OB_ISNULL(ls_fetch_ctx_)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_ERROR("invalid ls_fetch_ctx", KR(ret), K(ls_fetch_ctx_));
-  } else if (0 == log_cnt) {
+  } else if (0 == log_cnt && ! resp.has_filtered_log()) {
     // Ignore 0 logs
     LOG_DEBUG("fetch 0 log", K_(svr), "fetch_status", resp.get_fetch_status());
-  } else if (OB_FAIL(ls_fetch_ctx_->append_log(buf, len))) {
-    LOG_ERROR("append log to LSFetchCtx failed", KR(ret), K_(ls_fetch_ctx), K(resp));
   } else {
-    // Iterate through all log entries
-    for (int64_t idx = 0; OB_SUCC(ret) && (idx < log_cnt); ++idx) {
-      int64_t begin_time = get_timestamp();
-      palf::LSN group_start_lsn;
-      palf::LogGroupEntry group_entry;
-      palf::MemPalfBufferIterator entry_iter;
-
-      if (OB_FAIL(ls_fetch_ctx_->get_next_group_entry(group_entry, group_start_lsn))) {
-        if (OB_ITER_END != ret) {
-          LOG_ERROR("get next_group_entry failed", KR(ret), K_(ls_fetch_ctx), K(resp));
-        } else if (idx < log_cnt - 1) {
-          ret = OB_ERR_UNEXPECTED;
-          LOG_ERROR("group_entry iterate end unexpected", KR(ret), K_(ls_fetch_ctx), K(resp));
-        } else { /* group_entry iter end */ }
-      } else {
-        // GroupLogEntry deserialize time
-        decode_log_entry_time += (get_timestamp() - begin_time);
-        if (OB_FAIL(read_group_entry_(group_entry, group_start_lsn,
-            stop_flag, kick_out_info, tsi))) {
-          LOG_ERROR("read group entry failed", KR(ret));
-        }
-
-        // update log process
-        if (OB_SUCC(ret)) {
-          if (OB_FAIL(ls_fetch_ctx_->update_progress(group_entry, group_start_lsn))) {
-            LOG_ERROR("ls_fetch_ctx_ update_progress failed", KR(ret), K(group_entry), K(group_start_lsn));
-          }
-        }
+    // Logs are continuous except the holes of LogGroupEntries filtered by server,
+    // read them segment by segment and skip each hole.
+    for (int64_t seg_idx = 0; OB_SUCC(ret) && seg_idx < resp.get_log_segment_count(); ++seg_idx) {
+      int64_t seg_start_pos = 0;
+      int64_t seg_end_pos = 0;
+      int64_t seg_log_cnt = 0;
+      int64_t filtered_size = 0;
+
+      if (OB_FAIL(resp.get_log_segment(seg_idx, seg_start_pos, seg_end_pos, seg_log_cnt,
+          filtered_size))) {
+        LOG_ERROR("invalid filtered log in response", KR(ret), K(seg_idx), K(resp));
+      } else if (seg_end_pos > seg_start_pos
+          && OB_FAIL(ls_fetch_ctx_->append_log(buf + seg_start_pos, seg_end_pos - seg_start_pos))) {
+        LOG_ERROR("append log to LSFetchCtx failed", KR(ret), K_(ls_fetch_ctx), K(resp));
+      } else if (OB_FAIL(read_group_entries_(resp, seg_log_cnt, stop_flag,
+          kick_out_info, decode_log_entry_time, tsi))) {
+        // error has been printed when reading each group entry
+      } else if (filtered_size > 0 && OB_FAIL(ls_fetch_ctx_->skip_filtered_log(filtered_size))) {
+        LOG_ERROR("skip filtered log failed", KR(ret), K_(ls_fetch_ctx), K(seg_idx), K(resp));
       }
     }
   }
@@ -1406,6 +1394,50 @@ int FetchStream::read_log_(
   return ret;
 }
 
+int FetchStream::read_group_entries_(
+    const obrpc::ObCdcLSFetchLogResp &resp,
+    const int64_t log_cnt,
+    volatile bool &stop_flag,
+    KickOutInfo &kick_out_info,
+    int64_t &decode_log_entry_time,
+    TransStatInfo &tsi)
+{
+  int ret = OB_SUCCESS;
+
+  // Iterate through all log entries
+  for (int64_t idx = 0; OB_SUCC(ret) && (idx < log_cnt); ++idx) {
+    int64_t begin_time = get_timestamp();
+    palf::LSN group_start_lsn;
+    palf::LogGroupEntry group_entry;
+    palf::MemPalfBufferIterator entry_iter;
+
+    if (OB_FAIL(ls_fetch_ctx_->get_next_group_entry(group_entry, group_start_lsn))) {
+      if (OB_ITER_END != ret) {
+        LOG_ERROR("get next_group_entry failed", KR(ret), K_(ls_fetch_ctx), K(resp));
+      } else if (idx < log_cnt - 1) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_ERROR("group_entry iterate end unexpected", KR(ret), K_(ls_fetch_ctx), K(resp));
+      } else { /* group_entry iter end */ }
+    } else {
+      // GroupLogEntry deserialize time
+      decode_log_entry_time += (get_timestamp() - begin_time);
+      if (OB_FAIL(read_group_entry_(group_entry, group_start_lsn,
+          stop_flag, kick_out_info, tsi))) {
+        LOG_ERROR("read group entry failed", KR(ret));
+      }
+
+      // update log process
+      if (OB_SUCC(ret)) {
+        if (OB_FAIL(ls_fetch_ctx_->update_progress(group_entry, group_start_lsn))) {
+          LOG_ERROR("ls_fetch_ctx_ update_progress failed", KR(ret), K(group_entry), K(group_start_lsn));
+        }
+      }
+    }
+  }
+
+  return ret;
+}
+
 int FetchStream::fetch_miss_log_direct_(
     const ObIArray<ObCdcLSFetchMissLogReq::MissLogParam> &miss_log_array,
     const int64_t timeout,
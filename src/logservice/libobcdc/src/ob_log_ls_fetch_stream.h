@@ -236,6 +236,14 @@ private:
       int64_t &read_log_time,
       int64_t &decode_log_entry_time,
       TransStatInfo &tsi);
+  // read log_cnt LogGroupEntries which have been appended into LSFetchCtx
+  int read_group_entries_(
+      const obrpc::ObCdcLSFetchLogResp &resp,
+      const int64_t log_cnt,
+      volatile bool &stop_flag,
+      KickOutInfo &kick_out_info,
+      int64_t &decode_log_entry_time,
+      TransStatInfo &tsi);
   int fetch_miss_log_direct_(
       const ObIArray<obrpc::ObCdcLSFetchMissLogReq::MissLogParam> &miss_log_array,
       const int64_t timeout,
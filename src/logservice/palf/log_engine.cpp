@@ -90,6 +90,7 @@ int LogEngine::init(const int64_t palf_id,
                     const int64_t log_meta_storage_block_ize)
 {
   int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
   auto log_meta_storage_update_manifest_cb = [](const block_id_t max_block_id) {
     // do nothing
     return OB_SUCCESS;
@@ -133,6 +134,10 @@ int LogEngine::init(const int64_t palf_id,
                                    log_storage_update_manifest_cb,
                                    log_block_pool))) {
     PALF_LOG(ERROR, "LogStorage init failed!!!", K(ret), K(palf_id), K(base_dir), K(log_meta));
+  } else if (0 != log_storage_block_size && OB_SUCCESS != (tmp_ret = log_storage_.enable_hot_cache(alloc_mgr))) {
+    PALF_LOG(WARN, "enable_hot_cache failed, read logs from disk", K(tmp_ret), K(palf_id));
+  }
+  if (OB_FAIL(ret)) {
   } else if (OB_FAIL(log_net_service_.init(palf_id, log_rpc))) {
     PALF_LOG(ERROR, "LogNetService init failed", K(ret), K(palf_id));
   } else if (OB_FAIL(append_log_meta_(log_meta))) {
@@ -184,6 +189,7 @@ int LogEngine::load(const int64_t palf_id,
                     const int64_t log_meta_storage_block_ize)
 {
   int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
   ObTimeGuard guard("load", 0);
   auto log_meta_storage_update_manifest_cb = [&](const block_id_t max_block_id) {
     // do nothing
@@ -235,6 +241,10 @@ int LogEngine::load(const int64_t palf_id,
         K_(palf_id), K_(is_inited));
   } else if (OB_FAIL(integrity_verify_(last_meta_entry_start_lsn, last_group_entry_header_lsn, is_integrity))) {
     PALF_LOG(ERROR, "integrity_verify_ failed, unexpected error", K(ret), KPC(this));
+  } else if (0 != log_storage_block_size && OB_SUCCESS != (tmp_ret = log_storage_.enable_hot_cache(alloc_mgr))) {
+    PALF_LOG(WARN, "enable_hot_cache failed, read logs from disk", K(tmp_ret), K(palf_id));
+  }
+  if (OB_FAIL(ret)) {
   } else if (OB_FAIL(log_net_service_.init(palf_id, log_rpc))) {
     PALF_LOG(ERROR, "LogNetService init failed", K(ret), K(palf_id));
   } else {
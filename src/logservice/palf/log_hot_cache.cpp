@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX PALF
+#include "log_hot_cache.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/time/ob_time_utility.h"
+#include "share/allocator/ob_tenant_mutil_allocator.h"  // ObILogAllocator
+#include "log_writer_utils.h"            // LogWriteBuf
+
+namespace oceanbase
+{
+using namespace common;
+namespace palf
+{
+LogHotCache::LogHotCache()
+  : palf_id_(INVALID_PALF_ID),
+    alloc_mgr_(NULL),
+    data_buf_(NULL),
+    cache_size_(0),
+    start_lsn_(),
+    end_lsn_(),
+    reset_seq_(0),
+    hit_cnt_(0),
+    miss_cnt_(0),
+    hit_size_(0),
+    last_stat_ts_(0),
+    is_inited_(false)
+{
+}
+
+LogHotCache::~LogHotCache()
+{
+  destroy();
+}
+
+int LogHotCache::init(const int64_t palf_id,
+                      const int64_t cache_size,
+                      ObILogAllocator *alloc_mgr)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+  } else if (false == is_valid_palf_id(palf_id) || 0 >= cache_size || OB_ISNULL(alloc_mgr)) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(palf_id), K(cache_size), KP(alloc_mgr));
+  } else if (NULL == (data_buf_ = static_cast<char *>(alloc_mgr->alloc_log_hot_cache_buf(cache_size)))) {
+    // the hot cache budget of the tenant is used up
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    PALF_LOG(WARN, "alloc memory failed", K(ret), K(palf_id), K(cache_size));
+  } else {
+    palf_id_ = palf_id;
+    alloc_mgr_ = alloc_mgr;
+    cache_size_ = cache_size;
+    start_lsn_.reset();
+    end_lsn_.reset();
+    last_stat_ts_ = ObTimeUtility::current_time();
+    is_inited_ = true;
+    PALF_LOG(INFO, "LogHotCache init success", K(ret), KPC(this));
+  }
+  return ret;
+}
+
+void LogHotCache::destroy()
+{
+  is_inited_ = false;
+  if (NULL != data_buf_ && NULL != alloc_mgr_) {
+    alloc_mgr_->free_log_hot_cache_buf(data_buf_, cache_size_);
+  }
+  data_buf_ = NULL;
+  alloc_mgr_ = NULL;
+  palf_id_ = INVALID_PALF_ID;
+  cache_size_ = 0;
+  start_lsn_.reset();
+  end_lsn_.reset();
+  reset_seq_ = 0;
+  hit_cnt_ = 0;
+  miss_cnt_ = 0;
+  hit_size_ = 0;
+  last_stat_ts_ = 0;
+}
+
+void LogHotCache::reset(const LSN &lsn)
+{
+  if (IS_INIT) {
+    ATOMIC_INC(&reset_seq_);
+    MEM_BARRIER();
+    ATOMIC_STORE(&start_lsn_.val_, lsn.val_);
+    ATOMIC_STORE(&end_lsn_.val_, lsn.val_);
+    MEM_BARRIER();
+    ATOMIC_INC(&reset_seq_);
+    PALF_LOG(INFO, "LogHotCache reset", K(lsn), KPC(this));
+  }
+}
+
+void LogHotCache::fill(const LSN &lsn, const LogWriteBuf &write_buf)
+{
+  const int64_t write_size = write_buf.get_total_size();
+  if (IS_NOT_INIT || !lsn.is_valid() || 0 >= write_size) {
+  } else if (write_size > cache_size_ || lsn != end_lsn_ || !start_lsn_.is_valid()) {
+    // only continuous logs are cached, restart from the next write
+    reset(lsn + write_size);
+  } else {
+    const LSN new_end_lsn = lsn + write_size;
+    const LSN new_start_lsn = (new_end_lsn - start_lsn_ > cache_size_) ? new_end_lsn - cache_size_ : start_lsn_;
+    // readers must know that the oldest logs will be overwritten before copying
+    ATOMIC_STORE(&start_lsn_.val_, new_start_lsn.val_);
+    MEM_BARRIER();
+    int64_t pos = lsn.val_ % cache_size_;
+    for (int64_t i = 0; i < write_buf.get_buf_count(); i++) {
+      const char *buf = NULL;
+      int64_t buf_len = 0;
+      if (OB_SUCCESS != write_buf.get_write_buf(i, buf, buf_len)) {
+        PALF_LOG_RET(WARN, OB_ERR_UNEXPECTED, "get_write_buf failed", K(i), K(write_buf));
+      } else {
+        copy_to_ring_(pos, buf, buf_len);
+        pos = (pos + buf_len) % cache_size_;
+      }
+    }
+    MEM_BARRIER();
+    ATOMIC_STORE(&end_lsn_.val_, new_end_lsn.val_);
+  }
+}
+
+int LogHotCache::read(const LSN &lsn, const int64_t read_size, char *buf) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (!lsn.is_valid() || 0 >= read_size || NULL == buf) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(lsn), K(read_size), KP(buf));
+  } else {
+    const int64_t reset_seq = ATOMIC_LOAD(&reset_seq_);
+    const LSN end_lsn(ATOMIC_LOAD(&end_lsn_.val_));
+    const LSN start_lsn(ATOMIC_LOAD(&start_lsn_.val_));
+    if (0 != (reset_seq & 1) || !start_lsn.is_valid() || lsn < start_lsn || lsn + read_size > end_lsn) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      copy_from_ring_(lsn.val_ % cache_size_, read_size, buf);
+      MEM_BARRIER();
+      if (lsn < LSN(ATOMIC_LOAD(&start_lsn_.val_)) || reset_seq != ATOMIC_LOAD(&reset_seq_)) {
+        // the logs have been overwritten or reset during copying
+        ret = OB_ENTRY_NOT_EXIST;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ATOMIC_INC(&hit_cnt_);
+      ATOMIC_AAF(&hit_size_, read_size);
+    } else {
+      ATOMIC_INC(&miss_cnt_);
+    }
+    statistics_();
+  }
+  return ret;
+}
+
+void LogHotCache::copy_from_ring_(const int64_t pos, const int64_t size, char *buf) const
+{
+  const int64_t tail_size = MIN(size, cache_size_ - pos);
+  MEMCPY(buf, data_buf_ + pos, tail_size);
+  if (size > tail_size) {
+    MEMCPY(buf + tail_size, data_buf_, size - tail_size);
+  }
+}
+
+void LogHotCache::copy_to_ring_(const int64_t pos, const char *data, const int64_t size)
+{
+  const int64_t tail_size = MIN(size, cache_size_ - pos);
+  MEMCPY(data_buf_ + pos, data, tail_size);
+  if (size > tail_size) {
+    MEMCPY(data_buf_, data + tail_size, size - tail_size);
+  }
+}
+
+void LogHotCache::statistics_() const
+{
+  static const int64_t STAT_INTERVAL = 10 * 1000 * 1000L;
+  const int64_t cur_ts = ObTimeUtility::current_time();
+  const int64_t last_stat_ts = ATOMIC_LOAD(&last_stat_ts_);
+  if (cur_ts - last_stat_ts >= STAT_INTERVAL && ATOMIC_BCAS(&last_stat_ts_, last_stat_ts, cur_ts)) {
+    const int64_t hit_cnt = ATOMIC_SET(&hit_cnt_, 0);
+    const int64_t miss_cnt = ATOMIC_SET(&miss_cnt_, 0);
+    const int64_t hit_size = ATOMIC_SET(&hit_size_, 0);
+    const double hit_ratio = (0 == hit_cnt + miss_cnt) ? 0 : hit_cnt * 1.0 / (hit_cnt + miss_cnt);
+    PALF_LOG(INFO, "[PALF STAT HOT CACHE]", K_(palf_id), K(hit_cnt), K(miss_cnt), K(hit_size),
+             K(hit_ratio), K_(start_lsn), K_(end_lsn));
+  }
+}
+} // end namespace palf
+} // end namespace oceanbase
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_LOG_HOT_CACHE_
+#define OCEANBASE_LOGSERVICE_LOG_HOT_CACHE_
+
+#include "lib/utility/ob_macro_utils.h"
+#include "lib/utility/ob_print_utils.h"
+#include "log_define.h"
+#include "lsn.h"
+
+namespace oceanbase
+{
+namespace common
+{
+class ObILogAllocator;
+}
+namespace palf
+{
+class LogWriteBuf;
+// LogHotCache keeps the most recently written logs of LogStorage in memory, followers fetching
+// logs, archive and cdc which tail the same recent logs are served from it instead of block files.
+//
+// The cache is a ring buffer which holds the continuous logs in [start_lsn_, end_lsn_), it's only
+// filled by the single writer of LogStorage, and readers are lock free:
+// 1. before overwriting the oldest logs, the writer moves start_lsn_ forward firstly, readers
+//    check start_lsn_ again after copying, and retry from disk if the copied logs are overwritten;
+// 2. reset_seq_ is odd when the cache is being reset(truncate/flashback), readers which copied
+//    logs across the reset are treated as miss.
+//
+// Memory of all caches in a tenant is charged to the common budget of ObILogAllocator when allocated,
+// and capped by 5% of the tenant memory, replicas created after the cap is reached read logs from disk only.
+class LogHotCache
+{
+public:
+  LogHotCache();
+  ~LogHotCache();
+  int init(const int64_t palf_id, const int64_t cache_size, common::ObILogAllocator *alloc_mgr);
+  void destroy();
+  // invalidate all cached logs, and the following logs start from 'lsn'
+  void reset(const LSN &lsn);
+  // NB: only called by the writer of LogStorage after logs have been written into block files
+  void fill(const LSN &lsn, const LogWriteBuf &write_buf);
+  // @retval
+  //   OB_SUCCESS, logs in [lsn, lsn + read_size) have been copied into buf
+  //   OB_ENTRY_NOT_EXIST, logs are not in cache, need read from disk
+  int read(const LSN &lsn, const int64_t read_size, char *buf) const;
+  bool is_inited() const { return is_inited_; }
+  TO_STRING_KV(K_(palf_id), K_(cache_size), K_(start_lsn), K_(end_lsn), K_(reset_seq),
+               K_(hit_cnt), K_(miss_cnt), K_(hit_size));
+public:
+  // hot logs of each palf replica, the total size is bounded by the budget of the tenant
+  static constexpr int64_t DEFAULT_CACHE_SIZE = 4 * 1024 * 1024;
+private:
+  void copy_from_ring_(const int64_t pos, const int64_t size, char *buf) const;
+  void copy_to_ring_(const int64_t pos, const char *data, const int64_t size);
+  void statistics_() const;
+private:
+  int64_t palf_id_;
+  common::ObILogAllocator *alloc_mgr_;
+  char *data_buf_;
+  int64_t cache_size_;
+  LSN start_lsn_;
+  LSN end_lsn_;
+  int64_t reset_seq_;
+  mutable int64_t hit_cnt_;
+  mutable int64_t miss_cnt_;
+  mutable int64_t hit_size_;
+  mutable int64_t last_stat_ts_;
+  bool is_inited_;
+private:
+  DISALLOW_COPY_AND_ASSIGN(LogHotCache);
+};
+} // end namespace palf
+} // end namespace oceanbase
+
+#endif // OCEANBASE_LOGSERVICE_LOG_HOT_CACHE_
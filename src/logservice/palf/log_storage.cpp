@@ -102,6 +102,7 @@ void LogStorage::destroy()
   logical_block_size_ = 0;
   block_mgr_.destroy();
   log_reader_.destroy();
+  hot_cache_.destroy();
   log_tail_.reset();
   readable_log_tail_.reset();
   log_block_header_.reset();
@@ -144,6 +145,7 @@ int LogStorage::writev(const LSN &lsn, const LogWriteBuf &write_buf, const SCN &
   } else {
     curr_block_writable_size_ -= write_size;
     update_log_tail_guarded_by_lock_(write_size);
+    hot_cache_.fill(lsn, write_buf);
     PALF_LOG(TRACE, "LogStorage writev success", K(ret), K(log_block_header_), K(lsn),
              K(log_tail_), K(write_buf), KPC(this));
   }
@@ -526,6 +528,22 @@ bool LogStorage::need_switch_block_() const
   return 0ul == curr_block_writable_size_;
 }
 
+int LogStorage::enable_hot_cache(ObILogAllocator *alloc_mgr)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(WARN, "LogStorage not inited", K(ret));
+  } else if (hot_cache_.is_inited()) {
+  } else if (OB_FAIL(hot_cache_.init(palf_id_, LogHotCache::DEFAULT_CACHE_SIZE, alloc_mgr))) {
+    PALF_LOG(WARN, "LogHotCache init failed", K(ret), K_(palf_id));
+  } else {
+    ObSpinLockGuard guard(tail_info_lock_);
+    hot_cache_.reset(log_tail_);
+  }
+  return ret;
+}
+
 int LogStorage::load_last_block_(const block_id_t min_block_id,
                                  const block_id_t max_block_id)
 {
@@ -810,6 +828,12 @@ int LogStorage::inner_pread_(const LSN &read_lsn,
   if (read_lsn >= log_tail) {
     ret = OB_ERR_OUT_OF_UPPER_BOUND;
     PALF_LOG(WARN, "read something out of upper bound", K(ret), K(read_lsn), K(log_tail_));
+  } else if (!(read_offset == 0 && true == need_read_log_block_header)
+             && real_in_read_size <= read_buf.buf_len_
+             && OB_SUCCESS == hot_cache_.read(read_lsn, real_in_read_size, read_buf.buf_)) {
+    out_read_size = real_in_read_size;
+    PALF_LOG(TRACE, "inner_pread from hot cache success", K(ret), K(read_lsn), K(in_read_size),
+             K(out_read_size), K(log_tail));
   } else if (OB_FAIL(log_reader_.pread(read_block_id,
                                        real_read_offset,
                                        real_in_read_size,
@@ -849,6 +873,9 @@ void LogStorage::reset_log_tail_for_last_block_(const LSN &lsn, bool last_block_
   curr_block_writable_size_ = (true == last_block_exist) ? logical_block_size_ - logical_offset : 0;
   need_append_block_header_ = (curr_block_writable_size_ == logical_block_size_) ? true : false;
   log_tail_ = readable_log_tail_ = lsn;
+  // logs after 'lsn' have been truncated or flashbacked, and logs before 'lsn' may have been
+  // recycled, the hot cache restarts from 'lsn'.
+  hot_cache_.reset(lsn);
 }
 } // end namespace palf
 } // end namespace oceanbase
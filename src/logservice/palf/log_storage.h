@@ -17,6 +17,7 @@
 #include "share/ob_errno.h"        // errno
 #include "log_block_header.h"      // LogBlockHeader
 #include "log_block_mgr.h"         // LogBlockMgr
+#include "log_hot_cache.h"         // LogHotCache
 #include "log_reader.h"            // LogReader
 #include "log_storage_interface.h" // ILogStorage
 #include "log_writer_utils.h"      // LogWriteBuf
@@ -108,6 +109,8 @@ public:
   const LSN get_end_lsn() const;
 
   int update_manifest_used_for_meta_storage(const block_id_t expected_max_block_id);
+  // serve the recent logs from memory, only enabled for the storage of log entries.
+  int enable_hot_cache(common::ObILogAllocator *alloc_mgr);
 
   TO_STRING_KV(K_(log_tail),
                K_(readable_log_tail),
@@ -162,6 +165,8 @@ private:
   // Used to perform IO tasks in the background
   LogBlockMgr block_mgr_;
   LogReader log_reader_;
+  // the recent logs which have been written, followers and cdc usually read them.
+  LogHotCache hot_cache_;
   LSN log_tail_;
   // always same as 'log_tail_' except in process of flashback.
   LSN readable_log_tail_;
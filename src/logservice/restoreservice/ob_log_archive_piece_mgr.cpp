@@ -17,6 +17,7 @@
 #include "lib/string/ob_string.h"                 // ObString
 #include "lib/utility/ob_macro_utils.h"
 #include "logservice/archiveservice/ob_archive_define.h"
+#include "logservice/archiveservice/ob_archive_compress_util.h"  // ObArchiveCompressUtil
 #include "logservice/archiveservice/ob_archive_file_utils.h"      // ObArchiveFileUtils
 #include "logservice/archiveservice/ob_archive_util.h"
 #include "logservice/palf/log_define.h"
@@ -1255,6 +1256,9 @@ int ObLogArchivePieceContext::get_max_log_in_file_(const int64_t round_id,
   palf::LSN base_lsn;
   palf::MemoryStorage mem_storage;
   palf::MemPalfGroupBufferIterator iter;
+  char *data = NULL;
+  int64_t data_len = 0;
+  char *decompress_buf = NULL;
   if (OB_ISNULL(buf = (char *)mtl_malloc(buf_size, "ArcFile"))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     CLOG_LOG(WARN, "alloc memory failed", K(ret), K_(id));
@@ -1263,7 +1267,10 @@ int ObLogArchivePieceContext::get_max_log_in_file_(const int64_t round_id,
     CLOG_LOG(WARN, "read part file failed", K(ret), K_(id));
   } else if (OB_FAIL(mem_storage.init(base_lsn))) {
     CLOG_LOG(WARN, "MemoryStorage init failed", K(ret), K(base_lsn), KPC(this));
-  } else if (OB_FAIL(mem_storage.append(buf + header_size, read_size - header_size))) {
+  } else if (OB_FAIL(decompress_file_data_if_needed_(buf + header_size, read_size - header_size,
+          data, data_len, decompress_buf))) {
+    CLOG_LOG(WARN, "decompress file data failed", K(ret), KPC(this));
+  } else if (OB_FAIL(mem_storage.append(data, data_len))) {
     CLOG_LOG(WARN, "MemoryStorage append failed", K(ret));
   } else if (OB_FAIL(iter.init(base_lsn, [](){ return palf::LSN(palf::LOG_MAX_LSN_VAL); }, &mem_storage))) {
     CLOG_LOG(WARN, "iter init failed", K(ret));
@@ -1293,6 +1300,10 @@ int ObLogArchivePieceContext::get_max_log_in_file_(const int64_t round_id,
     mtl_free(buf);
     buf = NULL;
   }
+  if (NULL != decompress_buf) {
+    mtl_free(decompress_buf);
+    decompress_buf = NULL;
+  }
   return ret;
 }
 
@@ -1351,6 +1362,9 @@ int ObLogArchivePieceContext::seek_in_file_(const int64_t file_id, const SCN &sc
   palf::LSN base_lsn;
   palf::MemoryStorage mem_storage;
   palf::MemPalfGroupBufferIterator iter;
+  char *data = NULL;
+  int64_t data_len = 0;
+  char *decompress_buf = NULL;
   if (OB_ISNULL(buf = (char *)mtl_malloc(buf_size, "ArcFile"))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     CLOG_LOG(WARN, "alloc memory failed", K(ret));
@@ -1359,7 +1373,10 @@ int ObLogArchivePieceContext::seek_in_file_(const int64_t file_id, const SCN &sc
     CLOG_LOG(WARN, "read part file failed", K(ret), K(file_id), KPC(this));
   } else if (OB_FAIL(mem_storage.init(base_lsn))) {
     CLOG_LOG(WARN, "MemoryStorage init failed", K(ret), K_(id), K(base_lsn), KPC(this));
-  } else if (OB_FAIL(mem_storage.append(buf + header_size, read_size - header_size))) {
+  } else if (OB_FAIL(decompress_file_data_if_needed_(buf + header_size, read_size - header_size,
+          data, data_len, decompress_buf))) {
+    CLOG_LOG(WARN, "decompress file data failed", K(ret), KPC(this));
+  } else if (OB_FAIL(mem_storage.append(data, data_len))) {
     CLOG_LOG(WARN, "MemoryStorage append failed", K(ret));
   } else if (OB_FAIL(iter.init(base_lsn, [](){ return palf::LSN(palf::LOG_MAX_LSN_VAL); }, &mem_storage))) {
     CLOG_LOG(WARN, "iter init failed", K(ret));
@@ -1400,6 +1417,10 @@ int ObLogArchivePieceContext::seek_in_file_(const int64_t file_id, const SCN &sc
     mtl_free(buf);
     buf = NULL;
   }
+  if (NULL != decompress_buf) {
+    mtl_free(decompress_buf);
+    decompress_buf = NULL;
+  }
   return ret;
 }
 
@@ -1435,6 +1456,41 @@ int ObLogArchivePieceContext::read_part_file_(const int64_t round_id,
   return ret;
 }
 
+int ObLogArchivePieceContext::decompress_file_data_if_needed_(char *data,
+    const int64_t data_len,
+    char *&buf,
+    int64_t &buf_size,
+    char *&decompress_buf)
+{
+  int ret = OB_SUCCESS;
+  bool compressed = false;
+  int64_t origin_size = 0;
+  int64_t consumed_size = 0;
+  int64_t pos = 0;
+  if (OB_FAIL(archive::ObArchiveCompressUtil::scan(data, data_len, compressed, origin_size, consumed_size))) {
+    CLOG_LOG(WARN, "scan archive data failed", K(ret), K(data_len));
+  } else if (! compressed
+      && consumed_size < data_len
+      && archive::ObArchiveBlockMeta::is_block_meta(data + consumed_size, data_len - consumed_size)) {
+    // 未压缩的LogGroupEntry之后为不完整的压缩块, 仅返回之前完整的日志
+    buf = data;
+    buf_size = consumed_size;
+  } else if (! compressed) {
+    buf = data;
+    buf_size = data_len;
+  } else if (OB_ISNULL(decompress_buf = (char *)mtl_malloc(origin_size, "ArcDecompress"))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    CLOG_LOG(WARN, "alloc memory failed", K(ret), K(origin_size));
+  } else if (OB_FAIL(archive::ObArchiveCompressUtil::decompress(data, consumed_size,
+          decompress_buf, origin_size, pos))) {
+    CLOG_LOG(WARN, "decompress archive data failed", K(ret), K(consumed_size));
+  } else {
+    buf = decompress_buf;
+    buf_size = pos;
+  }
+  return ret;
+}
+
 int ObLogArchivePieceContext::get_ls_meta_data_(
     const share::ObArchiveLSMetaType &meta_type,
     const SCN &timestamp,
@@ -310,6 +310,12 @@ private:
       const int64_t buf_size,
       int64_t &read_size,
       palf::LSN &base_lsn);
+  // 归档文件数据包含压缩块时解压到新分配的decompress_buf中, 由调用者释放
+  int decompress_file_data_if_needed_(char *data,
+      const int64_t data_len,
+      char *&buf,
+      int64_t &buf_size,
+      char *&decompress_buf);
 
   int get_ls_meta_data_(const share::ObArchiveLSMetaType &meta_type,
       const share::SCN &timestamp,
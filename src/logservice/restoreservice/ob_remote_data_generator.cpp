@@ -20,8 +20,10 @@
 #include "logservice/archiveservice/ob_archive_file_utils.h"     // ObArchiveFileUtils
 #include "share/backup/ob_archive_path.h"           // ObArchivePathUtil
 #include "logservice/archiveservice/ob_archive_define.h"         // ObArchiveFileHeader
+#include "logservice/archiveservice/ob_archive_compress_util.h"  // ObArchiveCompressUtil
 #include "logservice/archiveservice/ob_archive_util.h"       // ObArchiveFileUtils
 #include "share/backup/ob_backup_path.h"                // ObBackupPath
+#include "share/rc/ob_tenant_base.h"                     // mtl_malloc
 #include "ob_log_restore_rpc.h"                           // proxy
 #include "share/backup/ob_backup_struct.h"
 #include "share/backup/ob_archive_path.h"           // ObArchivePathUtil
@@ -45,7 +47,9 @@ RemoteDataGenerator::RemoteDataGenerator(const uint64_t tenant_id,
   next_fetch_lsn_(start_lsn),
   end_scn_(end_scn),
   end_lsn_(end_lsn),
-  to_end_(false)
+  to_end_(false),
+  decompress_buf_(NULL),
+  decompress_buf_size_(0)
 {}
 
 RemoteDataGenerator::~RemoteDataGenerator()
@@ -55,6 +59,11 @@ RemoteDataGenerator::~RemoteDataGenerator()
   start_lsn_.reset();
   next_fetch_lsn_.reset();
   end_lsn_.reset();
+  if (NULL != decompress_buf_) {
+    mtl_free(decompress_buf_);
+    decompress_buf_ = NULL;
+    decompress_buf_size_ = 0;
+  }
 }
 
 bool RemoteDataGenerator::is_valid() const
@@ -84,21 +93,69 @@ int RemoteDataGenerator::update_max_lsn_(const palf::LSN &lsn)
   }
   return ret;
 }
-// only handle orignal buffer without compression or encryption
-// only to check incomplete LogGroupEntry
-// compression and encryption will be supported in the future
+// encryption will be supported in the future
 //
 // 仅支持备份情况下, 不需要处理归档写入不原子情况
 int RemoteDataGenerator::process_origin_data_(char *origin_buf,
     const int64_t origin_buf_size,
-    char *buf,
-    int64_t &buf_size)
+    char *&buf,
+    int64_t &buf_size,
+    int64_t &consumed_size)
+{
+  int ret = OB_SUCCESS;
+  bool compressed = false;
+  int64_t origin_size = 0;
+  int64_t pos = 0;
+  if (OB_FAIL(ObArchiveCompressUtil::scan(origin_buf, origin_buf_size,
+          compressed, origin_size, consumed_size))) {
+    LOG_WARN("scan archive data failed", K(ret), K(origin_buf_size), KPC(this));
+  } else if (! compressed
+      && consumed_size < origin_buf_size
+      && ObArchiveBlockMeta::is_block_meta(origin_buf + consumed_size, origin_buf_size - consumed_size)) {
+    // 未压缩的LogGroupEntry之后为不完整的压缩块, 仅返回之前完整的日志, 压缩块下次重读
+    buf = origin_buf;
+    buf_size = consumed_size;
+  } else if (! compressed) {
+    buf = origin_buf;
+    buf_size = origin_buf_size;
+    consumed_size = origin_buf_size;
+  } else if (OB_FAIL(reserve_decompress_buf_(origin_size))) {
+    LOG_WARN("reserve decompress buf failed", K(ret), K(origin_size), KPC(this));
+  } else if (OB_FAIL(ObArchiveCompressUtil::decompress(origin_buf, consumed_size,
+          decompress_buf_, decompress_buf_size_, pos))) {
+    LOG_WARN("decompress archive data failed", K(ret), K(consumed_size), KPC(this));
+  } else {
+    buf = decompress_buf_;
+    buf_size = pos;
+    LOG_TRACE("decompress archive data succ", K(origin_buf_size), K(consumed_size), K(buf_size), KPC(this));
+  }
+
+  if (OB_SUCC(ret) && 0 == buf_size) {
+    // 仅包含不完整的压缩块, 归档数据尚未写完整
+    ret = OB_ITER_END;
+    LOG_TRACE("no complete archive data", K(ret), K(origin_buf_size), KPC(this));
+  }
+  return ret;
+}
+
+int RemoteDataGenerator::reserve_decompress_buf_(const int64_t size)
 {
-  UNUSED(origin_buf);
-  UNUSED(origin_buf_size);
-  UNUSED(buf);
-  UNUSED(buf_size);
-  return OB_NOT_SUPPORTED;
+  int ret = OB_SUCCESS;
+  if (size <= decompress_buf_size_) {
+  } else {
+    if (NULL != decompress_buf_) {
+      mtl_free(decompress_buf_);
+      decompress_buf_ = NULL;
+      decompress_buf_size_ = 0;
+    }
+    if (OB_ISNULL(decompress_buf_ = static_cast<char *>(mtl_malloc(size, "ArcDecompress")))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("alloc memory failed", K(ret), K(size));
+    } else {
+      decompress_buf_size_ = size;
+    }
+  }
+  return ret;
 }
 // ================================ ServiceDataGenerator ============================= //
 ServiceDataGenerator::ServiceDataGenerator(const uint64_t tenant_id,
@@ -328,6 +385,9 @@ int LocationDataGenerator::fetch_log_from_location_(char *&buf, int64_t &buf_siz
   int64_t file_offset = 0;
   palf::LSN max_lsn_in_file (palf::LOG_INVALID_LSN_VAL);
   share::ObBackupPath piece_path;
+  char *origin_buf = NULL;
+  int64_t origin_buf_size = 0;
+  int64_t consumed_size = 0;
   if (OB_FAIL(get_precise_file_and_offset_(file_id, file_offset, max_lsn_in_file, piece_path))) {
     LOG_WARN("get precise file and offset failed", K(ret));
   } else if (OB_FAIL(read_file_(piece_path.get_ptr(), dest_->get_storage_info(), id_,
@@ -336,13 +396,18 @@ int LocationDataGenerator::fetch_log_from_location_(char *&buf, int64_t &buf_siz
   } else if (file_offset > 0) {
     // 非第一次读文件, 不必再解析file header
     base_lsn_ = max_lsn_in_file;
-    buf = buf_;
-    buf_size = data_len_;
+    origin_buf = buf_;
+    origin_buf_size = data_len_;
   } else if (OB_FAIL(extract_archive_file_header_(buf_, data_len_, base_lsn_))) {
     LOG_WARN("extract archive file heaeder failed", K(ret), KPC(this));
   } else {
-    buf = buf_ + ARCHIVE_FILE_HEADER_SIZE;
-    buf_size = data_len_ - ARCHIVE_FILE_HEADER_SIZE;
+    origin_buf = buf_ + ARCHIVE_FILE_HEADER_SIZE;
+    origin_buf_size = data_len_ - ARCHIVE_FILE_HEADER_SIZE;
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(process_origin_data_(origin_buf, origin_buf_size, buf, buf_size, consumed_size))) {
+    LOG_WARN("process origin data failed", K(ret), KPC(this));
   }
 
   if ((OB_SUCC(ret) && base_lsn_ > next_fetch_lsn_) || OB_ERR_OUT_OF_LOWER_BOUND == ret) {
@@ -351,10 +416,10 @@ int LocationDataGenerator::fetch_log_from_location_(char *&buf, int64_t &buf_siz
     ret = OB_ITER_END;
   }
 
-  // 更新读取归档文件信息
+  // 更新读取归档文件信息, 不完整的压缩块下次重读
   if (OB_SUCC(ret)) {
     max_file_id_ = file_id;
-    max_file_offset_ = file_offset + data_len_;
+    max_file_offset_ = file_offset + data_len_ - (origin_buf_size - consumed_size);
   }
   return ret;
 }
@@ -417,6 +482,7 @@ RawPathDataGenerator::~RawPathDataGenerator()
 int RawPathDataGenerator::next_buffer(palf::LSN &lsn, char *&buf, int64_t &buf_size)
 {
   int ret = OB_SUCCESS;
+  int64_t consumed_size = 0;
   if (OB_UNLIKELY(! is_valid())) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("RawPathDataGenerator is invalid", K(ret), KPC(this));
@@ -424,10 +490,11 @@ int RawPathDataGenerator::next_buffer(palf::LSN &lsn, char *&buf, int64_t &buf_s
     ret = OB_ITER_END;
   } else if (OB_FAIL(fetch_log_from_dest_())) {
     LOG_WARN("fetch log from dest failed", K(ret), KPC(this));
+  } else if (OB_FAIL(process_origin_data_(data_ + ARCHIVE_FILE_HEADER_SIZE,
+          data_len_ - ARCHIVE_FILE_HEADER_SIZE, buf, buf_size, consumed_size))) {
+    LOG_WARN("process origin data failed", K(ret), KPC(this));
   } else {
     lsn = base_lsn_;
-    buf = data_ + ARCHIVE_FILE_HEADER_SIZE;
-    buf_size = data_len_ - ARCHIVE_FILE_HEADER_SIZE;
   }
   return ret;
 }
@@ -153,9 +153,15 @@ public:
       K_(end_lsn), K_(to_end));
 
 protected:
-  int process_origin_data_(char *origin_buf, const int64_t origin_buf_size, char *buf, int64_t &buf_size);
+  // 归档数据可能包含压缩块, 解压后返回; 不包含压缩块则直接返回原数据
+  // consumed_size为origin_buf中完整的压缩块和日志大小
+  int process_origin_data_(char *origin_buf, const int64_t origin_buf_size,
+      char *&buf, int64_t &buf_size, int64_t &consumed_size);
   int update_max_lsn_(const palf::LSN &lsn);
 
+private:
+  int reserve_decompress_buf_(const int64_t size);
+
 protected:
   uint64_t tenant_id_;
   ObLSID id_;
@@ -164,6 +170,9 @@ protected:
   share::SCN end_scn_;
   LSN end_lsn_;
   bool to_end_;
+  // 解压缓存, 按需分配
+  char *decompress_buf_;
+  int64_t decompress_buf_size_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(RemoteDataGenerator);
@@ -192,6 +192,9 @@ int ObRemoteFetchLogImpl::check_need_schedule_(ObLS &ls,
     // do nothing
   } else if (context.issue_task_num_ >= concurrency) {
     need_schedule = false;
+  } else if (context.issue_task_num_ > 0 && worker_->is_prefetch_memory_exceeded()) {
+    // prefetch no more archive files if memory is not enough, but one task is always allowed for progress
+    need_schedule = false;
   } else if (OB_FAIL(check_need_delay_(ls.get_ls_id(), need_delay))) {
     LOG_WARN("check need delay failed", K(ret), K(ls));
   } else if (need_delay) {
@@ -200,7 +203,7 @@ int ObRemoteFetchLogImpl::check_need_schedule_(ObLS &ls,
     version = context.issue_version_;
     lsn = context.max_submit_lsn_;
     last_fetch_ts = context.last_fetch_ts_;
-    task_count = concurrency - context.issue_task_num_;
+    task_count = worker_->is_prefetch_memory_exceeded() ? 1 : concurrency - context.issue_task_num_;
   }
   return ret;
 }
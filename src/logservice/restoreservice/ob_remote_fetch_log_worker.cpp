@@ -217,11 +217,16 @@ void ObRemoteFetchWorker::run1()
   }
 }
 
+// The first consume_thread_count threads submit logs of ls sharded by ls_id, while the others prefetch
+// and decompress archive data of fetch log tasks, so logs of different ls are submitted concurrently
+// and not blocked by slow reading of archive files
 void ObRemoteFetchWorker::do_thread_task_()
 {
   int ret = OB_SUCCESS;
   int64_t size = task_queue_.size();
-  if (0 != get_thread_idx() || get_thread_count() <= 1) {
+  const int64_t consume_thread_count = get_consume_thread_count_();
+  const int64_t thread_idx = static_cast<int64_t>(get_thread_idx());
+  if (thread_idx >= consume_thread_count || get_thread_count() <= 1) {
     for (int64_t i = 0; i < size && OB_SUCC(ret) && !has_set_stop(); i++) {
       if (OB_FAIL(handle_single_task_())) {
         LOG_WARN("handle single task failed", K(ret));
@@ -229,14 +234,30 @@ void ObRemoteFetchWorker::do_thread_task_()
     }
   }
 
-  if (0 == get_thread_idx())
+  if (thread_idx < consume_thread_count)
   {
-    if (OB_FAIL(try_consume_data_())) {
+    if (OB_FAIL(try_consume_data_(consume_thread_count))) {
       LOG_WARN("try_consume_data_ failed", K(ret));
     }
   }
 }
 
+int64_t ObRemoteFetchWorker::get_consume_thread_count_() const
+{
+  const int64_t thread_count = get_thread_count();
+  return std::max(1L, thread_count / CONSUME_THREAD_RATIO);
+}
+
+bool ObRemoteFetchWorker::is_prefetch_memory_exceeded() const
+{
+  bool bret = false;
+  if (OB_LIKELY(inited_)) {
+    archive::LargeBufferPool *buffer_pool = allocator_->get_buferr_pool();
+    bret = buffer_pool->get_hold_size() >= buffer_pool->get_total_limit();
+  }
+  return bret;
+}
+
 int ObRemoteFetchWorker::handle_single_task_()
 {
   DEBUG_SYNC(BEFORE_RESTORE_HANDLE_FETCH_LOG_TASK);
@@ -419,18 +440,18 @@ int ObRemoteFetchWorker::push_submit_array_(ObFetchLogTask &task)
   return ret;
 }
 
-int ObRemoteFetchWorker::try_consume_data_()
+int ObRemoteFetchWorker::try_consume_data_(const int64_t consume_thread_count)
 {
   int ret = OB_SUCCESS;
-  if (0 != get_thread_idx()) {
+  if (static_cast<int64_t>(get_thread_idx()) >= consume_thread_count) {
     // do nothing
-  } else if (OB_FAIL(do_consume_data_())) {
+  } else if (OB_FAIL(do_consume_data_(consume_thread_count))) {
     LOG_WARN("do consume data failed", K(ret));
   }
   return ret;
 }
 
-int ObRemoteFetchWorker::do_consume_data_()
+int ObRemoteFetchWorker::do_consume_data_(const int64_t consume_thread_count)
 {
   int ret = OB_SUCCESS;
   ObFetchLogTask *task = NULL;
@@ -454,6 +475,8 @@ int ObRemoteFetchWorker::do_consume_data_()
       } else if (OB_ISNULL(ls)) {
         ret = OB_ERR_UNEXPECTED;
         LOG_ERROR("ls is NULL", K(ret), K(ls));
+      } else if (ls->get_ls_id().id() % consume_thread_count != static_cast<int64_t>(get_thread_idx())) {
+        // consumed by other thread
       } else if (OB_FAIL(foreach_ls_(ls->get_ls_id()))) {
         LOG_WARN("foreach ls failed", K(ret), K(ls));
       }
@@ -49,6 +49,8 @@ using oceanbase::palf::LSN;
 // Remote fetch log worker
 class ObRemoteFetchWorker : public share::ObThreadPool
 {
+  // one of CONSUME_THREAD_RATIO threads submit logs, and the others fetch logs
+  static const int64_t CONSUME_THREAD_RATIO = 3;
 public:
   ObRemoteFetchWorker();
   ~ObRemoteFetchWorker();
@@ -69,6 +71,9 @@ public:
 
   int modify_thread_count(const int64_t count);
 
+  // data of fetch log tasks held in buffer pool reaches its limit, no more tasks should be prefetched
+  bool is_prefetch_memory_exceeded() const;
+
 private:
   void run1();
   void do_thread_task_();
@@ -83,8 +88,9 @@ private:
   void try_update_location_info_(const ObFetchLogTask &task, ObRemoteLogGroupEntryIterator &iter);
 
   int push_submit_array_(ObFetchLogTask &task);
-  int try_consume_data_();
-  int do_consume_data_();
+  int64_t get_consume_thread_count_() const;
+  int try_consume_data_(const int64_t consume_thread_count);
+  int do_consume_data_(const int64_t consume_thread_count);
   int foreach_ls_(const ObLSID &id);
   void inner_free_task_(ObFetchLogTask &task);
 
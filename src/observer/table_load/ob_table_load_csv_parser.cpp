@@ -5,7 +5,11 @@
 #define USING_LOG_PREFIX SERVER
 
 #include "observer/table_load/ob_table_load_csv_parser.h"
+#include "observer/table_load/ob_table_load_coordinator_ctx.h"
+#include "observer/table_load/ob_table_load_service.h"
 #include "observer/table_load/ob_table_load_table_ctx.h"
+#include "observer/table_load/ob_table_load_task.h"
+#include "observer/table_load/ob_table_load_task_scheduler.h"
 #include "observer/table_load/ob_table_load_utils.h"
 #include "sql/engine/cmd/ob_load_data_parser.h"
 #include "sql/resolver/cmd/ob_load_data_stmt.h"
@@ -27,6 +31,8 @@ ObTableLoadCSVParser::ObTableLoadCSVParser()
     str_(nullptr),
     end_(nullptr),
     escape_buf_(nullptr),
+    escape_buf_size_(0),
+    use_simd_scan_(false),
     is_inited_(false)
 {
 }
@@ -49,19 +55,21 @@ int ObTableLoadCSVParser::init(ObTableLoadTableCtx *table_ctx, const ObString &d
     column_count_ = table_ctx->param_.column_count_;
     batch_row_count_ = table_ctx->param_.batch_size_;
     const int64_t total_obj_count = batch_row_count_ * column_count_;
+    // escaped data is never longer than the raw data
+    escape_buf_size_ = MAX(ObLoadFileBuffer::MAX_BUFFER_SIZE, data_buffer.length());
     ObDataInFileStruct file_struct;
     file_struct.field_term_str_ = default_field_term_str;
     if (OB_FAIL(csv_parser_.init(file_struct, column_count_, table_ctx->schema_.collation_type_))) {
       LOG_WARN("fail to init csv general parser", KR(ret));
     } else if (OB_FAIL(store_column_objs_.create(total_obj_count, allocator_))) {
       LOG_WARN("fail to create objs", KR(ret));
-    } else if (OB_ISNULL(escape_buf_ = static_cast<char *>(
-                           allocator_.alloc(ObLoadFileBuffer::MAX_BUFFER_SIZE)))) {
+    } else if (OB_ISNULL(escape_buf_ = static_cast<char *>(allocator_.alloc(escape_buf_size_)))) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
-      LOG_WARN("fail to allocate escape buf memory", KR(ret));
+      LOG_WARN("fail to allocate escape buf memory", KR(ret), K_(escape_buf_size));
     } else {
       str_ = data_buffer.ptr();
       end_ = data_buffer.ptr() + data_buffer.length();
+      use_simd_scan_ = csv_parser_.is_simd_scan_supported();
       is_inited_ = true;
     }
   }
@@ -84,7 +92,7 @@ int ObTableLoadCSVParser::get_next_row(ObNewRow &row)
       return OB_SUCCESS;
     };
     ret = csv_parser_.scan<decltype(handle_one_line), true>(
-      str_, end_, nrows, escape_buf_, escape_buf_ + ObLoadFileBuffer::MAX_BUFFER_SIZE,
+      str_, end_, nrows, escape_buf_, escape_buf_ + escape_buf_size_,
       handle_one_line, err_records, true);
     if (OB_FAIL(ret)) {
       LOG_WARN("fail to csv parser scan", KR(ret));
@@ -95,18 +103,7 @@ int ObTableLoadCSVParser::get_next_row(ObNewRow &row)
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("parser error 0 == nrows", KR(ret));
     } else {
-      const ObIArray<ObCSVGeneralParser::FieldValue> &field_values_in_file =
-        csv_parser_.get_fields_per_line();
-      for (int64_t i = 0; i < row.count_; ++i) {
-        const ObCSVGeneralParser::FieldValue &str_v = field_values_in_file.at(i);
-        ObObj &obj = row.cells_[i];
-        if (str_v.is_null_) {
-          obj.set_null();
-        } else {
-          obj.set_string(ObVarcharType, ObString(str_v.len_, str_v.ptr_));
-          obj.set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
-        }
-      }
+      fill_row_objs(csv_parser_.get_fields_per_line(), row.cells_);
     }
     for (int64_t i = 0; i < err_records.count(); ++i) {
       LOG_WARN("csv parser error records", K(i), K(err_records.at(i).err_code));
@@ -115,12 +112,70 @@ int ObTableLoadCSVParser::get_next_row(ObNewRow &row)
   return ret;
 }
 
+void ObTableLoadCSVParser::fill_row_objs(
+  const ObIArray<ObCSVGeneralParser::FieldValue> &field_values, ObObj *cells) const
+{
+  for (int64_t i = 0; i < column_count_; ++i) {
+    const ObCSVGeneralParser::FieldValue &str_v = field_values.at(i);
+    ObObj &obj = cells[i];
+    if (str_v.is_null_) {
+      obj.set_null();
+    } else {
+      obj.set_string(ObVarcharType, ObString(str_v.len_, str_v.ptr_));
+      obj.set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+    }
+  }
+}
+
+int ObTableLoadCSVParser::get_next_batch_simd(int64_t &row_count)
+{
+  int ret = OB_SUCCESS;
+  row_count = 0;
+  if (str_ == end_) {
+    ret = OB_ITER_END;
+  } else {
+    ObSEArray<ObCSVGeneralParser::LineErrRec, 1> err_records;
+    int64_t nrows = batch_row_count_;
+    ObObj *cells = store_column_objs_.ptr();
+    auto handle_one_line = [&](ObIArray<ObCSVGeneralParser::FieldValue> &fields_per_line) -> int {
+      fill_row_objs(fields_per_line, cells);
+      cells += column_count_;
+      return OB_SUCCESS;
+    };
+    // escape buf is reused by every batch, the objs of last batch are invalid after this
+    if (OB_FAIL(csv_parser_.scan_simd(str_, end_, nrows, escape_buf_,
+                                      escape_buf_ + escape_buf_size_, handle_one_line,
+                                      err_records, true))) {
+      LOG_WARN("fail to csv parser simd scan", KR(ret));
+    } else if (OB_UNLIKELY(!err_records.empty())) {
+      ret = OB_ERR_WRONG_VALUE;
+      LOG_WARN("parser error, have err records", KR(ret), K(err_records.at(0)));
+    } else if (0 == nrows) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("parser error 0 == nrows", KR(ret));
+    } else {
+      row_count = nrows;
+    }
+  }
+  return ret;
+}
+
 int ObTableLoadCSVParser::get_batch_objs(ObTableLoadArray<ObObj> &store_column_objs)
 {
   int ret = OB_SUCCESS;
   if (IS_NOT_INIT) {
     ret = OB_NOT_INIT;
     LOG_WARN("ObTableLoadCSVParser not init", KR(ret), KP(this));
+  } else if (use_simd_scan_) {
+    int64_t row_count = 0;
+    if (OB_FAIL(get_next_batch_simd(row_count))) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("fail to get next batch", KR(ret));
+      }
+    } else if (OB_FAIL(store_column_objs.ref(store_column_objs_.ptr(),
+                                             row_count * column_count_))) {
+      LOG_WARN("fail to ref", KR(ret));
+    }
   } else {
     uint64_t processed_line_count = 0;
     ObNewRow row;
@@ -151,5 +206,256 @@ int ObTableLoadCSVParser::get_batch_objs(ObTableLoadArray<ObObj> &store_column_o
   return ret;
 }
 
+int ObTableLoadCSVParser::get_obj_rows(const ObTableLoadSharedAllocatorHandle &allocator_handle,
+                                       ObTableLoadObjRowArray &obj_rows)
+{
+  int ret = OB_SUCCESS;
+  ObTableLoadArray<ObObj> store_column_objs;
+  while (OB_SUCC(ret)) {
+    if (OB_FAIL(get_batch_objs(store_column_objs))) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("fail to get batch objs", KR(ret));
+      } else {
+        ret = OB_SUCCESS;
+        break;
+      }
+    } else {
+      ObObj *src_objs = store_column_objs.ptr();
+      const int64_t row_count = store_column_objs.count() / column_count_;
+      for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+        ObTableLoadObjRow obj_row;
+        if (OB_FAIL(obj_row.deep_copy_and_assign(src_objs, column_count_, allocator_handle))) {
+          LOG_WARN("failed to deep copy and assign src_objs to obj_row", KR(ret));
+        } else if (OB_FAIL(obj_rows.push_back(obj_row))) {
+          LOG_WARN("failed to add row to obj_rows", KR(ret), K(obj_row));
+        } else {
+          src_objs += column_count_;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+/**
+ * ObTableLoadParallelCSVParser
+ */
+
+class ObTableLoadParallelCSVParser::ParseTaskProcessor : public ObITableLoadTaskProcessor
+{
+public:
+  ParseTaskProcessor(ObTableLoadTask &task, ObTableLoadTableCtx *ctx, Piece *piece)
+    : ObITableLoadTaskProcessor(task), ctx_(ctx), piece_(piece)
+  {
+    ctx_->inc_ref_count();
+  }
+  virtual ~ParseTaskProcessor()
+  {
+    ObTableLoadService::put_ctx(ctx_);
+  }
+  int process() override
+  {
+    int ret = OB_SUCCESS;
+    ObTableLoadSharedAllocatorHandle allocator_handle =
+      ObTableLoadSharedAllocatorHandle::make_handle();
+    ObTableLoadCSVParser csv_parser;
+    if (!allocator_handle) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to make allocator handle", KR(ret));
+    } else if (OB_FAIL(csv_parser.init(ctx_, piece_->data_))) {
+      LOG_WARN("fail to init csv parser", KR(ret));
+    } else {
+      piece_->obj_rows_.set_allocator(allocator_handle);
+      if (OB_FAIL(csv_parser.get_obj_rows(allocator_handle, piece_->obj_rows_))) {
+        LOG_WARN("fail to get obj rows", KR(ret));
+      }
+    }
+    return ret;
+  }
+private:
+  ObTableLoadTableCtx * const ctx_;
+  Piece * const piece_;
+};
+
+class ObTableLoadParallelCSVParser::ParseTaskCallback : public ObITableLoadTaskCallback
+{
+public:
+  ParseTaskCallback(ObTableLoadTableCtx *ctx, ObTableLoadParallelCSVParser *parser, Piece *piece)
+    : ctx_(ctx), parser_(parser), piece_(piece)
+  {
+    ctx_->inc_ref_count();
+  }
+  virtual ~ParseTaskCallback()
+  {
+    ObTableLoadService::put_ctx(ctx_);
+  }
+  void callback(int ret_code, ObTableLoadTask *task) override
+  {
+    // this callback is destructed in free_task
+    ObTableLoadParallelCSVParser *parser = parser_;
+    piece_->ret_ = ret_code;
+    ctx_->free_task(task);
+    parser->finish_task();
+  }
+private:
+  ObTableLoadTableCtx * const ctx_;
+  ObTableLoadParallelCSVParser * const parser_;
+  Piece * const piece_;
+};
+
+ObTableLoadParallelCSVParser::ObTableLoadParallelCSVParser()
+  : table_ctx_(nullptr),
+    allocator_("TLD_ParCSV"),
+    running_task_count_(0),
+    is_inited_(false)
+{
+}
+
+ObTableLoadParallelCSVParser::~ObTableLoadParallelCSVParser()
+{
+  for (int64_t i = 0; i < pieces_.count(); ++i) {
+    Piece *piece = pieces_.at(i);
+    piece->~Piece();
+    allocator_.free(piece);
+  }
+  pieces_.reset();
+}
+
+bool ObTableLoadParallelCSVParser::need_parallel(const ObTableLoadTableCtx *table_ctx,
+                                                 const ObString &data_buffer)
+{
+  return nullptr != table_ctx && nullptr != table_ctx->coordinator_ctx_ &&
+         table_ctx->param_.session_count_ > 1 && data_buffer.length() >= 2 * MIN_PIECE_SIZE;
+}
+
+int ObTableLoadParallelCSVParser::init(ObTableLoadTableCtx *table_ctx,
+                                       const ObString &data_buffer)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("ObTableLoadParallelCSVParser init twice", KR(ret), KP(this));
+  } else if (OB_UNLIKELY(nullptr == table_ctx || nullptr == table_ctx->coordinator_ctx_ ||
+                         data_buffer.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid args", KR(ret), KP(table_ctx), K(data_buffer.length()));
+  } else {
+    ObDataInFileStruct file_struct;
+    file_struct.field_term_str_ = ObTableLoadCSVParser::default_field_term_str;
+    ObCSVGeneralParser csv_parser;
+    ObArray<ObString> datas;
+    const int64_t split_count =
+      MAX(1, MIN(table_ctx->param_.session_count_, data_buffer.length() / MIN_PIECE_SIZE));
+    if (OB_FAIL(cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
+      LOG_WARN("fail to init cond", KR(ret));
+    } else if (OB_FAIL(csv_parser.init(file_struct, table_ctx->param_.column_count_,
+                                       table_ctx->schema_.collation_type_))) {
+      LOG_WARN("fail to init csv general parser", KR(ret));
+    } else if (!csv_parser.is_simd_scan_supported()) {
+      // lines can not be located without a full scan, parse as one piece
+      if (OB_FAIL(datas.push_back(data_buffer))) {
+        LOG_WARN("fail to push back", KR(ret));
+      }
+    } else if (OB_FAIL(csv_parser.split_lines(data_buffer.ptr(),
+                                              data_buffer.ptr() + data_buffer.length(),
+                                              split_count, datas))) {
+      LOG_WARN("fail to split lines", KR(ret), K(split_count));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < datas.count(); ++i) {
+      Piece *piece = nullptr;
+      if (OB_ISNULL(piece = OB_NEWx(Piece, (&allocator_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to new piece", KR(ret));
+      } else if (FALSE_IT(piece->data_ = datas.at(i))) {
+      } else if (OB_FAIL(pieces_.push_back(piece))) {
+        LOG_WARN("fail to push back piece", KR(ret));
+        piece->~Piece();
+        allocator_.free(piece);
+      }
+    }
+    if (OB_SUCC(ret)) {
+      table_ctx_ = table_ctx;
+      is_inited_ = true;
+    }
+  }
+  return ret;
+}
+
+int ObTableLoadParallelCSVParser::add_parse_task(int64_t idx)
+{
+  int ret = OB_SUCCESS;
+  ObTableLoadTask *task = nullptr;
+  ObITableLoadTaskScheduler *task_scheduler = table_ctx_->coordinator_ctx_->task_scheduler_;
+  Piece *piece = pieces_.at(idx);
+  if (OB_FAIL(table_ctx_->alloc_task(task))) {
+    LOG_WARN("fail to alloc task", KR(ret));
+  } else if (OB_FAIL(task->set_processor<ParseTaskProcessor>(table_ctx_, piece))) {
+    LOG_WARN("fail to set parse task processor", KR(ret));
+  } else if (OB_FAIL(task->set_callback<ParseTaskCallback>(table_ctx_, this, piece))) {
+    LOG_WARN("fail to set parse task callback", KR(ret));
+  } else {
+    ObThreadCondGuard guard(cond_);
+    ++running_task_count_;
+  }
+  if (OB_SUCC(ret)) {
+    if (OB_FAIL(task_scheduler->add_task(idx % task_scheduler->get_thread_count(), task))) {
+      LOG_WARN("fail to add task", KR(ret), K(idx), KPC(task));
+      ObThreadCondGuard guard(cond_);
+      --running_task_count_;
+    }
+  }
+  if (OB_FAIL(ret)) {
+    if (nullptr != task) {
+      table_ctx_->free_task(task);
+    }
+  }
+  return ret;
+}
+
+void ObTableLoadParallelCSVParser::finish_task()
+{
+  ObThreadCondGuard guard(cond_);
+  if (0 == --running_task_count_) {
+    cond_.broadcast();
+  }
+}
+
+void ObTableLoadParallelCSVParser::wait_all_tasks()
+{
+  ObThreadCondGuard guard(cond_);
+  while (running_task_count_ > 0) {
+    cond_.wait();
+  }
+}
+
+int ObTableLoadParallelCSVParser::parse(ObTableLoadObjRowArray &obj_rows)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObTableLoadParallelCSVParser not init", KR(ret), KP(this));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < pieces_.count(); ++i) {
+      if (OB_FAIL(add_parse_task(i))) {
+        LOG_WARN("fail to add parse task", KR(ret), K(i));
+      }
+    }
+    // the pieces are referenced by tasks, must wait even if add task failed
+    wait_all_tasks();
+    for (int64_t i = 0; OB_SUCC(ret) && i < pieces_.count(); ++i) {
+      Piece *piece = pieces_.at(i);
+      if (OB_FAIL(piece->ret_)) {
+        LOG_WARN("fail to parse piece", KR(ret), K(i), KPC(piece));
+      }
+      for (int64_t j = 0; OB_SUCC(ret) && j < piece->obj_rows_.count(); ++j) {
+        if (OB_FAIL(obj_rows.push_back(piece->obj_rows_.at(j)))) {
+          LOG_WARN("failed to add row to obj_rows", KR(ret), K(i), K(j));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 } // namespace observer
 } // namespace oceanbase
\ No newline at end of file
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include "lib/lock/ob_thread_cond.h"
 #include "lib/string/ob_string.h"
 #include "observer/table_load/ob_table_load_table_ctx.h"
+#include "share/table/ob_table_load_row_array.h"
 #include "sql/engine/cmd/ob_load_data_impl.h"
 #include "sql/engine/cmd/ob_load_data_parser.h"
 #include "sql/resolver/cmd/ob_load_data_stmt.h"
@@ -23,8 +25,15 @@ public:
   ~ObTableLoadCSVParser();
   int init(ObTableLoadTableCtx *table_ctx, const ObString &data_buffer);
   int get_batch_objs(table::ObTableLoadArray<ObObj> &store_column_objs);
+  // parse all rows and deep copy them to obj_rows with allocator_handle
+  int get_obj_rows(const table::ObTableLoadSharedAllocatorHandle &allocator_handle,
+                   table::ObTableLoadObjRowArray &obj_rows);
+  bool is_simd_scan() const { return use_simd_scan_; }
 private:
   int get_next_row(ObNewRow &row);
+  int get_next_batch_simd(int64_t &row_count);
+  void fill_row_objs(const common::ObIArray<sql::ObCSVGeneralParser::FieldValue> &field_values,
+                     ObObj *cells) const;
 private:
   sql::ObCSVGeneralParser csv_parser_;
   common::ObArenaAllocator allocator_;
@@ -34,8 +43,48 @@ private:
   const char *end_;
   table::ObTableLoadArray<ObObj> store_column_objs_;
   char *escape_buf_;
+  int64_t escape_buf_size_;
+  bool use_simd_scan_;
+  bool is_inited_;
+};
+
+/**
+ * split the payload at line boundaries and parse the pieces concurrently
+ * on the task scheduler of coordinator
+ */
+class ObTableLoadParallelCSVParser
+{
+public:
+  static const int64_t MIN_PIECE_SIZE = 256LL * 1024; // 256K
+  ObTableLoadParallelCSVParser();
+  ~ObTableLoadParallelCSVParser();
+  int init(ObTableLoadTableCtx *table_ctx, const ObString &data_buffer);
+  // rows of all pieces are appended to obj_rows in the order of payload
+  int parse(table::ObTableLoadObjRowArray &obj_rows);
+  int64_t get_piece_count() const { return pieces_.count(); }
+  static bool need_parallel(const ObTableLoadTableCtx *table_ctx, const ObString &data_buffer);
+private:
+  class ParseTaskProcessor;
+  class ParseTaskCallback;
+  struct Piece
+  {
+    Piece() : ret_(common::OB_SUCCESS) {}
+    TO_STRING_KV(K_(data), K_(obj_rows), K_(ret));
+    ObString data_;
+    table::ObTableLoadObjRowArray obj_rows_;
+    int ret_;
+  };
+  int add_parse_task(int64_t idx);
+  void finish_task();
+  void wait_all_tasks();
+private:
+  ObTableLoadTableCtx *table_ctx_;
+  common::ObArenaAllocator allocator_;
+  common::ObArray<Piece *> pieces_;
+  common::ObThreadCond cond_;
+  int64_t running_task_count_;
   bool is_inited_;
 };
 
 } // namespace observer
-} // namespace oceanbase
\ No newline at end of file
+} // namespace oceanbase
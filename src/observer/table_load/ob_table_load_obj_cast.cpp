@@ -16,6 +16,8 @@ namespace observer
 {
 using namespace common;
 using namespace sql;
+using namespace share::schema;
+using namespace blocksstable;
 
 const ObObj ObTableLoadObjCaster::zero_obj(0);
 const ObObj ObTableLoadObjCaster::null_obj(ObObjType::ObNullType);
@@ -237,7 +239,7 @@ int ObTableLoadObjCaster::to_type(const ObObjType &expect_type, ObTableLoadCastO
 {
   int ret = OB_SUCCESS;
   ObCastCtx cast_ctx = *cast_obj_ctx.cast_ctx_;
-  const ObTableLoadTimeConverter time_cvrt = *cast_obj_ctx.time_cvrt_;
+  const ObTableLoadTimeConverter &time_cvrt = *cast_obj_ctx.time_cvrt_;
   if (src.is_null()) {
     dst.set_null();
   } else if (src.get_type() == expect_type && expect_type != ObVarcharType &&
@@ -350,5 +352,314 @@ int ObTableLoadObjCaster::string_datetime_oracle(const ObObjType expect_type,
   return ret;
 }
 
+/**
+ * ObTableLoadColumnCaster
+ */
+
+// only [+-]digits without blank is accepted, 18 digits can not overflow int64
+int ObTableLoadColumnCaster::int_fast_from(const char *str, const int64_t length,
+                                           const ObObjType expect_type, int64_t &value)
+{
+  static const int64_t MAX_DIGIT_COUNT = 18;
+  int ret = OB_SUCCESS;
+  const char *s = str;
+  const char *end = str + length;
+  bool is_neg = false;
+  value = 0;
+  if (s < end && ('+' == *s || '-' == *s)) {
+    is_neg = ('-' == *s);
+    ++s;
+  }
+  if (OB_UNLIKELY(s >= end || end - s > MAX_DIGIT_COUNT)) {
+    ret = OB_EAGAIN;
+  }
+  for (; OB_SUCC(ret) && s < end; ++s) {
+    const uint8_t digit = static_cast<uint8_t>(*s - '0');
+    if (OB_UNLIKELY(digit > 9)) {
+      ret = OB_EAGAIN;
+    } else {
+      value = value * 10 + digit;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    value = is_neg ? -value : value;
+    if (OB_UNLIKELY(value < INT_MIN_VAL[expect_type] || value > INT_MAX_VAL[expect_type])) {
+      // let the generic path decide truncate or error by cast mode
+      ret = OB_EAGAIN;
+    }
+  }
+  return ret;
+}
+
+// days since 1970-01-01 of a valid proleptic gregorian date
+static inline int32_t days_from_civil(int64_t year, int64_t month, int64_t day)
+{
+  year -= (month <= 2);
+  const int64_t era = year / 400;
+  const int64_t yoe = year - era * 400;
+  const int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return static_cast<int32_t>(era * 146097 + doe - 719468);
+}
+
+static inline bool parse_fixed_digits(const char *str, const int64_t count, int64_t &value)
+{
+  bool bret = true;
+  value = 0;
+  for (int64_t i = 0; bret && i < count; ++i) {
+    const uint8_t digit = static_cast<uint8_t>(str[i] - '0');
+    if (digit > 9) {
+      bret = false;
+    } else {
+      value = value * 10 + digit;
+    }
+  }
+  return bret;
+}
+
+// only 'YYYY-MM-DD' with year in [1000, 9999] is accepted
+int ObTableLoadColumnCaster::date_fast_from(const char *str, const int64_t length, int32_t &date)
+{
+  static const int64_t DATE_LEN = 10;
+  static const int64_t DAYS_OF_MONTH[2][13] = {
+    {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
+    {0, 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}};
+  int ret = OB_SUCCESS;
+  int64_t year = 0;
+  int64_t month = 0;
+  int64_t day = 0;
+  if (OB_UNLIKELY(DATE_LEN != length || '-' != str[4] || '-' != str[7])) {
+    ret = OB_EAGAIN;
+  } else if (OB_UNLIKELY(!parse_fixed_digits(str, 4, year) ||
+                         !parse_fixed_digits(str + 5, 2, month) ||
+                         !parse_fixed_digits(str + 8, 2, day))) {
+    ret = OB_EAGAIN;
+  } else if (OB_UNLIKELY(year < 1000 || month < 1 || month > 12 || day < 1)) {
+    ret = OB_EAGAIN;
+  } else {
+    const int64_t is_leap = ((0 == year % 4 && 0 != year % 100) || 0 == year % 400) ? 1 : 0;
+    if (OB_UNLIKELY(day > DAYS_OF_MONTH[is_leap][month])) {
+      ret = OB_EAGAIN;
+    } else {
+      date = days_from_civil(year, month, day);
+    }
+  }
+  return ret;
+}
+
+// only 'YYYY-MM-DD' or 'YYYY-MM-DD HH:MM:SS' is accepted
+int ObTableLoadColumnCaster::datetime_fast_from(const char *str, const int64_t length,
+                                                int64_t &datetime)
+{
+  static const int64_t DATE_LEN = 10;
+  static const int64_t DATETIME_LEN = 19;
+  int ret = OB_SUCCESS;
+  int32_t date = 0;
+  int64_t hour = 0;
+  int64_t minute = 0;
+  int64_t second = 0;
+  if (OB_UNLIKELY(DATE_LEN != length && DATETIME_LEN != length)) {
+    ret = OB_EAGAIN;
+  } else if (OB_FAIL(date_fast_from(str, DATE_LEN, date))) {
+  } else if (DATE_LEN == length) {
+    // only date part
+  } else if (OB_UNLIKELY(' ' != str[10] || ':' != str[13] || ':' != str[16])) {
+    ret = OB_EAGAIN;
+  } else if (OB_UNLIKELY(!parse_fixed_digits(str + 11, 2, hour) ||
+                         !parse_fixed_digits(str + 14, 2, minute) ||
+                         !parse_fixed_digits(str + 17, 2, second))) {
+    ret = OB_EAGAIN;
+  } else if (OB_UNLIKELY(hour > 23 || minute > 59 || second > 59)) {
+    ret = OB_EAGAIN;
+  }
+  if (OB_SUCC(ret)) {
+    datetime = date * USECS_PER_DAY + (hour * 3600 + minute * 60 + second) * USECS_PER_SEC;
+  }
+  return ret;
+}
+
+template <>
+int ObTableLoadColumnCaster::fast_cast_cell<ObTableLoadColumnCaster::GENERIC_KERNEL>(
+  ObTableLoadCastObjCtx &cast_obj_ctx, const ObObjType expect_type, const ObAccuracy &accuracy,
+  const ObObj &src, ObStorageDatum &datum)
+{
+  UNUSEDx(cast_obj_ctx, expect_type, accuracy, src, datum);
+  return OB_EAGAIN;
+}
+
+template <>
+int ObTableLoadColumnCaster::fast_cast_cell<ObTableLoadColumnCaster::INT_KERNEL>(
+  ObTableLoadCastObjCtx &cast_obj_ctx, const ObObjType expect_type, const ObAccuracy &accuracy,
+  const ObObj &src, ObStorageDatum &datum)
+{
+  UNUSED(cast_obj_ctx);
+  UNUSED(accuracy);
+  int ret = OB_EAGAIN;
+  int64_t value = 0;
+  if (ObStringTC == src.get_type_class() && src.get_val_len() > 0) {
+    if (OB_SUCC(int_fast_from(src.get_string_ptr(), src.get_val_len(), expect_type, value))) {
+      datum.reuse();
+      datum.set_int(value);
+    }
+  }
+  return ret;
+}
+
+template <>
+int ObTableLoadColumnCaster::fast_cast_cell<ObTableLoadColumnCaster::NUMBER_KERNEL>(
+  ObTableLoadCastObjCtx &cast_obj_ctx, const ObObjType expect_type, const ObAccuracy &accuracy,
+  const ObObj &src, ObStorageDatum &datum)
+{
+  int ret = OB_EAGAIN;
+  if (ObStringTC == src.get_type_class() && src.get_val_len() > 0) {
+    ObNumberDesc d(0);
+    uint32_t *digits = nullptr;
+    ObObj obj;
+    cast_obj_ctx.number_fast_ctx_.reset();
+    if (OB_FAIL(ObTableLoadObjCaster::number_fast_from(
+          src.get_string_ptr(), src.get_val_len(), cast_obj_ctx.cast_ctx_->allocator_v2_, d,
+          digits, accuracy, cast_obj_ctx.number_fast_ctx_))) {
+      // not a simple number, fallback
+    } else if (FALSE_IT(obj.set_number(expect_type, d, digits))) {
+    } else if (cast_obj_ctx.is_need_check_ &&
+               OB_FAIL(ObTableLoadObjCaster::number_fast_cast_check(
+                 cast_obj_ctx.number_fast_ctx_, obj, accuracy))) {
+      // need round or out of range, fallback
+    } else if (OB_FAIL(datum.from_obj_enhance(obj))) {
+      LOG_WARN("fail to transfer obj to datum", KR(ret), K(obj));
+    }
+  }
+  return ret;
+}
+
+template <>
+int ObTableLoadColumnCaster::fast_cast_cell<ObTableLoadColumnCaster::DATETIME_KERNEL>(
+  ObTableLoadCastObjCtx &cast_obj_ctx, const ObObjType expect_type, const ObAccuracy &accuracy,
+  const ObObj &src, ObStorageDatum &datum)
+{
+  UNUSED(cast_obj_ctx);
+  UNUSED(expect_type);
+  UNUSED(accuracy);
+  int ret = OB_EAGAIN;
+  int64_t value = 0;
+  if (ObStringTC == src.get_type_class() && src.get_val_len() > 0) {
+    if (OB_SUCC(datetime_fast_from(src.get_string_ptr(), src.get_val_len(), value))) {
+      datum.reuse();
+      datum.set_datetime(value);
+    }
+  }
+  return ret;
+}
+
+template <>
+int ObTableLoadColumnCaster::fast_cast_cell<ObTableLoadColumnCaster::DATE_KERNEL>(
+  ObTableLoadCastObjCtx &cast_obj_ctx, const ObObjType expect_type, const ObAccuracy &accuracy,
+  const ObObj &src, ObStorageDatum &datum)
+{
+  UNUSED(cast_obj_ctx);
+  UNUSED(expect_type);
+  UNUSED(accuracy);
+  int ret = OB_EAGAIN;
+  int32_t value = 0;
+  if (ObStringTC == src.get_type_class() && src.get_val_len() > 0) {
+    if (OB_SUCC(date_fast_from(src.get_string_ptr(), src.get_val_len(), value))) {
+      datum.reuse();
+      datum.set_date(value);
+    }
+  }
+  return ret;
+}
+
+template <ObTableLoadColumnCaster::KernelType KERNEL>
+int ObTableLoadColumnCaster::cast_column_kernel(ObTableLoadCastObjCtx &cast_obj_ctx,
+                                                const ObColumnSchemaV2 *column_schema,
+                                                const ObObj *const *rows, int64_t col_idx,
+                                                int64_t row_count, ObStorageDatum *datums,
+                                                int *row_rets)
+{
+  int ret = OB_SUCCESS;
+  const ObObjType expect_type = column_schema->get_meta_type().get_type();
+  const ObAccuracy &accuracy = column_schema->get_accuracy();
+  ObObj out_obj;
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+    if (OB_SUCCESS != row_rets[i]) {
+      continue;
+    }
+    const ObObj &src = rows[i][col_idx];
+    ObStorageDatum &datum = datums[i];
+    int tmp_ret = fast_cast_cell<KERNEL>(cast_obj_ctx, expect_type, accuracy, src, datum);
+    if (OB_EAGAIN == tmp_ret) {
+      out_obj.reset();
+      if (OB_TMP_FAIL(ObTableLoadObjCaster::cast_obj(cast_obj_ctx, column_schema, src, out_obj))) {
+        LOG_WARN("fail to cast obj", KR(tmp_ret), K(src), K(col_idx));
+      } else if (OB_TMP_FAIL(datum.from_obj_enhance(out_obj))) {
+        LOG_WARN("fail to transfer obj to datum", KR(tmp_ret), K(out_obj));
+      }
+    }
+    row_rets[i] = tmp_ret;
+  }
+  return ret;
+}
+
+ObTableLoadColumnCaster::KernelType ObTableLoadColumnCaster::get_kernel_type(
+  const ObColumnSchemaV2 *column_schema)
+{
+  KernelType kernel = GENERIC_KERNEL;
+  const ObObjType expect_type = column_schema->get_meta_type().get_type();
+  if (column_schema->is_enum_or_set()) {
+    kernel = GENERIC_KERNEL;
+  } else if (ob_is_int_tc(expect_type)) {
+    kernel = INT_KERNEL;
+  } else if (ObNumberType == expect_type || ObUNumberType == expect_type) {
+    kernel = NUMBER_KERNEL;
+  } else if (ObDateTimeType == expect_type && lib::is_mysql_mode()) {
+    kernel = DATETIME_KERNEL;
+  } else if (ObDateType == expect_type && lib::is_mysql_mode()) {
+    kernel = DATE_KERNEL;
+  }
+  return kernel;
+}
+
+int ObTableLoadColumnCaster::cast_column(ObTableLoadCastObjCtx &cast_obj_ctx,
+                                         const ObColumnSchemaV2 *column_schema,
+                                         const ObObj *const *rows, int64_t col_idx,
+                                         int64_t row_count, ObStorageDatum *datums, int *row_rets)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == column_schema || nullptr == rows || col_idx < 0 || row_count < 0 ||
+                  nullptr == datums || nullptr == row_rets)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid args", KR(ret), KP(column_schema), KP(rows), K(col_idx), K(row_count),
+             KP(datums), KP(row_rets));
+  } else {
+    switch (get_kernel_type(column_schema)) {
+      case INT_KERNEL:
+        ret = cast_column_kernel<INT_KERNEL>(cast_obj_ctx, column_schema, rows, col_idx, row_count,
+                                             datums, row_rets);
+        break;
+      case NUMBER_KERNEL:
+        ret = cast_column_kernel<NUMBER_KERNEL>(cast_obj_ctx, column_schema, rows, col_idx,
+                                                row_count, datums, row_rets);
+        break;
+      case DATETIME_KERNEL:
+        ret = cast_column_kernel<DATETIME_KERNEL>(cast_obj_ctx, column_schema, rows, col_idx,
+                                                  row_count, datums, row_rets);
+        break;
+      case DATE_KERNEL:
+        ret = cast_column_kernel<DATE_KERNEL>(cast_obj_ctx, column_schema, rows, col_idx,
+                                              row_count, datums, row_rets);
+        break;
+      default:
+        ret = cast_column_kernel<GENERIC_KERNEL>(cast_obj_ctx, column_schema, rows, col_idx,
+                                                 row_count, datums, row_rets);
+        break;
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("fail to cast column", KR(ret), K(col_idx), K(row_count));
+    }
+  }
+  return ret;
+}
+
 } // namespace observer
 } // namespace oceanbase
\ No newline at end of file
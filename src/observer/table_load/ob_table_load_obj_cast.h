@@ -9,6 +9,7 @@
 #include "observer/table_load/ob_table_load_time_convert.h"
 #include "share/object/ob_obj_cast.h"
 #include "share/schema/ob_column_schema.h"
+#include "storage/blocksstable/ob_datum_row.h"
 
 namespace oceanbase
 {
@@ -47,6 +48,7 @@ public:
 
 class ObTableLoadObjCaster
 {
+  friend class ObTableLoadColumnCaster;
   static const common::ObObj zero_obj;
   static const common::ObObj null_obj;
 
@@ -234,5 +236,50 @@ private:
   }
 };
 
+/**
+ * cast a batch of rows column by column, the kernel of each column is chosen once by its type,
+ * cells which the kernel can not handle fall back to ObTableLoadObjCaster::cast_obj
+ */
+class ObTableLoadColumnCaster
+{
+public:
+  enum KernelType
+  {
+    GENERIC_KERNEL = 0,
+    INT_KERNEL = 1,       // string to tinyint ~ bigint
+    NUMBER_KERNEL = 2,    // string to number
+    DATETIME_KERNEL = 3,  // 'YYYY-MM-DD HH:MM:SS' to datetime in mysql mode
+    DATE_KERNEL = 4,      // 'YYYY-MM-DD' to date in mysql mode
+  };
+  static KernelType get_kernel_type(const share::schema::ObColumnSchemaV2 *column_schema);
+  /**
+   * cast the col_idx-th cell of rows[0, row_count) to datums[0, row_count),
+   * rows with row_rets[i] != OB_SUCCESS are ignored, the error code of failed rows
+   * is recorded in row_rets
+   */
+  static int cast_column(ObTableLoadCastObjCtx &cast_obj_ctx,
+                         const share::schema::ObColumnSchemaV2 *column_schema,
+                         const common::ObObj *const *rows, int64_t col_idx, int64_t row_count,
+                         blocksstable::ObStorageDatum *datums, int *row_rets);
+
+private:
+  template <KernelType KERNEL>
+  static int cast_column_kernel(ObTableLoadCastObjCtx &cast_obj_ctx,
+                                const share::schema::ObColumnSchemaV2 *column_schema,
+                                const common::ObObj *const *rows, int64_t col_idx,
+                                int64_t row_count, blocksstable::ObStorageDatum *datums,
+                                int *row_rets);
+  // return OB_EAGAIN if src is not in the simple format of kernel
+  template <KernelType KERNEL>
+  static int fast_cast_cell(ObTableLoadCastObjCtx &cast_obj_ctx,
+                            const common::ObObjType expect_type,
+                            const common::ObAccuracy &accuracy, const common::ObObj &src,
+                            blocksstable::ObStorageDatum &datum);
+  static int int_fast_from(const char *str, const int64_t length,
+                           const common::ObObjType expect_type, int64_t &value);
+  static int date_fast_from(const char *str, const int64_t length, int32_t &date);
+  static int datetime_fast_from(const char *str, const int64_t length, int64_t &datetime);
+};
+
 } // namespace observer
 } // namespace oceanbase
\ No newline at end of file
@@ -47,6 +47,21 @@ int ObTableLoadP::process()
       } else if (!allocator_handle) {
         ret = OB_ALLOCATE_MEMORY_FAILED;
         LOG_WARN("failed to make allocator handle", KR(ret));
+      } else if (table_ctx->param_.data_type_ == ObTableLoadDataType::RAW_STRING &&
+                 ObTableLoadParallelCSVParser::need_parallel(table_ctx, arg_.payload_)) {
+        ObTableLoadObjRowArray obj_rows;
+        obj_rows.set_allocator(allocator_handle);
+        ObTableLoadParallelCSVParser csv_parser;
+        if (OB_FAIL(csv_parser.init(table_ctx, arg_.payload_))) {
+          LOG_WARN("fail to init parallel csv parser", KR(ret));
+        } else if (OB_FAIL(csv_parser.parse(obj_rows))) {
+          LOG_WARN("fail to parallel parse", KR(ret), K(csv_parser.get_piece_count()));
+        } else if (obj_rows.empty()) {
+          // do nothing
+        } else if (OB_FAIL(coordinator.write(arg_.trans_id_, arg_.session_id_, arg_.sequence_no_,
+                                             obj_rows))) {
+          LOG_WARN("fail to coordinator write objs", KR(ret));
+        }
       } else if (table_ctx->param_.data_type_ == ObTableLoadDataType::RAW_STRING) {
         int64_t col_count = table_ctx->param_.column_count_;
         ObTableLoadObjRowArray obj_rows;
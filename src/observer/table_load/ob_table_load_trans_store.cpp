@@ -90,6 +90,9 @@ ObTableLoadTransStoreWriter::SessionContext::SessionContext(int32_t session_id,
   : session_id_(session_id),
     cast_allocator_("TLD_TS_Caster", OB_MALLOC_NORMAL_BLOCK_SIZE, tenant_id),
     cast_params_(cast_params),
+    batch_cells_(nullptr),
+    batch_datums_(nullptr),
+    batch_rets_(nullptr),
     last_receive_sequence_no_(0)
 {
 }
@@ -214,6 +217,27 @@ int ObTableLoadTransStoreWriter::init_session_ctx_array()
       session_ctx->datum_row_.row_flag_.set_flag(ObDmlFlag::DF_INSERT);
       session_ctx->datum_row_.mvcc_row_flag_.set_last_multi_version_row(true);
     }
+    // init batch cast buffers
+    if (OB_SUCC(ret)) {
+      const int64_t datum_count = table_data_desc_->column_count_ * CAST_BATCH_SIZE;
+      if (OB_ISNULL(session_ctx->batch_cells_ = static_cast<const ObObj **>(
+                      allocator_.alloc(sizeof(const ObObj *) * CAST_BATCH_SIZE)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to allocate memory", KR(ret));
+      } else if (OB_ISNULL(session_ctx->batch_rets_ = static_cast<int *>(
+                             allocator_.alloc(sizeof(int) * CAST_BATCH_SIZE)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to allocate memory", KR(ret));
+      } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObStorageDatum) * datum_count))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to allocate memory", KR(ret), K(datum_count));
+      } else {
+        session_ctx->batch_datums_ = static_cast<ObStorageDatum *>(buf);
+        for (int64_t j = 0; j < datum_count; ++j) {
+          new (session_ctx->batch_datums_ + j) ObStorageDatum();
+        }
+      }
+    }
   }
   return ret;
 }
@@ -258,18 +282,36 @@ int ObTableLoadTransStoreWriter::write(int32_t session_id,
     LOG_WARN("invalid args", KR(ret), K(session_id), K(row_array.empty()));
   } else {
     SessionContext &session_ctx = session_ctx_array_[session_id - 1];
-    for (int64_t i = 0; OB_SUCC(ret) && i < row_array.count(); ++i) {
-      const ObTableLoadTabletObjRow &row = row_array.at(i);
-      ObNewRow new_row(row.obj_row_.cells_, row.obj_row_.count_);
-      if (OB_FAIL(cast_row(session_ctx.cast_allocator_, session_ctx.cast_params_, new_row, session_ctx.datum_row_,
-                           session_id))) {
-        if (OB_UNLIKELY(OB_EAGAIN != ret)) {
-          LOG_WARN("fail to cast row", KR(ret), K(session_id), K(row.tablet_id_), K(i));
+    const int64_t column_count = table_data_desc_->column_count_;
+    for (int64_t offset = 0; OB_SUCC(ret) && offset < row_array.count();
+         offset += CAST_BATCH_SIZE) {
+      const int64_t batch_size = MIN(CAST_BATCH_SIZE, row_array.count() - offset);
+      if (OB_FAIL(cast_batch(session_ctx, row_array, offset, batch_size))) {
+        LOG_WARN("fail to cast batch", KR(ret), K(session_id), K(offset), K(batch_size));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; ++i) {
+        const ObTableLoadTabletObjRow &row = row_array.at(offset + i);
+        const int row_ret = session_ctx.batch_rets_[i];
+        if (OB_SUCCESS != row_ret) {
+          int tmp_ret = OB_SUCCESS;
+          ObNewRow new_row(row.obj_row_.cells_, row.obj_row_.count_);
+          ObTableLoadErrorRowHandler *error_row_handler =
+            trans_ctx_->ctx_->store_ctx_->error_row_handler_;
+          if (OB_TMP_FAIL(error_row_handler->append_error_row(new_row))) {
+            ret = row_ret;
+            LOG_WARN("failed to append error row", KR(ret), K(new_row));
+          }
         } else {
-          ret = OB_SUCCESS;
+          for (int64_t j = 0; j < column_count; ++j) {
+            session_ctx.datum_row_.storage_datums_[j] =
+              session_ctx.batch_datums_[j * CAST_BATCH_SIZE + i];
+          }
+          if (OB_FAIL(write_row_to_table_store(session_ctx.table_store_, row.tablet_id_,
+                                               session_ctx.datum_row_))) {
+            LOG_WARN("fail to write row", KR(ret), K(session_id), K(row.tablet_id_),
+                     K(offset + i));
+          }
         }
-      } else if (OB_FAIL(write_row_to_table_store(session_ctx.table_store_, row.tablet_id_, session_ctx.datum_row_))) {
-        LOG_WARN("fail to write row", KR(ret), K(session_id), K(row.tablet_id_), K(i));
       }
     }
     if (OB_SUCC(ret)) {
@@ -355,43 +397,76 @@ int ObTableLoadTransStoreWriter::clean_up(int32_t session_id)
   return ret;
 }
 
-int ObTableLoadTransStoreWriter::cast_row(ObArenaAllocator &cast_allocator,
-                                          ObDataTypeCastParams cast_params, const ObNewRow &row,
-                                          ObDatumRow &datum_row, int32_t session_id)
+// cast a batch column by column, so that the kernel and cast ctx of each column are set up once
+// per batch instead of once per cell. autoinc and identity columns consume sequence values,
+// they are cast at last and only for the rows without error.
+int ObTableLoadTransStoreWriter::cast_batch(SessionContext &session_ctx,
+                                            const ObTableLoadTabletObjRowArray &row_array,
+                                            const int64_t offset, const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  const int64_t column_count = table_data_desc_->column_count_;
+  for (int64_t i = 0; i < batch_size; ++i) {
+    session_ctx.batch_cells_[i] = row_array.at(offset + i).obj_row_.cells_;
+    session_ctx.batch_rets_[i] = OB_SUCCESS;
+  }
+  for (int64_t j = 0; OB_SUCC(ret) && j < column_count; ++j) {
+    const ObColumnSchemaV2 *column_schema = column_schemas_.at(j);
+    if (column_schema->is_autoincrement() || column_schema->is_identity_column()) {
+      continue;
+    }
+    ObCastCtx cast_ctx(&session_ctx.cast_allocator_, &session_ctx.cast_params_, CM_NONE,
+                       column_schema->get_collation_type());
+    ObTableLoadCastObjCtx cast_obj_ctx(&time_cvrt_, &cast_ctx, true);
+    if (OB_FAIL(ObTableLoadColumnCaster::cast_column(
+          cast_obj_ctx, column_schema, session_ctx.batch_cells_, j, batch_size,
+          session_ctx.batch_datums_ + j * CAST_BATCH_SIZE, session_ctx.batch_rets_))) {
+      LOG_WARN("fail to cast column", KR(ret), K(j), K(batch_size));
+    }
+  }
+  for (int64_t j = 0; OB_SUCC(ret) && j < column_count; ++j) {
+    const ObColumnSchemaV2 *column_schema = column_schemas_.at(j);
+    if (!column_schema->is_autoincrement() && !column_schema->is_identity_column()) {
+      continue;
+    }
+    ObStorageDatum *datums = session_ctx.batch_datums_ + j * CAST_BATCH_SIZE;
+    for (int64_t i = 0; i < batch_size; ++i) {
+      if (OB_SUCCESS == session_ctx.batch_rets_[i]) {
+        session_ctx.batch_rets_[i] = cast_autoinc_identity_cell(
+          session_ctx, column_schema, session_ctx.batch_cells_[i][j], datums[i]);
+      }
+    }
+  }
+  return ret;
+}
+
+int ObTableLoadTransStoreWriter::cast_autoinc_identity_cell(SessionContext &session_ctx,
+                                                            const ObColumnSchemaV2 *column_schema,
+                                                            const ObObj &src,
+                                                            ObStorageDatum &datum)
 {
   int ret = OB_SUCCESS;
   ObObj out_obj;
-  for (int64_t i = 0; OB_SUCC(ret) && i < table_data_desc_->column_count_; ++i) {
-    out_obj.set_null();
-    const ObColumnSchemaV2 *column_schema = column_schemas_.at(i);
-    ObCastCtx cast_ctx(&cast_allocator, &cast_params, CM_NONE, column_schema->get_collation_type());
+  out_obj.set_null();
+  if (!src.is_null()) {
+    ObCastCtx cast_ctx(&session_ctx.cast_allocator_, &session_ctx.cast_params_, CM_NONE,
+                       column_schema->get_collation_type());
     ObTableLoadCastObjCtx cast_obj_ctx(&time_cvrt_, &cast_ctx, true);
-    if ((!row.cells_[i].is_null() ||
-         (!column_schema->is_autoincrement() && !column_schema->is_identity_column())) &&
-        OB_FAIL(
-          ObTableLoadObjCaster::cast_obj(cast_obj_ctx, column_schema, row.cells_[i], out_obj))) {
-      LOG_WARN("fail to cast obj and check", KR(ret), K(i), K(row.cells_[i]));
-    } else if (OB_FAIL(datum_row.storage_datums_[i].from_obj_enhance(out_obj))) {
-      LOG_WARN("fail to from obj enhance", KR(ret), K(out_obj));
-    } else if (column_schema->is_autoincrement() &&
-               OB_FAIL(handle_autoinc_column(column_schema, datum_row.storage_datums_[i],
-                                             column_schema->get_meta_type().get_type_class(),
-                                             session_id))) {
-      LOG_WARN("fail to handle autoinc column", KR(ret), K(i), K(datum_row.storage_datums_[i]));
-    } else if (column_schema->is_identity_column() &&
-               OB_FAIL(handle_identity_column(column_schema, datum_row.storage_datums_[i], cast_allocator))) {
-      LOG_WARN("fail to handle identity column", KR(ret), K(i), K(datum_row.storage_datums_[i]));
+    if (OB_FAIL(ObTableLoadObjCaster::cast_obj(cast_obj_ctx, column_schema, src, out_obj))) {
+      LOG_WARN("fail to cast obj and check", KR(ret), K(src));
     }
   }
   if (OB_FAIL(ret)) {
-    int tmp_ret = OB_SUCCESS;
-    ObTableLoadErrorRowHandler *error_row_handler =
-      trans_ctx_->ctx_->store_ctx_->error_row_handler_;
-    if (OB_TMP_FAIL(error_row_handler->append_error_row(row))) {
-      LOG_WARN("failed to append error row", K(ret), K(row));
-    } else {
-      ret = OB_EAGAIN;
-    }
+  } else if (OB_FAIL(datum.from_obj_enhance(out_obj))) {
+    LOG_WARN("fail to from obj enhance", KR(ret), K(out_obj));
+  } else if (column_schema->is_autoincrement() &&
+             OB_FAIL(handle_autoinc_column(column_schema, datum,
+                                           column_schema->get_meta_type().get_type_class(),
+                                           session_ctx.session_id_))) {
+    LOG_WARN("fail to handle autoinc column", KR(ret), K(datum));
+  } else if (column_schema->is_identity_column() &&
+             OB_FAIL(handle_identity_column(column_schema, datum, session_ctx.cast_allocator_))) {
+    LOG_WARN("fail to handle identity column", KR(ret), K(datum));
   }
   return ret;
 }
@@ -51,6 +51,7 @@ public:
 class ObTableLoadTransStoreWriter
 {
 public:
+  static const int64_t CAST_BATCH_SIZE = 256;
   ObTableLoadTransStoreWriter(ObTableLoadTransStore *trans_store);
   ~ObTableLoadTransStoreWriter();
   int init();
@@ -73,9 +74,11 @@ private:
   class SessionContext;
   int init_session_ctx_array();
   int init_column_schemas();
-  int cast_row(common::ObArenaAllocator &cast_allocator, ObDataTypeCastParams cast_params,
-               const common::ObNewRow &row, blocksstable::ObDatumRow &datum_row,
-               int32_t session_id);
+  int cast_batch(SessionContext &session_ctx, const table::ObTableLoadTabletObjRowArray &row_array,
+                 const int64_t offset, const int64_t batch_size);
+  int cast_autoinc_identity_cell(SessionContext &session_ctx,
+                                 const share::schema::ObColumnSchemaV2 *column_schema,
+                                 const common::ObObj &src, blocksstable::ObStorageDatum &datum);
   int handle_autoinc_column(const share::schema::ObColumnSchemaV2 *column_schema,
                             blocksstable::ObStorageDatum &datum,
                             const ObObjTypeClass &tc,
@@ -106,6 +109,10 @@ private:
     blocksstable::ObDatumRow datum_row_;
     common::ObArenaAllocator cast_allocator_;
     ObDataTypeCastParams cast_params_;
+    // column-major cast buffers of a batch, see cast_batch()
+    const common::ObObj **batch_cells_;
+    blocksstable::ObStorageDatum *batch_datums_;
+    int *batch_rets_;
     storage::ObDirectLoadTableStore table_store_;
     uint64_t last_receive_sequence_no_;
   };
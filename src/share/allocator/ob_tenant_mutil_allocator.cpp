@@ -28,6 +28,7 @@ namespace common
 
 ObTenantMutilAllocator::ObTenantMutilAllocator(uint64_t tenant_id)
   : tenant_id_(tenant_id), total_limit_(INT64_MAX), pending_replay_mutator_size_(0),
+    log_hot_cache_limit_(INT64_MAX), log_hot_cache_hold_(0),
     LOG_IO_FLUSH_LOG_TASK_SIZE(sizeof(palf::LogIOFlushLogTask)),
     LOG_IO_TRUNCATE_LOG_TASK_SIZE(sizeof(palf::LogIOTruncateLogTask)),
     LOG_IO_FLUSH_META_TASK_SIZE(sizeof(palf::LogIOFlushMetaTask)),
@@ -300,6 +301,32 @@ void ObTenantMutilAllocator::free_log_io_flashback_task(palf::LogIOFlashbackTask
   }
 }
 
+// hot cache buffers are charged to the common budget when allocated, and
+// all of them are capped by LOG_HOT_CACHE_MEM_LIMIT_PERCENT of the tenant memory
+void *ObTenantMutilAllocator::alloc_log_hot_cache_buf(const int64_t size)
+{
+  void *ptr = NULL;
+  ObMemAttr attr(tenant_id_, "LogHotCache");
+  if (ATOMIC_AAF(&log_hot_cache_hold_, size) > ATOMIC_LOAD(&log_hot_cache_limit_)) {
+    OB_LOG(WARN, "log hot cache over limit", K(tenant_id_), K(size), K(log_hot_cache_hold_),
+        K(log_hot_cache_limit_));
+  } else {
+    ptr = common_blk_alloc_.alloc_block(size, attr);
+  }
+  if (NULL == ptr) {
+    ATOMIC_SAF(&log_hot_cache_hold_, size);
+  }
+  return ptr;
+}
+
+void ObTenantMutilAllocator::free_log_hot_cache_buf(void *ptr, const int64_t size)
+{
+  if (NULL != ptr) {
+    common_blk_alloc_.free_block(ptr, size);
+    ATOMIC_SAF(&log_hot_cache_hold_, size);
+  }
+}
+
 void ObTenantMutilAllocator::set_nway(const int32_t nway)
 {
   if (nway > 0) {
@@ -318,13 +345,16 @@ void ObTenantMutilAllocator::set_limit(const int64_t total_limit)
     const int64_t replay_limit = std::min(total_limit / 100 * REPLAY_MEM_LIMIT_PERCENT, REPLAY_MEM_LIMIT_THRESHOLD);
     const int64_t inner_table_replay_limit = replay_limit * INNER_TABLE_REPLAY_MEM_PERCENT / 100;
     const int64_t user_table_replay_limit = replay_limit * (100 - INNER_TABLE_REPLAY_MEM_PERCENT) / 100;
+    const int64_t log_hot_cache_limit = total_limit / 100 * LOG_HOT_CACHE_MEM_LIMIT_PERCENT;
     const int64_t common_limit = total_limit - (clog_limit + replay_limit);
     clog_blk_alloc_.set_limit(clog_limit);
     inner_table_replay_blk_alloc_.set_limit(inner_table_replay_limit);
     user_table_replay_blk_alloc_.set_limit(user_table_replay_limit);
     common_blk_alloc_.set_limit(common_limit);
+    ATOMIC_STORE(&log_hot_cache_limit_, log_hot_cache_limit);
     OB_LOG(INFO, "ObTenantMutilAllocator set tenant mem limit finished", K(tenant_id_), K(total_limit), K(clog_limit),
-        K(replay_limit), K(common_limit), K(inner_table_replay_limit), K(user_table_replay_limit));
+        K(replay_limit), K(common_limit), K(inner_table_replay_limit), K(user_table_replay_limit),
+        K(log_hot_cache_limit));
   }
 }
 
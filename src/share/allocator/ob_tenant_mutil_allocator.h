@@ -69,6 +69,8 @@ public:
   virtual void free_replay_log_buf(void *ptr) = 0;
   virtual palf::LogIOFlashbackTask *alloc_log_io_flashback_task(const int64_t palf_id, const int64_t palf_epoch) = 0;
   virtual void free_log_io_flashback_task(palf::LogIOFlashbackTask *ptr) = 0;
+  virtual void *alloc_log_hot_cache_buf(const int64_t size) = 0;
+  virtual void free_log_hot_cache_buf(void *ptr, const int64_t size) = 0;
   TO_STRING_KV(K_(flying_log_task), K_(flying_meta_task));
 
 protected:
@@ -104,6 +106,8 @@ public:
   const int64_t REPLAY_MEM_LIMIT_THRESHOLD = 512 * 1024 * 1024ll;
   // The memory percent of replay engine for inner_table
   const int64_t INNER_TABLE_REPLAY_MEM_PERCENT = 20;
+  // The max memory percent of hot cache of all palf replicas, charged to the common budget
+  const int64_t LOG_HOT_CACHE_MEM_LIMIT_PERCENT = 5;
   static int choose_blk_size(int obj_size);
 
 public:
@@ -151,11 +155,15 @@ public:
   void free_replay_log_buf(void *ptr);
   palf::LogIOFlashbackTask *alloc_log_io_flashback_task(const int64_t palf_id, const int64_t palf_epoch);
   void free_log_io_flashback_task(palf::LogIOFlashbackTask *ptr);
+  void *alloc_log_hot_cache_buf(const int64_t size);
+  void free_log_hot_cache_buf(void *ptr, const int64_t size);
 
 private:
   uint64_t tenant_id_ CACHE_ALIGNED;
   int64_t total_limit_;
   int64_t pending_replay_mutator_size_;
+  int64_t log_hot_cache_limit_;
+  int64_t log_hot_cache_hold_;
   const int LOG_IO_FLUSH_LOG_TASK_SIZE;
   const int LOG_IO_TRUNCATE_LOG_TASK_SIZE;
   const int LOG_IO_FLUSH_META_TASK_SIZE;
@@ -417,6 +417,11 @@ DEF_INT(_storage_meta_memory_limit_percentage, OB_TENANT_PARAMETER, "20", "[0, 5
          "maximum memory for storage meta, as a percentage of total tenant memory. "
          "Range: [0, 50), percentage, 0 means no limit to storage meta memory",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_storage_meta_resident_tablet_limit, OB_TENANT_PARAMETER, "0", "[0,)",
+         "maximum count of tablets whose full meta stays resident in memory, tablets exceeding "
+         "it are washed in background by least recent access. "
+         "Range: [0,), 0 means only limited by _storage_meta_memory_limit_percentage",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 ////  rootservice config
 DEF_TIME(lease_time, OB_CLUSTER_PARAMETER, "10s", "[1s, 5m]",
          "Lease for current heartbeat. If the root server does not received any heartbeat "
@@ -538,6 +543,12 @@ DEF_INT(log_archive_concurrency, OB_TENANT_PARAMETER, "1", "[1, 100]",
         "Range: [1, 100] in integer",
         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
+DEF_STR_WITH_CHECKER(log_archive_compress_func, OB_TENANT_PARAMETER, "none",
+                     common::ObConfigCompressFuncChecker,
+                     "compressor used for log archive, takes effect when archive round starts. "
+                     "Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
+                     ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
 DEF_INT(log_disk_utilization_limit_threshold, OB_TENANT_PARAMETER, "95",
         "[80, 100]",
         "maximum of log disk usage percentage before stop submitting or receiving logs, "
@@ -666,6 +677,10 @@ DEF_TIME(_ob_trans_rpc_timeout, OB_CLUSTER_PARAMETER, "3s", "[0s, 3600s]",
 DEF_BOOL(enable_early_lock_release, OB_TENANT_PARAMETER, "True",
          "enable early lock release",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_hot_row_early_lock_release, OB_TENANT_PARAMETER, "False",
+         "enable early lock release for the transactions which have waited on a row lock, "
+         "even if enable_early_lock_release is turned off",
+         ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(_tx_result_retention, OB_TENANT_PARAMETER, "300", "[0, 36000]",
         "The tx data can be recycled after at least _tx_result_retention seconds. "
         "Range: [0, 36000]",
@@ -16,6 +16,10 @@
 #include "sql/resolver/cmd/ob_load_data_stmt.h"
 #include "lib/oblog/ob_log_module.h"
 
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
 using namespace oceanbase::sql;
 using namespace oceanbase::common;
 
@@ -72,6 +76,105 @@ int ObCSVGeneralParser::init(const ObDataInFileStruct &format,
   return ret;
 }
 
+void ObCSVStructuralScanner::classify(const char *block, int64_t len,
+                                      char field_term_c, char line_term_c,
+                                      char escape_c, bool has_escape,
+                                      Masks &masks)
+{
+  const char *data = block;
+  char tail_buf[BLOCK_SIZE];
+  if (len < BLOCK_SIZE) {
+    MEMCPY(tail_buf, block, len);
+    MEMSET(tail_buf + len, 0, BLOCK_SIZE - len);
+    data = tail_buf;
+  }
+#if defined(__x86_64__)
+  const __m128i field_term_vec = _mm_set1_epi8(field_term_c);
+  const __m128i line_term_vec = _mm_set1_epi8(line_term_c);
+  const __m128i escape_vec = _mm_set1_epi8(escape_c);
+  uint64_t field_term_mask = 0;
+  uint64_t line_term_mask = 0;
+  uint64_t escape_mask = 0;
+  for (int64_t i = 0; i < BLOCK_SIZE / 16; ++i) {
+    const __m128i data_vec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i * 16));
+    const int64_t shift = i * 16;
+    field_term_mask |= static_cast<uint64_t>(static_cast<uint16_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(data_vec, field_term_vec)))) << shift;
+    line_term_mask |= static_cast<uint64_t>(static_cast<uint16_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(data_vec, line_term_vec)))) << shift;
+    escape_mask |= static_cast<uint64_t>(static_cast<uint16_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(data_vec, escape_vec)))) << shift;
+  }
+#else
+  uint64_t field_term_mask = 0;
+  uint64_t line_term_mask = 0;
+  uint64_t escape_mask = 0;
+  for (int64_t i = 0; i < BLOCK_SIZE; ++i) {
+    field_term_mask |= static_cast<uint64_t>(field_term_c == data[i]) << i;
+    line_term_mask |= static_cast<uint64_t>(line_term_c == data[i]) << i;
+    escape_mask |= static_cast<uint64_t>(escape_c == data[i]) << i;
+  }
+#endif
+  const uint64_t valid_mask = len < BLOCK_SIZE ? ((1ULL << len) - 1) : UINT64_MAX;
+  masks.field_term_ = field_term_mask & valid_mask;
+  masks.line_term_ = line_term_mask & valid_mask;
+  masks.escape_ = has_escape ? (escape_mask & valid_mask) : 0;
+}
+
+int ObCSVGeneralParser::split_lines(const char *begin, const char *end, int64_t split_count,
+                                    ObIArray<ObString> &pieces) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == begin || end < begin || split_count <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid args", K(ret), KP(begin), KP(end), K(split_count));
+  } else if (OB_UNLIKELY(!is_simd_scan_supported())) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("split lines is not supported", K(ret), K(opt_param_.is_simple_format_),
+             K(format_.cs_type_));
+  } else {
+    const bool has_escape = (INT64_MAX != format_.field_escaped_char_);
+    const char escape_c = has_escape ? static_cast<char>(format_.field_escaped_char_) : '\0';
+    const int64_t piece_size = (end - begin + split_count - 1) / split_count;
+    const char *piece_begin = begin;
+    for (int64_t i = 1; OB_SUCC(ret) && i < split_count && piece_begin < end; ++i) {
+      const char *pos = MAX(piece_begin, begin + i * piece_size);
+      const char *piece_end = nullptr;
+      while (nullptr == piece_end && pos < end) {
+        const char *term = static_cast<const char *>(
+            memchr(pos, opt_param_.line_term_c_, end - pos));
+        if (nullptr == term) {
+          pos = end;
+        } else {
+          // the terminator is escaped by an odd-length run of escape chars before it
+          int64_t escape_cnt = 0;
+          for (const char *p = term - 1; has_escape && p >= piece_begin && escape_c == *p; --p) {
+            ++escape_cnt;
+          }
+          if (0 == (escape_cnt & 1)) {
+            piece_end = term + 1;
+          } else {
+            pos = term + 1;
+          }
+        }
+      }
+      if (nullptr == piece_end || piece_end >= end) {
+        break;
+      } else if (OB_FAIL(pieces.push_back(ObString(piece_end - piece_begin, piece_begin)))) {
+        LOG_WARN("fail to push back piece", K(ret));
+      } else {
+        piece_begin = piece_end;
+      }
+    }
+    if (OB_SUCC(ret) && piece_begin < end) {
+      if (OB_FAIL(pieces.push_back(ObString(end - piece_begin, piece_begin)))) {
+        LOG_WARN("fail to push back piece", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObCSVGeneralParser::handle_irregular_line(int field_idx, int line_no,
                                               ObIArray<LineErrRec> &errors)
 {
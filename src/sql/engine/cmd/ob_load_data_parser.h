@@ -40,6 +40,42 @@ struct ObCSVGeneralFormat {
   int64_t file_column_nums_;
 };
 
+/**
+ * @brief Structural scanner classifies 64 bytes at a time into bitmasks
+ *        bit i of a mask is set when the i-th byte of the block is the masked char
+ */
+class ObCSVStructuralScanner
+{
+public:
+  static const int64_t BLOCK_SIZE = 64;
+  struct Masks {
+    Masks() : field_term_(0), line_term_(0), escape_(0) {}
+    uint64_t field_term_;
+    uint64_t line_term_;
+    uint64_t escape_;
+  };
+public:
+  // bytes after block + len are never read, their bits are always cleared
+  static void classify(const char *block, int64_t len,
+                       char field_term_c, char line_term_c,
+                       char escape_c, bool has_escape,
+                       Masks &masks);
+  // returns the mask of chars escaped by an odd-length run of escape chars,
+  // prev_escaped carries the run across blocks and must be 0 at the start of a line
+  static inline uint64_t find_escaped(uint64_t escape, uint64_t &prev_escaped)
+  {
+    const uint64_t EVEN_BITS = 0x5555555555555555ULL;
+    escape &= ~prev_escaped;
+    const uint64_t follows_escape = (escape << 1) | prev_escaped;
+    const uint64_t odd_sequence_starts = escape & ~EVEN_BITS & ~follows_escape;
+    uint64_t sequences_starting_on_even_bits = 0;
+    prev_escaped = __builtin_add_overflow(odd_sequence_starts, escape,
+                                          &sequences_starting_on_even_bits) ? 1 : 0;
+    const uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+    return (EVEN_BITS ^ invert_mask) & follows_escape;
+  }
+};
+
 /**
  * @brief Fast csv general parser is mysql compatible csv parser
  *        It support single-byte or multi-byte seperators
@@ -126,6 +162,41 @@ public:
   }
   common::ObIArray<FieldValue>& get_fields_per_line() { return fields_per_line_; }
 
+  /**
+   * simd scan works on simple format (single-byte terminators, no enclosed char)
+   * in charsets whose multi-byte chars never contain ascii bytes
+   */
+  bool is_simd_scan_supported() const
+  {
+    return opt_param_.is_simple_format_
+        && common::CHARSET_GBK != format_.cs_type_
+        && common::CHARSET_GB18030 != format_.cs_type_;
+  }
+
+  /**
+   * same as scan<handle_func, true>, but terminators are located by ObCSVStructuralScanner,
+   * and escaped fields of all lines returned by one call are kept in escape_buf
+   */
+  template<typename handle_func>
+  int scan_simd(const char *&str, const char *end, int64_t &nrows,
+                char *escape_buf, char *escape_buf_end,
+                handle_func &handle_one_line,
+                common::ObIArray<LineErrRec> &errors,
+                bool is_end_file = false);
+
+  /**
+   * split [begin, end) into at most split_count pieces of similar size,
+   * every piece except the last one ends with an unescaped line terminator
+   */
+  int split_lines(const char *begin, const char *end, int64_t split_count,
+                  common::ObIArray<common::ObString> &pieces) const;
+
+private:
+  inline
+  void gen_new_simd_field(bool is_field_term, bool has_escape,
+                          const char *field_begin, const char *field_end, const char *end,
+                          char *&escape_buf_pos, int &field_idx);
+
 private:
   template<common::ObCharsetType cs_type>
   inline int mbcharlen(const char *ptr, const char *end) {
@@ -229,6 +300,41 @@ inline int ObCSVGeneralParser::mbcharlen<common::CHARSET_GB18030>(const char *pt
   return mb_len;
 }
 
+inline void ObCSVGeneralParser::gen_new_simd_field(bool is_field_term, bool has_escape,
+                                                   const char *field_begin,
+                                                   const char *field_end,
+                                                   const char *end,
+                                                   char *&escape_buf_pos,
+                                                   int &field_idx)
+{
+  if (has_escape) {
+    const char escape_c = static_cast<char>(format_.field_escaped_char_);
+    const bool is_utf8 = common::CHARSET_UTF8MB4 == format_.cs_type_;
+    char *escaped_begin = escape_buf_pos;
+    const char *pos = field_begin;
+    while (pos < field_end) {
+      const char *next = pos + 1;
+      if (escape_c == *pos && next < end) {
+        if (!is_utf8 || 1 == mbcharlen<common::CHARSET_UTF8MB4>(next, end)) {
+          *(escape_buf_pos++) = escape(*next);
+          pos += 2;
+        } else {
+          pos += 1;
+        }
+      } else {
+        *(escape_buf_pos++) = *(pos++);
+      }
+    }
+    field_begin = escaped_begin;
+    field_end = escape_buf_pos;
+  }
+  if (is_field_term || field_end > field_begin || field_idx < format_.file_column_nums_) {
+    if (field_idx++ < format_.file_column_nums_) {
+      gen_new_field(false, has_escape, field_begin, field_end, field_idx);
+    }
+  }
+}
+
 template<common::ObCharsetType cs_type, typename handle_func, bool DO_ESCAPE>
 int ObCSVGeneralParser::scan_proto(const char *&str,
                                    const char *end,
@@ -392,6 +498,96 @@ int ObCSVGeneralParser::scan_proto(const char *&str,
   return ret;
 }
 
+template<typename handle_func>
+int ObCSVGeneralParser::scan_simd(const char *&str,
+                                  const char *end,
+                                  int64_t &nrows,
+                                  char *escape_buf,
+                                  char *escape_buf_end,
+                                  handle_func &handle_one_line,
+                                  common::ObIArray<LineErrRec> &errors,
+                                  bool is_end_file)
+{
+  int ret = common::OB_SUCCESS;
+
+  int line_no = 0;
+  const char *line_begin = str;
+
+  if (OB_UNLIKELY(!is_simd_scan_supported())) {
+    ret = common::OB_NOT_SUPPORTED;
+  } else if (escape_buf_end - escape_buf < end - str) {
+    ret = common::OB_BUF_NOT_ENOUGH;
+  } else {
+    const int64_t BLOCK_SIZE = ObCSVStructuralScanner::BLOCK_SIZE;
+    const bool has_escape = (INT64_MAX != format_.field_escaped_char_);
+    const char escape_c = has_escape ? static_cast<char>(format_.field_escaped_char_) : '\0';
+    char *escape_buf_pos = escape_buf;
+    const char *field_begin = str;
+    bool field_has_escape = false;
+    int field_idx = 0;
+    uint64_t prev_escaped = 0;
+
+    for (const char *block = str;
+         OB_SUCC(ret) && block < end && line_no < nrows;
+         block += BLOCK_SIZE) {
+      ObCSVStructuralScanner::Masks masks;
+      ObCSVStructuralScanner::classify(block, MIN(BLOCK_SIZE, end - block),
+                                       opt_param_.field_term_c_, opt_param_.line_term_c_,
+                                       escape_c, has_escape, masks);
+      const uint64_t escaped = has_escape
+          ? ObCSVStructuralScanner::find_escaped(masks.escape_, prev_escaped) : 0;
+      const uint64_t escape_starts = masks.escape_ & ~escaped;
+      uint64_t structurals = (masks.field_term_ | masks.line_term_) & ~escaped;
+      uint64_t consumed = 0;
+      while (OB_SUCC(ret) && 0 != structurals && line_no < nrows) {
+        const uint64_t bit = structurals & (~structurals + 1);
+        const char *term = block + __builtin_ctzll(structurals);
+        const bool is_line_term = (0 != (masks.line_term_ & bit));
+        field_has_escape |= (0 != (escape_starts & (bit - 1) & ~consumed));
+        gen_new_simd_field(!is_line_term, field_has_escape, field_begin, term, end,
+                           escape_buf_pos, field_idx);
+        field_begin = term + 1;
+        field_has_escape = false;
+        if (is_line_term) {
+          if (field_idx != format_.file_column_nums_) {
+            ret = handle_irregular_line(field_idx, line_no, errors);
+          }
+          if (OB_SUCC(ret)) {
+            ret = handle_one_line(fields_per_line_);
+          }
+          line_no++;
+          line_begin = field_begin;
+          field_idx = 0;
+        }
+        consumed |= (bit | (bit - 1));
+        structurals &= (structurals - 1);
+      }
+      field_has_escape |= (0 != (escape_starts & ~consumed));
+    }
+
+    // the last line of file may have no line terminator
+    if (OB_SUCC(ret) && is_end_file && line_no < nrows && line_begin < end) {
+      if (field_begin < end) {
+        gen_new_simd_field(false, field_has_escape, field_begin, end, end,
+                           escape_buf_pos, field_idx);
+      }
+      if (field_idx != format_.file_column_nums_) {
+        ret = handle_irregular_line(field_idx, line_no, errors);
+      }
+      if (OB_SUCC(ret)) {
+        ret = handle_one_line(fields_per_line_);
+      }
+      line_no++;
+      line_begin = end;
+    }
+  }
+
+  str = line_begin;
+  nrows = line_no;
+
+  return ret;
+}
+
 }
 }
 
@@ -103,7 +103,7 @@ int ObExprJsonContains::eval_json_contains(const ObExpr &expr, ObEvalCtx &ctx, O
           LOG_WARN("fail to get real data.", K(ret), K(path_val));
         } else if (OB_FAIL(ObJsonExprHelper::find_and_add_cache(path_cache, json_path, path_val, 2, false))) {
           LOG_WARN("json path parse failed", K(path_data->get_string()), K(ret));
-        } else if (OB_FAIL(json_target->seek(*json_path, json_path->path_node_cnt(), true, false, sub_json_targets))) {
+        } else if (OB_FAIL(ObJsonExprHelper::seek_single_path(json_target, *json_path, sub_json_targets))) {
           LOG_WARN("json seek failed", K(path_data->get_string()), K(ret));
         } else {
           // use the first of results as candidate
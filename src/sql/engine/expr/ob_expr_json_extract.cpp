@@ -155,7 +155,9 @@ int ObExprJsonExtract::eval_json_extract(const ObExpr &expr, ObEvalCtx &ctx, ObD
           LOG_WARN("fail to get real data.", K(ret), K(path_text));
         } else if (OB_FAIL(ObJsonExprHelper::find_and_add_cache(path_cache, j_path, path_text, i, true))) {
           LOG_WARN("parse text to path failed", K(path_text), K(ret));
-        } else if (OB_FAIL(j_base->seek(*j_path, j_path->path_node_cnt(), true, false, hit))) {
+        } else if (expr.arg_cnt_ == 2 && OB_FAIL(ObJsonExprHelper::seek_single_path(j_base, *j_path, hit))) {
+          LOG_WARN("json seek failed", K(path_text), K(ret));
+        } else if (expr.arg_cnt_ > 2 && OB_FAIL(j_base->seek(*j_path, j_path->path_node_cnt(), true, false, hit))) {
           LOG_WARN("json seek failed", K(path_text), K(ret));
         } else {
           if (j_path->can_match_many()) {
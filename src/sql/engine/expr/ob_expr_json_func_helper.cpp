@@ -329,6 +329,26 @@ int ObJsonExprHelper::find_and_add_cache(ObJsonPathCache* path_cache, ObJsonPath
   return ret;
 }
 
+int ObJsonExprHelper::seek_single_path(ObIJsonBase *j_base, ObJsonPath &j_path, ObJsonBaseVector &hit)
+{
+  INIT_SUCC(ret);
+  bool is_found = false;
+  if (OB_ISNULL(j_base)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("json doc is null", K(ret));
+  } else if (!j_base->is_bin() || !j_path.is_simple_path()) {
+    if (OB_FAIL(j_base->seek(j_path, j_path.path_node_cnt(), true, false, hit))) {
+      LOG_WARN("json seek failed", K(ret));
+    }
+  } else if (OB_FAIL(static_cast<ObJsonBin *>(j_base)->seek_simple_path(j_path,
+                     j_path.path_node_cnt(), true, is_found))) {
+    LOG_WARN("json seek simple path failed", K(ret));
+  } else if (is_found && OB_FAIL(hit.push_back(j_base))) {
+    LOG_WARN("fail to push back hit node", K(ret));
+  }
+  return ret;
+}
+
 bool ObJsonExprHelper::is_convertible_to_json(ObObjType &type)
 {
   bool val = false;
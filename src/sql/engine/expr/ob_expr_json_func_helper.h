@@ -109,6 +109,13 @@ public:
 
   static ObJsonPathCache* get_path_cache_ctx(const uint64_t& id, ObExecContext *exec_ctx);
 
+  /*
+  seek json doc with the only path of it, same as seek(path, path_node_cnt, true, false, hit).
+  binary doc with simple path is seeked in place without creating sub binary for each step,
+  so j_base itself may be the hit node and must not be seeked again.
+  */
+  static int seek_single_path(ObIJsonBase *j_base, ObJsonPath &j_path, ObJsonBaseVector &hit);
+
   static int is_json_zero(const ObString& data, int& result);
   
   /*
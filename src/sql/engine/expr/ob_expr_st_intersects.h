@@ -33,6 +33,8 @@ public:
   virtual int cg_expr(ObExprCGCtx &expr_cg_ctx,
                       const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const override;
+  // cache geometry of const param across rows
+  virtual bool need_rt_ctx() const override { return true; }
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExprSTIntersects);
 };
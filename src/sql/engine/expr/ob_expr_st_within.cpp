@@ -103,6 +103,8 @@ int ObExprSTWithin::eval_st_within(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &
     ObString wkb2 = gis_datum2->get_string();
     omt::ObSrsCacheGuard srs_guard;
     const ObSrsItem *srs = NULL;
+    ObGeoConstParamCache *const_cache = NULL;
+    bool may_satisfy = true;
 
     if (OB_FAIL(ObTextStringHelper::read_real_string_data(temp_allocator, *gis_datum1,
               gis_arg1->datum_meta_, gis_arg1->obj_meta_.has_lob_header(), wkb1))) {
@@ -122,15 +124,24 @@ int ObExprSTWithin::eval_st_within(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &
       ret = OB_ERR_GIS_DIFFERENT_SRIDS;
     } else if (OB_FAIL(ObGeoExprUtils::get_srs_item(ctx, srs_guard, wkb1, srs, true))) {
       LOG_WARN("fail to get srs item", K(ret), K(wkb1));
-    } else if (OB_FAIL(ObGeoExprUtils::build_geometry(temp_allocator, wkb1, geo1, srs, N_ST_WITHIN))) {
-      LOG_WARN("get first geo by wkb failed", K(ret));
-    } else if (OB_FAIL(ObGeoExprUtils::build_geometry(temp_allocator, wkb2, geo2, srs, N_ST_WITHIN))) {
-      LOG_WARN("get second geo by wkb failed", K(ret));
+    } else if (OB_FAIL(ObGeoExprUtils::build_relation_geometry(expr, ctx, temp_allocator, wkb1, wkb2,
+                                                               srs, N_ST_WITHIN, geo1, geo2, const_cache))) {
+      LOG_WARN("build geos by wkb failed", K(ret));
     } else if (OB_FAIL(ObGeoExprUtils::check_empty(geo1, is_geo1_empty))
         || OB_FAIL(ObGeoExprUtils::check_empty(geo2, is_geo2_empty))) {
       LOG_WARN("check geo empty failed", K(ret));
     } else if (is_geo1_empty || is_geo2_empty) {
       res.set_null();
+    } else if (OB_NOT_NULL(const_cache)
+               && OB_FAIL(const_cache->check_mbr(temp_allocator,
+                                                 0 == const_cache->get_param_idx() ? *geo2 : *geo1,
+                                                 0 == const_cache->get_param_idx() ?
+                                                   ObGeoRelationType::T_COVEREDBY : ObGeoRelationType::T_COVERS,
+                                                 may_satisfy))) {
+      LOG_WARN("check mbr of const geo failed", K(ret));
+    } else if (!may_satisfy) {
+      // geo1 within geo2 requires mbr of geo1 within mbr of geo2
+      res.set_bool(false);
     } else if (OB_FAIL(ObGeoExprUtils::zoom_in_geos_for_relation(*geo1, *geo2))) {
       LOG_WARN("zoom in geos failed", K(ret));
     } else {
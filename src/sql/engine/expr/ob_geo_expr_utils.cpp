@@ -26,6 +26,7 @@
 #include "lib/geo/ob_geo_check_empty_visitor.h"
 #include "lib/geo/ob_geo_latlong_check_visitor.h"
 #include "lib/geo/ob_geo_zoom_in_visitor.h"
+#include "lib/geo/ob_geo_func_envelope.h"
 
 using namespace oceanbase::common;
 namespace oceanbase
@@ -690,6 +691,131 @@ int ObGeoExprUtils::zoom_in_geos_for_relation(ObGeometry &geo1, ObGeometry &geo2
   return ret;
 }
 
+int ObGeoExprUtils::build_relation_geometry(const ObExpr &expr,
+                                            ObEvalCtx &ctx,
+                                            ObIAllocator &allocator,
+                                            const ObString &wkb1,
+                                            const ObString &wkb2,
+                                            const ObSrsItem *srs,
+                                            const char *func_name,
+                                            ObGeometry *&geo1,
+                                            ObGeometry *&geo2,
+                                            ObGeoConstParamCache *&cache)
+{
+  int ret = OB_SUCCESS;
+  int64_t const_idx = OB_INVALID_INDEX;
+  cache = NULL;
+  if (ObExpr::INVALID_EXP_CTX_ID == expr.expr_ctx_id_ || 2 != expr.arg_cnt_
+      || (OB_NOT_NULL(srs) && ObSrsType::PROJECTED_SRS != srs->srs_type())) {
+    // not cached
+  } else if (expr.args_[1]->is_static_const_) {
+    const_idx = 1;
+  } else if (expr.args_[0]->is_static_const_) {
+    const_idx = 0;
+  }
+
+  if (OB_INVALID_INDEX == const_idx) {
+  } else if (OB_NOT_NULL(cache = static_cast<ObGeoConstParamCache *>(
+                         ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_)))) {
+  } else if (OB_FAIL(ctx.exec_ctx_.create_expr_op_ctx(expr.expr_ctx_id_, cache))) {
+    LOG_WARN("create geo const param cache failed", K(ret), K(expr.expr_ctx_id_));
+  } else if (OB_ISNULL(cache)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("NULL geo const param cache", K(ret));
+  }
+
+  if (OB_FAIL(ret) || OB_ISNULL(cache) || cache->is_inited()) {
+  } else if (OB_FAIL(cache->init(ctx.exec_ctx_.get_allocator(), 0 == const_idx ? wkb1 : wkb2,
+                                 const_idx, srs, func_name))) {
+    LOG_WARN("init geo const param cache failed", K(ret), K(const_idx));
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_NOT_NULL(cache) && 0 == cache->get_param_idx()) {
+    geo1 = cache->get_geo();
+  } else if (OB_FAIL(build_geometry(allocator, wkb1, geo1, srs, func_name))) {
+    LOG_WARN("get first geo by wkb failed", K(ret));
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_NOT_NULL(cache) && 1 == cache->get_param_idx()) {
+    geo2 = cache->get_geo();
+  } else if (OB_FAIL(build_geometry(allocator, wkb2, geo2, srs, func_name))) {
+    LOG_WARN("get second geo by wkb failed", K(ret));
+  }
+  return ret;
+}
+
+int ObGeoConstParamCache::init(ObIAllocator &allocator,
+                               const ObString &wkb,
+                               const int64_t param_idx,
+                               const ObSrsItem *srs,
+                               const char *func_name)
+{
+  int ret = OB_SUCCESS;
+  if (is_inited_) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret), KPC(this));
+  } else if (OB_FAIL(ObGeoExprUtils::build_geometry(allocator, wkb, geo_, srs, func_name))) {
+    LOG_WARN("build const geo by wkb failed", K(ret), K(param_idx));
+  } else if (OB_FAIL(ObGeoExprUtils::check_empty(geo_, is_empty_))) {
+    LOG_WARN("check geo empty failed", K(ret));
+  } else if (!is_empty_) {
+    ObGeoEvalCtx gis_context(&allocator, srs);
+    if (OB_FAIL(gis_context.append_geo_arg(geo_))) {
+      LOG_WARN("build gis context failed", K(ret), K(gis_context.get_geo_count()));
+    } else if (OB_FAIL(ObGeoFuncEnvelope::eval(gis_context, mbr_))) {
+      LOG_WARN("get mbr of const geo failed", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    param_idx_ = param_idx;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObGeoConstParamCache::check_mbr(ObIAllocator &allocator,
+                                    const ObGeometry &geo,
+                                    const ObGeoRelationType rel_type,
+                                    bool &may_satisfy) const
+{
+  int ret = OB_SUCCESS;
+  ObCartesianBox const_mbr = mbr_;
+  ObCartesianBox other_mbr;
+  ObGeoEvalCtx gis_context(&allocator, NULL);
+  may_satisfy = true;
+  if (!is_inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (is_empty_ || const_mbr.is_empty()) {
+    // empty geo is handled by caller
+  } else if (OB_FAIL(gis_context.append_geo_arg(&geo))) {
+    LOG_WARN("build gis context failed", K(ret), K(gis_context.get_geo_count()));
+  } else if (OB_FAIL(ObGeoFuncEnvelope::eval(gis_context, other_mbr))) {
+    LOG_WARN("get mbr of geo failed", K(ret));
+  } else if (other_mbr.is_empty()) {
+  } else {
+    switch (rel_type) {
+      case ObGeoRelationType::T_INTERSECTS: {
+        may_satisfy = const_mbr.Intersects(other_mbr);
+        break;
+      }
+      case ObGeoRelationType::T_COVERS: {
+        may_satisfy = const_mbr.Contains(other_mbr);
+        break;
+      }
+      case ObGeoRelationType::T_COVEREDBY: {
+        may_satisfy = other_mbr.Contains(const_mbr);
+        break;
+      }
+      default: {
+        break;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObGeoExprUtils::pack_geo_res(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res, const ObString &str)
 {
   int ret = OB_SUCCESS;
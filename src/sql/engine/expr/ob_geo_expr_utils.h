@@ -25,6 +25,8 @@
 #include "share/ob_i_sql_expression.h" // for ObExprCtx
 #include "observer/omt/ob_tenant_srs_mgr.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_operator.h" // for ObExprOperatorCtx
+#include "lib/geo/ob_geo_tree.h" // for ObCartesianBox
 
 namespace oceanbase
 {
@@ -39,6 +41,8 @@ enum class ObGeoAxisOrder
   INVALID = 3,
 };
 
+class ObGeoConstParamCache;
+
 class ObGeoExprUtils
 {
 public:
@@ -110,11 +114,62 @@ public:
                         uint32_t srs_id = 0);
   static void geo_func_error_handle(int ret, const char* func_name);
   static int zoom_in_geos_for_relation(common::ObGeometry &geo1, common::ObGeometry &geo2);
+  // build geometries of binary relation exprs, the geometry of param which is const during
+  // the whole execution is built only once and got from cache, cache is NULL if not cached.
+  static int build_relation_geometry(const ObExpr &expr,
+                                     ObEvalCtx &ctx,
+                                     common::ObIAllocator &allocator,
+                                     const common::ObString &wkb1,
+                                     const common::ObString &wkb2,
+                                     const common::ObSrsItem *srs,
+                                     const char *func_name,
+                                     common::ObGeometry *&geo1,
+                                     common::ObGeometry *&geo2,
+                                     ObGeoConstParamCache *&cache);
 
   static int pack_geo_res(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res, const ObString &str);
 
 };
 
+// Geometry of the const param of binary relation exprs(e.g. query shape of spatial index lookup),
+// it's built from wkb only once and reused by all candidate rows, so is its mbr which filters out
+// rows before boost evaluation. Geographic geometries are zoomed in with the other param, only
+// cartesian geometry is cached.
+class ObGeoConstParamCache : public ObExprOperatorCtx
+{
+public:
+  ObGeoConstParamCache()
+    : ObExprOperatorCtx(),
+      is_inited_(false),
+      param_idx_(common::OB_INVALID_INDEX),
+      geo_(NULL),
+      is_empty_(false),
+      mbr_()
+  {}
+  virtual ~ObGeoConstParamCache() {}
+  int init(common::ObIAllocator &allocator,
+           const common::ObString &wkb,
+           const int64_t param_idx,
+           const common::ObSrsItem *srs,
+           const char *func_name);
+  bool is_inited() const { return is_inited_; }
+  int64_t get_param_idx() const { return param_idx_; }
+  common::ObGeometry *get_geo() const { return geo_; }
+  // check by mbr whether geo of the other param may satisfy the relation,
+  // rel_type is from the view of const geo, e.g. T_COVERS means const geo covers the other.
+  int check_mbr(common::ObIAllocator &allocator,
+                const common::ObGeometry &geo,
+                const common::ObGeoRelationType rel_type,
+                bool &may_satisfy) const;
+  TO_STRING_KV(K_(is_inited), K_(param_idx), K_(is_empty), K_(mbr));
+private:
+  bool is_inited_;
+  int64_t param_idx_;
+  common::ObGeometry *geo_;
+  bool is_empty_;
+  common::ObCartesianBox mbr_;
+};
+
 } // sql
 } // oceanbase
 #endif // OCEANBASE_SQL_OB_GEO_EXPR_UTILS_H_
\ No newline at end of file
@@ -25,6 +25,38 @@ using namespace common;
 const ObBitStream::BS_WORD ObBitStream::bit_mask_table_[] = {
   0x0, 0x1, 0x3, 0x7, 0xf, 0x1f, 0x3f, 0x7f, 0xff };
 
+bool init_bit_stream_simd_unpack_func();
+
+ObBitStream::batch_unpack_func ObBitStream::batch_unpack_func_ = &ObBitStream::batch_unpack_scalar;
+
+static bool bit_stream_simd_unpack_func_inited = init_bit_stream_simd_unpack_func();
+
+void ObBitStream::batch_unpack_scalar(
+    const unsigned char *buf,
+    const int64_t buf_len,
+    const int64_t offset,
+    const int64_t packed_len,
+    const int64_t cnt,
+    uint64_t *values)
+{
+  int64_t pos = offset;
+  int64_t i = 0;
+  if (packed_len <= 64 - CHAR_BIT + 1) {
+    // one unaligned 8 bytes load covers the value
+    const uint64_t mask = (1UL << packed_len) - 1;
+    for (; i < cnt && (pos >> 3) + static_cast<int64_t>(sizeof(uint64_t)) <= buf_len;
+        ++i, pos += packed_len) {
+      uint64_t v = 0;
+      MEMCPY(&v, buf + (pos >> 3), sizeof(v));
+      values[i] = (v >> (pos & 7)) & mask;
+    }
+  }
+  // tail of buffer or values wider than 57 bits
+  for (; i < cnt; ++i, pos += packed_len) {
+    get(buf, pos, packed_len, values[i]);
+  }
+}
+
 
 } // end namespace blocksstable
 } // end namespace oceanbase
@@ -70,6 +70,36 @@ public:
     return get(buf, offset, cnt, *reinterpret_cast<int64_t *>(&value));
   }
 
+  // performance critical, do not check parameters.
+  // Unpack %cnt continuous values of %packed_len bits starting at bit %offset of %buf into
+  // %values, %buf_len is the readable byte length of %buf.
+  typedef void (*batch_unpack_func)(
+      const unsigned char *buf,
+      const int64_t buf_len,
+      const int64_t offset,
+      const int64_t packed_len,
+      const int64_t cnt,
+      uint64_t *values);
+  OB_INLINE static void batch_unpack(
+      const unsigned char *buf,
+      const int64_t buf_len,
+      const int64_t offset,
+      const int64_t packed_len,
+      const int64_t cnt,
+      uint64_t *values)
+  {
+    batch_unpack_func_(buf, buf_len, offset, packed_len, cnt, values);
+  }
+  static void batch_unpack_scalar(
+      const unsigned char *buf,
+      const int64_t buf_len,
+      const int64_t offset,
+      const int64_t packed_len,
+      const int64_t cnt,
+      uint64_t *values);
+  // dispatched to SIMD version if supported by CPU
+  static batch_unpack_func batch_unpack_func_;
+
   bool is_init() const { return NULL != data_; }
 
   const static BS_WORD bit_mask_table_[BS_WORD_BIT + 1];
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_bit_stream.h"
+#include "ob_encoding_query_util.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+#if defined ( __AVX2__ )
+// Unpack 8 values of no more than 25 bits or 4 values of no more than 57 bits at a time
+// by gathering the unaligned words covering each value and shifting them per lane.
+static void bit_stream_batch_unpack_avx2(
+    const unsigned char *buf,
+    const int64_t buf_len,
+    const int64_t offset,
+    const int64_t packed_len,
+    const int64_t cnt,
+    uint64_t *values)
+{
+  int64_t pos = offset;
+  int64_t i = 0;
+  if (packed_len <= 32 - CHAR_BIT + 1) {
+    const __m256i lane_pos = _mm256_mullo_epi32(
+        _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int32_t>(packed_len)));
+    const __m256i mask = _mm256_set1_epi32(static_cast<int32_t>((1U << packed_len) - 1));
+    const __m256i byte_mask = _mm256_set1_epi32(7);
+    for (; i + 8 <= cnt; i += 8, pos += 8 * packed_len) {
+      if (((pos + 7 * packed_len) >> 3) + static_cast<int64_t>(sizeof(uint32_t)) > buf_len) {
+        break;
+      }
+      const __m256i bit_pos = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int32_t>(pos & 7)), lane_pos);
+      const __m256i words = _mm256_i32gather_epi32(
+          reinterpret_cast<const int *>(buf + (pos >> 3)), _mm256_srli_epi32(bit_pos, 3), 1);
+      const __m256i vals = _mm256_and_si256(
+          _mm256_srlv_epi32(words, _mm256_and_si256(bit_pos, byte_mask)), mask);
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i),
+          _mm256_cvtepu32_epi64(_mm256_castsi256_si128(vals)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i + 4),
+          _mm256_cvtepu32_epi64(_mm256_extracti128_si256(vals, 1)));
+    }
+  } else if (packed_len <= 64 - CHAR_BIT + 1) {
+    const __m256i lane_pos = _mm256_setr_epi64x(0, packed_len, 2 * packed_len, 3 * packed_len);
+    const __m256i mask = _mm256_set1_epi64x(static_cast<int64_t>((1UL << packed_len) - 1));
+    const __m256i byte_mask = _mm256_set1_epi64x(7);
+    for (; i + 4 <= cnt; i += 4, pos += 4 * packed_len) {
+      if (((pos + 3 * packed_len) >> 3) + static_cast<int64_t>(sizeof(uint64_t)) > buf_len) {
+        break;
+      }
+      const __m256i bit_pos = _mm256_add_epi64(_mm256_set1_epi64x(pos & 7), lane_pos);
+      const __m256i words = _mm256_i64gather_epi64(
+          reinterpret_cast<const long long *>(buf + (pos >> 3)), _mm256_srli_epi64(bit_pos, 3), 1);
+      const __m256i vals = _mm256_and_si256(
+          _mm256_srlv_epi64(words, _mm256_and_si256(bit_pos, byte_mask)), mask);
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i), vals);
+    }
+  }
+  if (i < cnt) {
+    ObBitStream::batch_unpack_scalar(buf, buf_len, pos, packed_len, cnt - i, values + i);
+  }
+}
+#endif
+
+bool init_bit_stream_simd_unpack_func()
+{
+  bool res = false;
+#if defined ( __AVX2__ )
+  // ob_storage_simd is built with avx512 flags, the compiler may emit avx512 instructions here
+  if (is_avx512_valid()) {
+    ObBitStream::batch_unpack_func_ = &bit_stream_batch_unpack_avx2;
+    res = true;
+  }
+#endif
+  return res;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
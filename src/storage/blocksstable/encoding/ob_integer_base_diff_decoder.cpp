@@ -134,7 +134,12 @@ int ObIntegerBaseDiffDecoder::batch_get_bitpacked_values(
 {
   int ret = OB_SUCCESS;
   int64_t packed_len = header_->length_;
-  if (packed_len < 10) {
+  if (row_cap > 1 && row_ids[row_cap - 1] - row_ids[0] + 1 == row_cap) {
+    if (OB_FAIL(batch_unpack_continuous_values(
+        ctx, row_ids[0], row_cap, datum_len, data_offset, datums))) {
+      LOG_WARN("Failed to unpack continuous values", K(ret), K(row_cap));
+    }
+  } else if (packed_len < 10) {
     INT_DIFF_UNPACK_VALUES(
         ctx, row_ids, row_cap, datums, datum_len,
         data_offset, ObBitStream::PACKED_LEN_LESS_THAN_10)
@@ -154,6 +159,44 @@ int ObIntegerBaseDiffDecoder::batch_get_bitpacked_values(
 
 #undef INT_DIFF_UNPACK_REFS
 
+int ObIntegerBaseDiffDecoder::batch_unpack_continuous_values(
+    const ObColumnDecoderCtx &ctx,
+    const int64_t start_row_id,
+    const int64_t row_cap,
+    const int64_t datum_len,
+    const int64_t data_offset,
+    common::ObDatum *datums) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t packed_len = header_->length_;
+  if (OB_UNLIKELY(packed_len <= 0 || packed_len > 64)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected packed length", K(ret), K(packed_len));
+  } else {
+    const bool has_ext_val = ctx.has_extend_value();
+    const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+                                    + ctx.col_header_->length_;
+    const int64_t data_len = get_bit_packed_data_len(ctx, data_offset);
+    uint64_t deltas[UNPACK_BATCH_SIZE];
+    for (int64_t start = 0; start < row_cap; start += UNPACK_BATCH_SIZE) {
+      const int64_t cnt = MIN(UNPACK_BATCH_SIZE, row_cap - start);
+      ObBitStream::batch_unpack(col_data, data_len,
+          data_offset + (start_row_id + start) * packed_len, packed_len, cnt, deltas);
+      ObDatum *cur_datums = datums + start;
+      for (int64_t i = 0; i < cnt; ++i) {
+        if (has_ext_val && cur_datums[i].is_null()) {
+          // Skip
+        } else {
+          const uint64_t value = deltas[i] + base_;
+          MEMCPY(const_cast<char *>(cur_datums[i].ptr_), &value, datum_len);
+          cur_datums[i].pack_ = static_cast<uint32_t>(datum_len);
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 // Internal call, not check parameters for performance
 // Potential optimization: SIMD batch add @base_ to packed delta values
 int ObIntegerBaseDiffDecoder::batch_decode(
@@ -396,20 +439,22 @@ int ObIntegerBaseDiffDecoder::comparison_operator(
 
       if (OB_FAIL(ret)) {
       } else if (col_ctx.is_bit_packing()) {
-        for (int64_t row_id = 0;
-            OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
-            ++row_id) {
-          if (exist_parent_filter && parent->can_skip_filter(row_id)) {
-          } else if (null_value_contained && result_bitmap.test(row_id)) {
-            if (OB_FAIL(result_bitmap.set(row_id, false))) {
-              LOG_WARN("Failed to set row with null object to false", K(ret));
-            }
-          } else if (OB_FAIL(ObBitStream::get(
-                col_data, data_offset + row_id * cell_len, cell_len, delta_value))) {
-              LOG_WARN("Failed to get bit packing value", K(ret), K_(header));
-          } else {
-            bool cmp_result = fp_int_cmp<uint64_t>(delta_value, param_delta_value, cmp_op_type);
-            if (cmp_result) {
+        // compare on the unpacked deltas directly, no need to add base back
+        const int64_t row_count = col_ctx.micro_block_header_->row_count_;
+        const int64_t data_len = get_bit_packed_data_len(col_ctx, data_offset);
+        uint64_t deltas[UNPACK_BATCH_SIZE];
+        for (int64_t start = 0; OB_SUCC(ret) && start < row_count; start += UNPACK_BATCH_SIZE) {
+          const int64_t cnt = MIN(UNPACK_BATCH_SIZE, row_count - start);
+          ObBitStream::batch_unpack(
+              col_data, data_len, data_offset + start * cell_len, cell_len, cnt, deltas);
+          for (int64_t i = 0; OB_SUCC(ret) && i < cnt; ++i) {
+            const int64_t row_id = start + i;
+            if (exist_parent_filter && parent->can_skip_filter(row_id)) {
+            } else if (null_value_contained && result_bitmap.test(row_id)) {
+              if (OB_FAIL(result_bitmap.set(row_id, false))) {
+                LOG_WARN("Failed to set row with null object to false", K(ret));
+              }
+            } else if (fp_int_cmp<uint64_t>(deltas[i], param_delta_value, cmp_op_type)) {
               if (OB_FAIL(result_bitmap.set(row_id))) {
                 LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(filter));
               }
@@ -543,9 +588,14 @@ int ObIntegerBaseDiffDecoder::traverse_all_data(
   }
   bool null_value_contained = (result_bitmap.popcnt() > 0);
   bool exist_parent_filter = nullptr != parent;
-  for (int64_t row_id = 0;
-       OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
-       ++row_id) {
+  const int64_t row_count = col_ctx.micro_block_header_->row_count_;
+  const int64_t data_len = col_ctx.is_bit_packing() ? get_bit_packed_data_len(col_ctx, data_offset) : 0;
+  uint64_t deltas[UNPACK_BATCH_SIZE];
+  for (int64_t row_id = 0; OB_SUCC(ret) && row_id < row_count; ++row_id) {
+    if (col_ctx.is_bit_packing() && 0 == row_id % UNPACK_BATCH_SIZE) {
+      ObBitStream::batch_unpack(col_data, data_len, data_offset + row_id * cell_len, cell_len,
+          MIN(UNPACK_BATCH_SIZE, row_count - row_id), deltas);
+    }
     if (exist_parent_filter && parent->can_skip_filter(row_id)) {
       continue;
     } else if (null_value_contained && result_bitmap.test(row_id)) {
@@ -554,9 +604,7 @@ int ObIntegerBaseDiffDecoder::traverse_all_data(
       }
     } else {
       if (col_ctx.is_bit_packing()) {
-        if (OB_FAIL(ObBitStream::get(col_data, data_offset + row_id * cell_len, cell_len, v))) {
-          LOG_WARN("Failed to get bit packing value", K(ret), K_(header));
-        }
+        v = deltas[row_id % UNPACK_BATCH_SIZE];
       } else {
         MEMCPY(&v, col_data + data_offset + row_id * cell_len, cell_len);
       }
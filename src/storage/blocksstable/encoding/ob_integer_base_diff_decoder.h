@@ -31,6 +31,8 @@ class ObIntegerBaseDiffDecoder : public ObIColumnDecoder
 {
 public:
   static const ObColumnHeader::Type type_ = ObColumnHeader::INTEGER_BASE_DIFF;
+  // bit packed deltas are unpacked in batch of this size for continuous rows
+  static const int64_t UNPACK_BATCH_SIZE = 256;
   ObIntegerBaseDiffDecoder() : header_(NULL), base_(0)
   {}
   virtual ~ObIntegerBaseDiffDecoder() {}
@@ -81,6 +83,22 @@ private:
       const int64_t data_offset,
       common::ObDatum *datums) const;
 
+  int batch_unpack_continuous_values(
+      const ObColumnDecoderCtx &ctx,
+      const int64_t start_row_id,
+      const int64_t row_cap,
+      const int64_t datum_len,
+      const int64_t data_offset,
+      common::ObDatum *datums) const;
+
+  // readable byte length of the extend value bits and bit packed deltas
+  OB_INLINE int64_t get_bit_packed_data_len(
+      const ObColumnDecoderCtx &ctx, const int64_t data_offset) const
+  {
+    return (data_offset + ctx.micro_block_header_->row_count_ * header_->length_ + CHAR_BIT - 1)
+        / CHAR_BIT;
+  }
+
   template <typename T>
   inline int get_delta(const common::ObObj &cell, uint64_t &delta) const
   {
@@ -195,11 +195,10 @@ int ObIntegerBaseDiffEncoder::traverse(bool &suitable)
         if (!bit_packing) {
           orig_size *= CHAR_BIT;
         }
-        bit_packing = false;
-        int64_t delta_size = get_packing_size(bit_packing, delta);
-        if (!bit_packing) {
-          delta_size *= CHAR_BIT;
-        }
+        // bit packed deltas are unpacked in batch by decoder, always use the exact bit width
+        // unless it is byte aligned.
+        int64_t delta_size = sizeof(delta) * CHAR_BIT - __builtin_clzl(delta);
+        bit_packing = 0 != delta_size % CHAR_BIT;
         LOG_DEBUG("integer base diff size", K_(column_index), K(delta_size), K(orig_size));
         if ((orig_size - delta_size) * rows_->count()
             > (sizeof(*header_) + type_store_size_) * CHAR_BIT) {
@@ -647,7 +647,12 @@ int ObMicroBlockEncoder::build_block(char *&buf, int64_t &size)
         if (ObColumnHeader::STRING_PREFIX == pe.type_) {
           pe.last_prefix_length_ = col_ctxs_.at(idx).last_prefix_length_;
         }
-        if (idx < ctx_.previous_encodings_.count()) {
+        if (!ctx_.adaptive_detection_) {
+        } else if (OB_FAIL(update_encoding_history(idx, pe, *e))) {
+          LOG_WARN("failed to update encoding history", K(ret), K(idx), K(pe));
+        }
+        if (OB_FAIL(ret)) {
+        } else if (idx < ctx_.previous_encodings_.count()) {
           if (OB_FAIL(ctx_.previous_encodings_.at(idx).put(pe))) {
             LOG_WARN("failed to store previous encoding", K(ret), K(idx), K(pe));
           }
@@ -1478,6 +1483,12 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
   } else if (OB_UNLIKELY(column_idx < 0 || column_idx >= ctx_.column_cnt_)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid column_idx", K(column_idx), K(ret));
+  } else if (OB_FAIL(try_history_encoder(e, column_idx, cc))) {
+    LOG_WARN("try history encoder failed", K(ret), K(column_idx));
+  } else if (NULL != e) {
+    if (OB_FAIL(add_chosen_encoder(column_idx, e))) {
+      LOG_WARN("add chosen encoder failed", K(ret), K(column_idx));
+    }
   } else if (OB_FAIL(try_encoder<ObRawEncoder>(e, column_idx))) {
     LOG_WARN("try raw encoder failed", K(ret));
   } else if (NULL == e) {
@@ -1665,23 +1676,107 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
     }
 
     if (OB_SUCC(ret)) {
-      LOG_DEBUG("used encoder", K(column_idx),
-          "column_header", choose->get_column_header(),
-          "data_desc", choose->get_desc());
-      if (ObColumnHeader::is_inter_column_encoder(choose->get_type())) {
-        const int64_t ref_col_idx = static_cast<ObSpanColumnEncoder *>(choose)->get_ref_col_idx();
-        col_ctxs_.at(ref_col_idx).is_refed_ = true;
-        LOG_DEBUG("column reference", K(column_idx), K(ref_col_idx));
-      }
-      if (OB_FAIL(encoders_.push_back(choose))) {
-        LOG_WARN("push back encoder failed");
+      if (OB_FAIL(add_chosen_encoder(column_idx, choose))) {
+        LOG_WARN("add chosen encoder failed", K(ret), K(column_idx));
       }
+    } else if (NULL != choose) {
+      free_encoder(choose);
+      choose = NULL;
     }
-    if (OB_FAIL(ret)) {
-      if (NULL != choose) {
-        free_encoder(choose);
-        choose = NULL;
+  }
+  return ret;
+}
+
+int ObMicroBlockEncoder::add_chosen_encoder(const int64_t column_idx, ObIColumnEncoder *e)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(e)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(column_idx));
+  } else {
+    LOG_DEBUG("used encoder", K(column_idx),
+        "column_header", e->get_column_header(),
+        "data_desc", e->get_desc());
+    if (ObColumnHeader::is_inter_column_encoder(e->get_type())) {
+      const int64_t ref_col_idx = static_cast<ObSpanColumnEncoder *>(e)->get_ref_col_idx();
+      col_ctxs_.at(ref_col_idx).is_refed_ = true;
+      LOG_DEBUG("column reference", K(column_idx), K(ref_col_idx));
+    }
+    if (OB_FAIL(encoders_.push_back(e))) {
+      LOG_WARN("push back encoder failed");
+      free_encoder(e);
+      e = NULL;
+    }
+  }
+  return ret;
+}
+
+int ObMicroBlockEncoder::try_history_encoder(ObIColumnEncoder *&e,
+    const int64_t column_idx, ObColumnEncodingCtx &cc)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_cnt = datum_rows_.count();
+  e = NULL;
+  if (!ctx_.adaptive_detection_
+      || column_idx >= ctx_.encoding_histories_.count()
+      || nullptr == cc.ht_
+      || row_cnt <= 0) {
+    // no history
+  } else {
+    const ObColumnEncodingHistory &history = ctx_.encoding_histories_.at(column_idx);
+    const int64_t distinct_pct = cc.ht_->distinct_cnt() * 100 / row_cnt;
+    const int64_t null_pct = cc.null_cnt_ * 100 / row_cnt;
+    if (!history.can_reuse(distinct_pct, null_pct)) {
+      // not stable or data shifted, detect again
+    } else if (OB_FAIL(try_previous_encoder(e, column_idx, history.encoding_))) {
+      LOG_WARN("try history encoding failed", K(ret), K(column_idx), K(history));
+    } else if (NULL == e) {
+      // not suitable for current data
+    } else if (!history.is_size_acceptable(e->calc_size() * 1000 / row_cnt)) {
+      free_encoder(e);
+      e = NULL;
+    } else {
+      cc.reuse_history_ = true;
+      cc.detected_encoders_[history.encoding_.type_] = true;
+      LOG_DEBUG("choose encoding by history", K(column_idx), K(history));
+    }
+  }
+  return ret;
+}
+
+int ObMicroBlockEncoder::update_encoding_history(const int64_t column_idx,
+    const ObPreviousEncoding &pe, const ObIColumnEncoder &e)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_cnt = datum_rows_.count();
+  const ObColumnEncodingCtx &cc = col_ctxs_.at(column_idx);
+  if (column_idx >= ctx_.encoding_histories_.count()) {
+    ObColumnEncodingHistory history;
+    if (OB_UNLIKELY(column_idx != ctx_.encoding_histories_.count())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected column idx of encoding history", K(ret), K(column_idx),
+          "history_count", ctx_.encoding_histories_.count());
+    } else if (OB_FAIL(ctx_.encoding_histories_.push_back(history))) {
+      LOG_WARN("push back encoding history failed", K(ret), K(column_idx));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    ObColumnEncodingHistory &history = ctx_.encoding_histories_.at(column_idx);
+    if (nullptr == cc.ht_ || row_cnt <= 0) {
+      history.reset();
+    } else if (cc.reuse_history_) {
+      ++history.reuse_cnt_;
+    } else {
+      if (history.stable_cnt_ > 0 && history.encoding_ == pe) {
+        ++history.stable_cnt_;
+      } else {
+        history.encoding_ = pe;
+        history.stable_cnt_ = 1;
       }
+      history.reuse_cnt_ = 0;
+      history.distinct_pct_ = cc.ht_->distinct_cnt() * 100 / row_cnt;
+      history.null_pct_ = cc.null_cnt_ * 100 / row_cnt;
+      history.size_per_kilo_rows_ = e.calc_size() * 1000 / row_cnt;
     }
   }
   return ret;
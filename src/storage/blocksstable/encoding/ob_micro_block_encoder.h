@@ -104,6 +104,13 @@ private:
   int fast_encoder_detect(const int64_t column_idx, const ObColumnEncodingCtx &cc);
   int prescan(const int64_t column_index);
   int choose_encoder(const int64_t column_idx, ObColumnEncodingCtx &column_ctx);
+  // reuse the stable encoding of column in previous micro blocks if data does not shift,
+  // %e is NULL if the encoding can not be reused.
+  int try_history_encoder(ObIColumnEncoder *&e, const int64_t column_idx,
+      ObColumnEncodingCtx &column_ctx);
+  int update_encoding_history(const int64_t column_idx, const ObPreviousEncoding &pe,
+      const ObIColumnEncoder &e);
+  int add_chosen_encoder(const int64_t column_idx, ObIColumnEncoder *e);
   void free_encoders();
 
   template <typename T>
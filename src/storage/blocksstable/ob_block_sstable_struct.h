@@ -519,6 +519,47 @@ struct ObPreviousEncodingArray<1>
   TO_STRING_KV(K_(prev_encodings));
 };
 
+// Encoding chosen by full detection for a column in the previous micro blocks, with
+// the data signature of the column at that time. While the choice keeps stable and the
+// signature does not shift, the encoding is reused without trying other encoders.
+struct ObColumnEncodingHistory
+{
+  // continuous micro blocks with the same choice before the choice is reused
+  static const int64_t STABLE_MICRO_BLOCK_CNT = 4;
+  // micro blocks reusing the choice before the next full detection
+  static const int64_t MAX_REUSE_MICRO_BLOCK_CNT = 16;
+  // max shift of distinct / null percent and encoded size percent to reuse the choice
+  static const int64_t MAX_SHIFT_PCT = 20;
+
+  ObPreviousEncoding encoding_;
+  int64_t stable_cnt_;
+  int64_t reuse_cnt_;
+  int64_t distinct_pct_;
+  int64_t null_pct_;
+  int64_t size_per_kilo_rows_;
+
+  ObColumnEncodingHistory() { reset(); }
+  void reset() { MEMSET(this, 0, sizeof(*this)); }
+  OB_INLINE bool can_reuse(const int64_t distinct_pct, const int64_t null_pct) const
+  {
+    return stable_cnt_ >= STABLE_MICRO_BLOCK_CNT
+        && reuse_cnt_ < MAX_REUSE_MICRO_BLOCK_CNT
+        && is_shift_acceptable(distinct_pct, distinct_pct_)
+        && is_shift_acceptable(null_pct, null_pct_);
+  }
+  OB_INLINE static bool is_shift_acceptable(const int64_t pct, const int64_t history_pct)
+  {
+    return pct <= history_pct + MAX_SHIFT_PCT && history_pct <= pct + MAX_SHIFT_PCT;
+  }
+  OB_INLINE bool is_size_acceptable(const int64_t size_per_kilo_rows) const
+  {
+    return size_per_kilo_rows * 100 <= size_per_kilo_rows_ * (100 + MAX_SHIFT_PCT);
+  }
+
+  TO_STRING_KV(K_(encoding), K_(stable_cnt), K_(reuse_cnt), K_(distinct_pct), K_(null_pct),
+      K_(size_per_kilo_rows));
+};
+
 struct ObMicroBlockEncodingCtx
 {
   static const int64_t MAX_PREV_ENCODING_COUNT = 2;
@@ -533,24 +574,29 @@ struct ObMicroBlockEncodingCtx
   mutable int64_t real_block_size_;
   mutable int64_t micro_block_cnt_; // build micro block count
   mutable common::ObArray<ObPreviousEncodingArray<MAX_PREV_ENCODING_COUNT> > previous_encodings_;
+  mutable common::ObArray<ObColumnEncodingHistory> encoding_histories_;
 
   int64_t *column_encodings_;
   int64_t major_working_cluster_version_;
   common::ObRowStoreType row_store_type_;
   bool need_calc_column_chksum_;
+  // reuse the stable encoding of column instead of detecting it for each micro block
+  bool adaptive_detection_;
 
   ObMicroBlockEncodingCtx() : macro_block_size_(0), micro_block_size_(0),
     rowkey_column_cnt_(0), column_cnt_(0), col_descs_(nullptr),
     encoder_opt_(), estimate_block_size_(0), real_block_size_(0), micro_block_cnt_(0),
     column_encodings_(nullptr), major_working_cluster_version_(0),
-    row_store_type_(ENCODING_ROW_STORE), need_calc_column_chksum_(false)
+    row_store_type_(ENCODING_ROW_STORE), need_calc_column_chksum_(false),
+    adaptive_detection_(true)
   {
   }
   bool is_valid() const;
   TO_STRING_KV(K_(macro_block_size), K_(micro_block_size), K_(rowkey_column_cnt),
       K_(column_cnt), KP_(col_descs), K_(estimate_block_size), K_(real_block_size),
       K_(micro_block_cnt), K_(encoder_opt), K_(previous_encodings), KP_(column_encodings),
-      K_(major_working_cluster_version), K_(row_store_type), K_(need_calc_column_chksum));
+      K_(major_working_cluster_version), K_(row_store_type), K_(need_calc_column_chksum),
+      K_(adaptive_detection));
 };
 
 template <typename T, int64_t MAX_COUNT, int64_t BLOCK_SIZE>
@@ -575,6 +621,7 @@ struct ObColumnEncodingCtx
   bool only_raw_encoding_;
   bool is_refed_;
   bool need_sort_;
+  bool reuse_history_; // encoder is chosen by the encoding history
 
   ObColumnEncodingCtx() { reset(); }
   void reset() { memset(this, 0, sizeof(*this)); }
@@ -591,7 +638,7 @@ struct ObColumnEncodingCtx
       K_(extend_value_bit), KP_(col_datums), KP_(ht), KP_(prefix_tree),
       K_(*encoding_ctx), K_(detected_encoders),
       K_(last_prefix_length), K_(max_string_size), K_(only_raw_encoding),
-      K_(is_refed), K_(need_sort));
+      K_(is_refed), K_(need_sort), K_(reuse_history));
 };
 
 struct ObBloomFilterMacroBlockHeader
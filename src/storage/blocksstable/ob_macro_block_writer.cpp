@@ -664,8 +664,22 @@ int ObMacroBlockWriter::append_micro_block(const ObMicroBlock &micro_block, cons
         STORAGE_LOG(WARN, "build_micro_block_desc failed", K(ret), K(micro_block));
       } else if (OB_FAIL(write_micro_block(micro_block_desc))) {
         STORAGE_LOG(WARN, "Failed to write micro block, ", K(ret), K(micro_block_desc));
-      } else if (NULL != data_store_desc_->merge_info_) {
-        data_store_desc_->merge_info_->multiplexed_micro_count_in_new_macro_++;
+      } else if (micro_block_desc.last_rowkey_.get_datum_cnt() != data_store_desc_->rowkey_column_count_) {
+        ret = OB_ERR_SYS;
+        STORAGE_LOG(ERROR, "Rowkey column not match, can not reuse micro block", K(ret),
+            "reused micro block rowkey count", micro_block_desc.last_rowkey_.get_datum_cnt(),
+            "data store descriptor rowkey count", data_store_desc_->rowkey_column_count_);
+      } else if (OB_FAIL(save_last_key(micro_block_desc.last_rowkey_))) {
+        // the following rows are checked against the end key of the reused micro block
+        STORAGE_LOG(WARN, "Fail to save last key", K(ret), K(micro_block_desc.last_rowkey_));
+      } else {
+        if (!data_store_desc_->is_major_merge()) {
+          // minor merge only reuses micro blocks ending with a complete rowkey
+          last_key_with_L_flag_ = micro_block_desc.is_last_row_last_flag_;
+        }
+        if (NULL != data_store_desc_->merge_info_) {
+          data_store_desc_->merge_info_->multiplexed_micro_count_in_new_macro_++;
+        }
       }
     }
   } else {
@@ -978,8 +992,9 @@ int ObMacroBlockWriter::build_micro_block_desc(
   } else if (OB_UNLIKELY(!micro_block.header_.is_valid())) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("expect valid micro header", K(ret), K(micro_block.header_));
-  } else if (micro_block.header_.has_column_checksum_
+  } else if ((micro_block.header_.has_column_checksum_ || !data_store_desc_->is_major_merge())
       && micro_block.micro_index_info_->row_header_->get_schema_version() == data_store_desc_->schema_version_) {
+    // minor sstable does not keep column checksum in micro header, reuse it directly with the same schema
     if (OB_FAIL(build_micro_block_desc_with_reuse(micro_block, micro_block_desc))) {
       LOG_WARN("fail to build micro block desc v3", K(ret), K(micro_block), K(micro_block_desc));
     }
@@ -1023,8 +1038,6 @@ int ObMacroBlockWriter::build_micro_block_desc_with_reuse(
   if (OB_UNLIKELY(!header.is_valid())) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("expect valid micro header", K(ret), K(header));
-  } else if (OB_FAIL(save_last_key(micro_block.range_.get_end_key()))) {
-    LOG_WARN("Fail to save last key, ", K(ret), K(micro_block.range_.get_end_key()));
   } else {
     micro_block_desc.header_ = &header;
     micro_block_desc.last_rowkey_ = micro_block.range_.get_end_key();
@@ -1036,6 +1049,13 @@ int ObMacroBlockWriter::build_micro_block_desc_with_reuse(
     micro_block_desc.has_string_out_row_ = micro_block.micro_index_info_->has_string_out_row();
     micro_block_desc.has_lob_out_row_ = micro_block.micro_index_info_->has_lob_out_row();
     micro_block_desc.original_size_ = header.original_length_;
+    if (!data_store_desc_->is_major_merge()) {
+      // keep the multi-version info of minor micro block for index and macro meta
+      micro_block_desc.max_merged_trans_version_ = header.max_merged_trans_version_;
+      micro_block_desc.row_count_delta_ = static_cast<int32_t>(micro_block.micro_index_info_->get_row_count_delta());
+      micro_block_desc.contain_uncommitted_row_ = micro_block.micro_index_info_->contain_uncommitted_row();
+      micro_block_desc.is_last_row_last_flag_ = header.is_last_row_last_flag();
+    }
   }
   STORAGE_LOG(DEBUG, "build micro block desc reuse", K(data_store_desc_->tablet_id_), K(micro_block_desc), "lbt", lbt(), K(ret));
   return ret;
@@ -1077,8 +1097,6 @@ int ObMacroBlockWriter::build_micro_block_desc_with_rewrite(
       LOG_WARN("fail to decrypt and decompress data", K(ret));
     } else if (OB_FAIL(reader->init(decompressed_data, *micro_block.read_info_))) {
       LOG_WARN("reader init failed", K(micro_block), K(ret));
-    } else if (OB_FAIL(save_last_key(micro_block.range_.get_end_key()))) {
-      LOG_WARN("Fail to save last key, ", K(ret), K(micro_block.range_.get_end_key()));
     } else {
       micro_block_desc.header_ = &header;
       micro_block_desc.buf_ = micro_block.payload_data_.get_buf() + header.header_size_; // get original data_buf
@@ -1348,6 +1366,9 @@ int ObMacroBlockWriter::check_micro_block_need_merge(
   if (!micro_block.is_valid()) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "invalid micro_block", K(micro_block), K(ret));
+  } else if (!data_store_desc_->is_major_merge()) {
+    // rows of minor micro block carry multi-version flags, always reuse it as a whole
+    need_merge = false;
   } else {
     if (micro_writer_->get_row_count() <= 0
         && micro_block.header_.data_length_ > data_store_desc_->micro_block_size_ / 2) {
@@ -1404,6 +1404,10 @@ int ObMultiVersionMicroBlockMinorMergeRowScanner::init(
         read_info_->get_schema_rowkey_count(), true);
     sql_sequence_col_idx_ = ObMultiVersionRowkeyHelpper::get_sql_sequence_col_store_index(
         read_info_->get_schema_rowkey_count(), true);
+    // the decided state is only valid for the merge scn of current context
+    decided_trans_id_.reset();
+    decided_trans_state_ = ObTxData::RUNNING;
+    decided_trans_version_ = INT64_MAX;
     if (OB_FAIL(init_row_queue(read_info_->get_request_count()))) {
       LOG_WARN("Fail to init row queue", K(ret), K(read_info_->get_request_count()));
     } else {
@@ -2069,11 +2073,21 @@ int ObMultiVersionMicroBlockMinorMergeRowScanner::get_trans_state(
   SCN scn_commit_trans_version = SCN::max_scn();
   auto &tx_table_guard = context_->store_ctx_->mvcc_acc_ctx_.get_tx_table_guard();
   int64_t read_epoch = tx_table_guard.epoch();;
-  if (OB_FAIL(tx_table_guard.get_tx_table()->get_tx_state_with_scn(
+  if (decided_trans_id_.is_valid() && trans_id == decided_trans_id_) {
+    // rows of one transaction are usually clustered in the same micro blocks,
+    // the decided state will not change at the same merge scn
+    state = decided_trans_state_;
+    commit_trans_version = decided_trans_version_;
+  } else if (OB_FAIL(tx_table_guard.get_tx_table()->get_tx_state_with_scn(
       trans_id, context_->merge_scn_, read_epoch, state, scn_commit_trans_version))) {
     LOG_WARN("get transaction status failed", K(ret), K(trans_id), K(state));
   } else {
     commit_trans_version = scn_commit_trans_version.get_val_for_tx();
+    if (ObTxData::COMMIT == state || ObTxData::ABORT == state) {
+      decided_trans_id_ = trans_id;
+      decided_trans_state_ = state;
+      decided_trans_version_ = commit_trans_version;
+    }
   }
   return ret;
 }
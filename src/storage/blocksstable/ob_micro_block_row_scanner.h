@@ -19,6 +19,7 @@
 #include "storage/blocksstable/ob_micro_block_reader.h"
 #include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
 #include "storage/access/ob_index_sstable_estimator.h"
+#include "storage/tx/ob_tx_data_define.h"
 
 namespace oceanbase
 {
@@ -272,7 +273,10 @@ public:
       read_trans_id_(),
       last_trans_id_(),
       first_rowkey_flag_(true),
-      have_output_row_flag_(false)
+      have_output_row_flag_(false),
+      decided_trans_id_(),
+      decided_trans_state_(storage::ObTxData::RUNNING),
+      decided_trans_version_(INT64_MAX)
   {
     for (int i = 0; i < COMPACT_MAX_ROW; ++i) {
       nop_pos_[i] = NULL;
@@ -303,7 +307,8 @@ public:
   int get_first_row_mvcc_info(bool &is_first_row, bool &is_shadow_row) const;
   TO_STRING_KV(K_(macro_id), K_(is_last_multi_version_row), K_(is_row_queue_ready),
                K_(row_queue), K_(start), K_(current), K_(last),
-               K_(scan_state), K_(committed_trans_version));
+               K_(scan_state), K_(committed_trans_version), K_(decided_trans_id),
+               K_(decided_trans_state), K_(decided_trans_version));
 protected:
   virtual int inner_get_next_row(const ObDatumRow *&row) override;
 private:
@@ -371,6 +376,11 @@ private:
   transaction::ObTransID last_trans_id_;
   bool first_rowkey_flag_;
   bool have_output_row_flag_;
+  // the last transaction which has been decided before merge scn, its rows
+  // are cleaned out with the recorded state without visiting tx table again
+  transaction::ObTransID decided_trans_id_;
+  int64_t decided_trans_state_;
+  int64_t decided_trans_version_;
 };
 
 }
@@ -858,7 +858,7 @@ bool ObPartitionMinorRowMergeIter::inner_check(const ObMergeParameter &merge_par
   if (!is_multi_version_merge(merge_param.merge_type_) && !storage::is_backfill_tx_merge(merge_param.merge_type_)) {
     bret = false;
     LOG_WARN_RET(OB_ERR_UNEXPECTED, "Unexpected merge type for minor row merge iter", K(bret), K(merge_param));
-  } else if (merge_param.merge_level_ != MACRO_BLOCK_MERGE_LEVEL) {
+  } else if (merge_param.merge_level_ != MACRO_BLOCK_MERGE_LEVEL && merge_param.merge_level_ != MICRO_BLOCK_MERGE_LEVEL) {
     bret = false;
     LOG_WARN_RET(OB_ERR_UNEXPECTED, "Unexpected merge level for minor row merge iter", K(bret), K(merge_param));
   } else if (!table_->is_multi_version_table()) {
@@ -1317,7 +1317,7 @@ int ObPartitionMinorMacroMergeIter::inner_init(const ObMergeParameter &merge_par
         stmt_allocator_,
         macro_block_iter_,
         false, /* reverse scan */
-        false, /* need micro info */
+        need_record_micro_info(), /* need micro info */
         true /* need secondary meta */))) {
     LOG_WARN("Fail to scan macro block", K(ret), KPC(merge_param.full_read_info_));
     }
@@ -1592,5 +1592,311 @@ int ObPartitionMinorMacroMergeIter::get_curr_range(ObDatumRange &range) const
   return ret;
 }
 
+/*
+ *ObPartitionMinorMicroMergeIter
+ */
+ObPartitionMinorMicroMergeIter::ObPartitionMinorMicroMergeIter()
+  : micro_block_iter_(),
+    micro_row_scanner_(nullptr),
+    curr_micro_block_(nullptr),
+    macro_reader_(),
+    multi_version_range_(),
+    micro_block_idx_(0),
+    micro_block_opened_(false),
+    need_reuse_micro_block_(false),
+    last_micro_last_flag_(true)
+{
+}
+
+ObPartitionMinorMicroMergeIter::~ObPartitionMinorMicroMergeIter()
+{
+  reset();
+}
+
+void ObPartitionMinorMicroMergeIter::reset()
+{
+  micro_block_iter_.reset();
+  if (OB_NOT_NULL(micro_row_scanner_)) {
+    micro_row_scanner_->~ObIMicroBlockRowScanner();
+    micro_row_scanner_ = nullptr;
+  }
+  curr_micro_block_ = nullptr;
+  multi_version_range_.reset();
+  micro_block_idx_ = 0;
+  micro_block_opened_ = false;
+  need_reuse_micro_block_ = false;
+  last_micro_last_flag_ = true;
+  ObPartitionMinorMacroMergeIter::reset();
+}
+
+int ObPartitionMinorMicroMergeIter::inner_init(const ObMergeParameter &merge_param)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  const int64_t max_datum_cnt = MAX(merge_range_.get_start_key().get_datum_cnt(),
+                                    merge_range_.get_end_key().get_datum_cnt());
+
+  if (OB_FAIL(ObPartitionMinorMacroMergeIter::inner_init(merge_param))) {
+    LOG_WARN("Failed to do minor macro merge iter init", K(ret));
+  } else if (merge_range_.is_whole_range()
+      || max_datum_cnt == schema_rowkey_column_cnt_ + ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt()) {
+    multi_version_range_ = merge_range_;
+  } else if (OB_FAIL(merge_range_.to_multi_version_range(stmt_allocator_, multi_version_range_))) {
+    LOG_WARN("Failed to transfer multi version range", K(ret), K_(merge_range));
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_ISNULL(buf = stmt_allocator_.alloc(sizeof(ObMultiVersionMicroBlockMinorMergeRowScanner)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc memory for minor merge micro block scanner", K(ret));
+  } else if (FALSE_IT(micro_row_scanner_ = new (buf) ObMultiVersionMicroBlockMinorMergeRowScanner(stmt_allocator_))) {
+  } else if (OB_FAIL(micro_row_scanner_->init(access_param_.iter_param_,
+                                              access_context_,
+                                              reinterpret_cast<ObSSTable *>(table_)))) {
+    LOG_WARN("Failed to init micro row scanner", K(ret), K(access_param_), K(access_context_));
+  } else {
+    curr_micro_block_ = nullptr;
+    micro_block_idx_ = 0;
+    micro_block_opened_ = false;
+    need_reuse_micro_block_ = false;
+    last_micro_last_flag_ = true;
+  }
+
+  return ret;
+}
+
+// check before open each macro block
+int ObPartitionMinorMicroMergeIter::check_need_reuse_micro_block(bool &need_reuse)
+{
+  int ret = OB_SUCCESS;
+  bool range_cross = false;
+  need_reuse = false;
+
+  if (curr_block_desc_.schema_version_ <= 0 || curr_block_desc_.schema_version_ != schema_version_) {
+  } else if (FLAT_ROW_STORE != curr_block_desc_.row_store_type_) {
+    // the last row flag of micro block is only recorded in the header of flat micro block
+  } else if (!last_mvcc_row_already_output_ || last_macro_block_recycled_) {
+    // the first rowkey of current macro block should be compacted with the last one
+  } else if (OB_FAIL(check_merge_range_cross(curr_block_desc_.range_, range_cross))) {
+    LOG_WARN("failed to check range cross", K(ret), K(curr_block_desc_.range_));
+  } else {
+    need_reuse = !range_cross;
+  }
+  return ret;
+}
+
+bool ObPartitionMinorMicroMergeIter::can_reuse_micro_block(const ObMicroBlock &micro_block) const
+{
+  const ObMicroBlockHeader &header = micro_block.header_;
+  // the micro block should start and end with a complete rowkey, and has nothing to compact or recycle
+  return last_micro_last_flag_
+      && header.is_last_row_last_flag()
+      && !header.contain_uncommitted_rows()
+      && !micro_block.micro_index_info_->contain_uncommitted_row()
+      && header.max_merged_trans_version_ > access_context_.trans_version_range_.base_version_;
+}
+
+int ObPartitionMinorMicroMergeIter::open_curr_macro_block()
+{
+  int ret = OB_SUCCESS;
+  bool need_reuse = false;
+
+  if (OB_UNLIKELY(macro_block_opened_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("Unepxcted opened macro block to open", K(ret));
+  } else if (OB_FAIL(check_need_reuse_micro_block(need_reuse))) {
+    LOG_WARN("Failed to check need reuse micro block", K(ret), K_(curr_block_desc));
+  } else if (!need_reuse) {
+    need_reuse_micro_block_ = false;
+    ret = ObPartitionMinorMacroMergeIter::open_curr_macro_block();
+  } else {
+    micro_block_iter_.reset();
+    if (OB_FAIL(micro_block_iter_.init(
+                curr_block_desc_.range_,
+                read_info_,
+                curr_block_desc_.macro_block_id_,
+                macro_block_iter_->get_micro_index_infos(),
+                macro_block_iter_->get_micro_endkeys(),
+                static_cast<ObRowStoreType>(curr_block_desc_.row_store_type_),
+                reinterpret_cast<ObSSTable *>(table_)))) {
+      LOG_WARN("Failed to init micro_block_iter", K(ret), K_(curr_block_desc));
+    } else if (FALSE_IT(micro_row_scanner_->reuse())) {
+    } else if (OB_FAIL(micro_row_scanner_->set_range(multi_version_range_))) {
+      LOG_WARN("Failed to set range for micro scanner", K(ret), K_(multi_version_range));
+    } else {
+      if (last_macro_block_reused()) {
+        // last reused macro block ends with a complete rowkey
+        check_committing_trans_compacted_ = true;
+        is_rowkey_first_row_reused_ = false;
+        is_rowkey_shadow_row_reused_ = false;
+      }
+      curr_micro_block_ = nullptr;
+      micro_block_opened_ = false;
+      last_micro_last_flag_ = true;
+      need_reuse_micro_block_ = true;
+      macro_block_opened_ = true;
+      LOG_DEBUG("init micro block iter for minor macro block", K(*this), K(macro_block_iter_->get_micro_endkeys()));
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::open_curr_micro_block()
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockData decompressed_data;
+  ObMicroBlockDesMeta micro_des_meta;
+  const ObMicroIndexInfo *micro_index_info = nullptr;
+  bool is_compressed = false;
+
+  if (OB_UNLIKELY(!in_micro_mode() || micro_block_opened_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("Unexpected status to open micro block", K(ret), K(*this));
+  } else if (OB_ISNULL(curr_micro_block_)
+      || OB_ISNULL(micro_index_info = curr_micro_block_->micro_index_info_)
+      || OB_UNLIKELY(!micro_index_info->is_valid())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected micro block", K(ret), KPC(curr_micro_block_));
+  } else if (OB_FAIL(micro_index_info->row_header_->fill_micro_des_meta(false, micro_des_meta))) {
+    LOG_WARN("Fail to fill micro block deserialize meta", K(ret), KPC(micro_index_info));
+  } else if (OB_FAIL(macro_reader_.decrypt_and_decompress_data(
+      micro_des_meta,
+      curr_micro_block_->data_.get_buf(),
+      curr_micro_block_->data_.get_buf_size(),
+      decompressed_data.get_buf(),
+      decompressed_data.get_buf_size(),
+      is_compressed))) {
+    LOG_WARN("Failed to decrypt and decompress data", K(ret), KPC_(curr_micro_block));
+  } else if (OB_FAIL(micro_row_scanner_->open(
+      curr_block_desc_.macro_block_id_,
+      decompressed_data,
+      micro_block_iter_.is_left_border(),
+      micro_block_iter_.is_right_border()))) {
+    LOG_WARN("Failed to open micro scanner", K(ret));
+  } else {
+    micro_block_opened_ = true;
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::inner_next_micro_row(const bool open_macro)
+{
+  int ret = OB_SUCCESS;
+  bool found = false;
+
+  while (OB_SUCC(ret) && !found) {
+    if (micro_block_opened_) {
+      if (OB_SUCC(micro_row_scanner_->get_next_row(curr_row_))) {
+        iter_row_count_++;
+        found = true;
+      } else if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("Failed to get next row from micro block", K(ret), K(*this));
+      } else {
+        ret = OB_SUCCESS;
+        micro_block_opened_ = false;
+      }
+    } else {
+      if (nullptr != curr_micro_block_) {
+        last_micro_last_flag_ = curr_micro_block_->header_.is_last_row_last_flag();
+      }
+      if (OB_FAIL(micro_block_iter_.next(curr_micro_block_))) {
+        curr_micro_block_ = nullptr;
+        if (OB_UNLIKELY(OB_ITER_END != ret)) {
+          LOG_WARN("Failed to get next micro block", K(ret));
+        }
+      } else if (FALSE_IT(++micro_block_idx_)) {
+      } else if (!open_macro && can_reuse_micro_block(*curr_micro_block_)) {
+        // expose the micro block to be reused
+        curr_row_ = nullptr;
+        found = true;
+      } else if (OB_FAIL(open_curr_micro_block())) {
+        LOG_WARN("Failed to open curr micro block", K(ret), K(*this));
+      }
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::inner_next(const bool open_macro)
+{
+  int ret = OB_SUCCESS;
+  bool need_check = false;
+
+  if (!in_micro_mode()) {
+    ret = ObPartitionMinorMacroMergeIter::inner_next(open_macro);
+  } else if (OB_SUCC(inner_next_micro_row(open_macro))) {
+  } else if (OB_UNLIKELY(OB_ITER_END != ret)) {
+    LOG_WARN("Failed to get next row in micro blocks", K(ret), K(*this));
+  } else if (FALSE_IT(need_reuse_micro_block_ = false)) {
+  } else if (OB_FAIL(next_range())) {
+    // macro block is still marked opened, so that it will not be treated as reused
+    if (OB_UNLIKELY(OB_ITER_END != ret)) {
+      LOG_WARN("Failed to get next range", K(ret), K(*this));
+    }
+  } else if (!open_macro && OB_FAIL(check_need_open_curr_macro_block(need_check))) {
+    STORAGE_LOG(WARN, "Failed to check need open curr macro block", K(ret));
+  } else if (open_macro || need_check) {
+    if (OB_FAIL(open_curr_macro_block())) {
+      LOG_WARN("Failed to open current macro block", K(ret), K(open_macro));
+    } else if (OB_FAIL(inner_next(open_macro))) {
+      if (OB_ITER_END != ret) {
+        LOG_WARN("Failed to inner next row", K(ret), KPC(this));
+      }
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::open_curr_range(const bool for_rewrite, const bool for_compare)
+{
+  int ret = OB_SUCCESS;
+
+  if (!in_micro_mode()) {
+    ret = ObPartitionMinorMacroMergeIter::open_curr_range(for_rewrite, for_compare);
+  } else if (OB_UNLIKELY(micro_block_opened_ || nullptr != curr_row_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("Unexpected opened micro block to open", K(ret), K(*this));
+  } else {
+    const int64_t curr_micro_block_idx = micro_block_idx_;
+    if (OB_FAIL(open_curr_micro_block())) {
+      LOG_WARN("Failed to open curr micro block", K(ret), K(*this));
+    } else if (OB_FAIL(next())) {
+      if (for_compare && OB_ITER_END == ret) {
+        ret = OB_BLOCK_SWITCHED;
+        LOG_DEBUG("curr micro block changed", K(*this));
+      } else if (OB_ITER_END != ret) {
+        LOG_WARN("failed to next", K(ret));
+      }
+    } else if (for_compare && (!in_micro_mode() || curr_micro_block_idx != micro_block_idx_)) {
+      ret = OB_BLOCK_SWITCHED;
+      LOG_DEBUG("curr micro block changed", K(*this));
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::get_curr_range(ObDatumRange &range) const
+{
+  int ret = OB_SUCCESS;
+
+  if (!in_micro_mode()) {
+    ret = ObPartitionMinorMacroMergeIter::get_curr_range(range);
+  } else if (OB_UNLIKELY(micro_block_opened_ || nullptr == curr_micro_block_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected micro block status to get range", K(ret), K(*this));
+  } else {
+    range = curr_micro_block_->range_;
+    revise_macro_range(range);
+    range.set_left_closed();
+    range.set_right_closed();
+  }
+  return ret;
+}
+
 } //compaction
 } //oceanbase
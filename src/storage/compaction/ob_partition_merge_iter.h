@@ -287,8 +287,9 @@ protected:
   int check_need_open_curr_macro_block(bool &need);
   int check_macro_block_recycle(const ObMacroBlockDesc &macro_desc, bool &can_recycle);
   int recycle_last_rowkey_in_macro_block(ObSSTableRowWholeScanner &iter);
-private:
+  virtual bool need_record_micro_info() const { return false; }
   OB_INLINE bool last_macro_block_reused() const { return 1 == last_macro_block_reused_; }
+protected:
   blocksstable::ObIMacroBlockIterator *macro_block_iter_;
   blocksstable::ObMacroBlockDesc curr_block_desc_;
   blocksstable::ObDataMacroBlockMeta curr_block_meta_;
@@ -299,6 +300,48 @@ private:
   bool have_macro_output_row_;
 };
 
+// iterate the micro blocks of the opened macro block, micro blocks that end with a complete rowkey
+// and only contain committed rows newer than the base version are exposed to be reused as a whole
+class ObPartitionMinorMicroMergeIter : public ObPartitionMinorMacroMergeIter
+{
+public:
+  ObPartitionMinorMicroMergeIter();
+  virtual ~ObPartitionMinorMicroMergeIter();
+  virtual void reset() override;
+  virtual int open_curr_range(const bool for_rewrite, const bool for_compare = false) override;
+  virtual bool is_micro_block_opened() const override { return !in_micro_mode() || nullptr != curr_row_; }
+  virtual int get_curr_range(blocksstable::ObDatumRange &range) const override;
+  virtual int get_curr_micro_block(const blocksstable::ObMicroBlock *&micro_block)
+  {
+    micro_block = curr_micro_block_;
+    return OB_SUCCESS;
+  }
+  INHERIT_TO_STRING_KV("ObPartitionMinorMicroMergeIter", ObPartitionMinorMacroMergeIter, K_(micro_block_opened),
+                       K_(need_reuse_micro_block), K_(micro_block_idx), K_(last_micro_last_flag),
+                       KPC(curr_micro_block_), KP_(micro_row_scanner));
+protected:
+  virtual int inner_init(const ObMergeParameter &merge_param) override;
+  virtual int inner_next(const bool open_macro) override;
+  virtual int open_curr_macro_block() override;
+  virtual bool need_record_micro_info() const override { return true; }
+private:
+  OB_INLINE bool in_micro_mode() const { return macro_block_opened_ && need_reuse_micro_block_; }
+  int check_need_reuse_micro_block(bool &need_reuse);
+  bool can_reuse_micro_block(const blocksstable::ObMicroBlock &micro_block) const;
+  int inner_next_micro_row(const bool open_macro);
+  int open_curr_micro_block();
+private:
+  ObIndexBlockMicroIterator micro_block_iter_;
+  blocksstable::ObIMicroBlockRowScanner *micro_row_scanner_;
+  const blocksstable::ObMicroBlock *curr_micro_block_;
+  blocksstable::ObMacroBlockReader macro_reader_;
+  blocksstable::ObDatumRange multi_version_range_;
+  int64_t micro_block_idx_;
+  bool micro_block_opened_;
+  bool need_reuse_micro_block_;
+  bool last_micro_last_flag_;
+};
+
 static const int64_t DEFAULT_ITER_COUNT = 16;
 typedef common::ObSEArray<ObPartitionMergeIter*, DEFAULT_ITER_COUNT> MERGE_ITER_ARRAY;
 
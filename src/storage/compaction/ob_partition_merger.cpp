@@ -323,6 +323,28 @@ int ObPartitionMerger::merge_macro_block_iter(MERGE_ITER_ARRAY &minimum_iters, i
   return ret;
 }
 
+int ObPartitionMerger::merge_micro_block_iter(ObPartitionMergeIter &iter, int64_t &reuse_row_cnt)
+{
+  int ret = OB_SUCCESS;
+  const ObMicroBlock *micro_block;
+  if (OB_FAIL(iter.get_curr_micro_block(micro_block))) {
+    STORAGE_LOG(WARN, "Failed to get current micro block", K(ret), K(iter));
+  } else if (OB_ISNULL(micro_block)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "Unexpected null micro block", K(ret), K(iter));
+  } else if (OB_FAIL(process(*micro_block))) {
+    STORAGE_LOG(WARN, "Failed to append micro block", K(ret), K(micro_block));
+  } else if (FALSE_IT(reuse_row_cnt += micro_block->header_.row_count_)) {
+  } else if (OB_FAIL(iter.next())) {
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    } else {
+      STORAGE_LOG(WARN, "Failed to get next row", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObPartitionMerger::try_rewrite_macro_block(const ObMacroBlockDesc &macro_desc, bool &rewrite)
 {
   int ret = OB_SUCCESS;
@@ -698,28 +720,6 @@ int ObPartitionMajorMerger::merge_same_rowkey_iters(MERGE_ITER_ARRAY &merge_iter
   return ret;
 }
 
-int ObPartitionMajorMerger::merge_micro_block_iter(ObPartitionMergeIter &iter, int64_t &reuse_row_cnt)
-{
-  int ret = OB_SUCCESS;
-  const ObMicroBlock *micro_block;
-  if (OB_FAIL(iter.get_curr_micro_block(micro_block))) {
-    STORAGE_LOG(WARN, "Failed to get current micro block", K(ret), K(iter));
-  } else if (OB_ISNULL(micro_block)) {
-    ret = OB_ERR_UNEXPECTED;
-    STORAGE_LOG(WARN, "Unexpected null micro block", K(ret), K(iter));
-  } else if (OB_FAIL(process(*micro_block))) {
-    STORAGE_LOG(WARN, "Failed to append micro block", K(ret), K(micro_block));
-  } else if (FALSE_IT(reuse_row_cnt += micro_block->header_.row_count_)) {
-  } else if (OB_FAIL(iter.next())) {
-    if (OB_ITER_END == ret) {
-      ret = OB_SUCCESS;
-    } else {
-      STORAGE_LOG(WARN, "Failed to get next row", K(ret));
-    }
-  }
-  return ret;
-}
-
 int ObPartitionMajorMerger::try_rewrite_macro_block(const ObMacroBlockDesc &macro_desc, bool &rewrite)
 {
   int ret = OB_SUCCESS;
@@ -1123,9 +1123,20 @@ int ObPartitionMinorMerger::merge_partition(ObTabletMergeCtx &ctx, const int64_t
       } else if (FALSE_IT(set_base_iter(rowkey_minimum_iters))) {
       } else if (1 == rowkey_minimum_iters.count()
           && nullptr == rowkey_minimum_iters.at(0)->get_curr_row()) {
-        // only one iter, output its' macro block
-        if (OB_FAIL(merge_macro_block_iter(rowkey_minimum_iters, reuse_row_cnt))) {
-          STORAGE_LOG(WARN, "Failed to merge_macro_block_iter", K(ret), K(rowkey_minimum_iters));
+        ObPartitionMergeIter *iter = rowkey_minimum_iters.at(0);
+        if (!iter->is_macro_block_opened()) {
+          // only one iter, output its' macro block
+          if (OB_FAIL(merge_macro_block_iter(rowkey_minimum_iters, reuse_row_cnt))) {
+            STORAGE_LOG(WARN, "Failed to merge_macro_block_iter", K(ret), K(rowkey_minimum_iters));
+          }
+        } else if (!iter->is_micro_block_opened()) {
+          // only one iter, output its' micro block
+          if (OB_FAIL(merge_micro_block_iter(*iter, reuse_row_cnt))) {
+            STORAGE_LOG(WARN, "Failed to merge_micro_block_iter", K(ret), KPC(iter));
+          }
+        } else {
+          ret = OB_ERR_UNEXPECTED;
+          STORAGE_LOG(WARN, "Unexpected iter state", K(ret), KPC(iter));
         }
       } else if (OB_FAIL(merge_same_rowkey_iters(rowkey_minimum_iters))) {
         STORAGE_LOG(WARN, "Failed to merge iters with same rowkey", K(ret), K(rowkey_minimum_iters));
@@ -57,6 +57,7 @@ protected:
   virtual int process(const blocksstable::ObDatumRow &row);
   virtual int rewrite_macro_block(MERGE_ITER_ARRAY &minimum_iters) = 0;
   virtual int merge_macro_block_iter(MERGE_ITER_ARRAY &minimum_iters, int64_t &reuse_row_cnt);
+  int merge_micro_block_iter(ObPartitionMergeIter &iter, int64_t &reuse_row_cnt);
   virtual int try_rewrite_macro_block(const ObMacroBlockDesc &macro_block, bool &rewrite);
   virtual int merge_same_rowkey_iters(MERGE_ITER_ARRAY &merge_iters) = 0;
   template <typename T> T *alloc_merge_helper();
@@ -103,7 +104,6 @@ protected:
   virtual int rewrite_macro_block(MERGE_ITER_ARRAY &minimum_iters) override;
   virtual int merge_same_rowkey_iters(MERGE_ITER_ARRAY &merge_iters) override;
 private:
-  int merge_micro_block_iter(ObPartitionMergeIter &iter, int64_t &reuse_row_cnt);
   int reuse_base_sstable(ObPartitionMajorMergeHelper &merge_helper);
 private:
   int64_t rewrite_block_cnt_;
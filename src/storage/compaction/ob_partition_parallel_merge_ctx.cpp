@@ -307,8 +307,14 @@ int ObParallelMergeCtx::init_parallel_mini_merge(compaction::ObTabletMergeCtx &m
         STORAGE_LOG(WARN, "failed to get uplimit", K(ret), K(mini_merge_thread));
       } else {
         ObArray<ObStoreRange> store_ranges;
+        // the row based estimation ignores wide rows and multi versions, so the occupied memory
+        // of memtable is also taken into account, and a hot memtable is dumped in smaller tasks
+        // to release the memstore earlier
+        total_bytes = MAX(total_bytes, memtable->get_occupied_size());
+        const int64_t task_size = tablet_size > 0 ? MIN(tablet_size, PARALLEL_MINI_MERGE_TASK_SIZE)
+                                                  : PARALLEL_MINI_MERGE_TASK_SIZE;
         mini_merge_thread = MAX(mini_merge_thread, PARALLEL_MERGE_TARGET_TASK_CNT);
-        concurrent_cnt_ = MIN((total_bytes + tablet_size - 1) / tablet_size, mini_merge_thread);
+        concurrent_cnt_ = MIN((total_bytes + task_size - 1) / task_size, mini_merge_thread);
         if (concurrent_cnt_ <= 1) {
           if (OB_FAIL(init_serial_merge())) {
             STORAGE_LOG(WARN, "Failed to init serialize merge", K(ret));
@@ -321,11 +327,17 @@ int ObParallelMergeCtx::init_parallel_mini_merge(compaction::ObTabletMergeCtx &m
           } else {
             STORAGE_LOG(WARN, "Failed to get split ranges from memtable", K(ret));
           }
-        } else if (OB_UNLIKELY(store_ranges.count() != concurrent_cnt_)) {
+        } else if (OB_UNLIKELY(store_ranges.count() > concurrent_cnt_)) {
           ret = OB_ERR_UNEXPECTED;
           STORAGE_LOG(WARN, "Unexpected range array and concurrent_cnt", K(ret), K_(concurrent_cnt),
                       K(store_ranges));
+        } else if (store_ranges.count() <= 1) {
+          // memtable btree fan out is too small to split
+          if (OB_FAIL(init_serial_merge())) {
+            STORAGE_LOG(WARN, "Failed to init serialize merge", K(ret));
+          }
         } else {
+          concurrent_cnt_ = store_ranges.count();
           for (int64_t i = 0; OB_SUCC(ret) && i < store_ranges.count(); i++) {
             ObDatumRange datum_range;
             if (OB_FAIL(datum_range.from_range(store_ranges.at(i), allocator_))) {
@@ -419,9 +431,9 @@ int ObParallelMergeCtx::calc_mini_minor_parallel_degree(const int64_t tablet_siz
   } else if (MTL(ObTenantDagScheduler *)->get_up_limit(ObDagPrio::DAG_PRIO_COMPACTION_MID, minor_merge_thread)) {
     STORAGE_LOG(WARN, "failed to get uplimit", K(ret), K(minor_merge_thread));
   } else {
-    int64_t avg_sstable_size = total_size / sstable_count;
+    // every range is merged across all the sstables, so the degree follows the total size
     parallel_degree = MIN(MAX(minor_merge_thread, PARALLEL_MERGE_TARGET_TASK_CNT),
-                          (avg_sstable_size + tablet_size - 1) / tablet_size);
+                          (total_size + tablet_size - 1) / tablet_size);
   }
 
   return ret;
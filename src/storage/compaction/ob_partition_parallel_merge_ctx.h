@@ -63,6 +63,7 @@ private:
   static const int64_t MIN_PARALLEL_MINOR_MERGE_THREASHOLD = 2;
   static const int64_t MIN_PARALLEL_MERGE_BLOCKS = 32;
   static const int64_t PARALLEL_MERGE_TARGET_TASK_CNT = 20;
+  static const int64_t PARALLEL_MINI_MERGE_TASK_SIZE = 32L * 1024L * 1024L; // 32MB
   //TODO @hanhui parallel in ai
   int init_serial_merge();
   OB_NOINLINE int init_parallel_mini_merge(compaction::ObTabletMergeCtx &merge_ctx);// will be mocked in mittest
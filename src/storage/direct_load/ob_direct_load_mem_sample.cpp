@@ -14,6 +14,7 @@
 #include "observer/table_load/ob_table_load_task_scheduler.h"
 #include "share/table/ob_table_load_handle.h"
 #include "observer/table_load/ob_table_load_mem_compactor.h"
+#include "lib/random/ob_random.h"
 
 namespace oceanbase
 {
@@ -28,44 +29,64 @@ ObDirectLoadMemSample::ObDirectLoadMemSample(ObDirectLoadMemContext *mem_ctx)
   : mem_ctx_(mem_ctx), range_count_(mem_ctx_->mem_dump_task_count_) {}
 
 
+// sample rows uniformly over all rows of chunks (not over chunks), so that the split keys
+// are quantiles of the data and each range dump merges about the same number of rows.
+// equal split keys are skipped, therefore the range count may be less than range_count_.
 int ObDirectLoadMemSample::gen_ranges(ObIArray<ChunkType *> &chunks, ObIArray<RangeType> &ranges)
 {
   int ret = OB_SUCCESS;
   ObArray<RowType *> sample_rows;
-  for (int64_t i = 0; OB_SUCC(ret) && i < DEFAULT_SAMPLE_TIMES; i ++) {
-    int idx = abs(rand()) % chunks.count();
-    ChunkType *chunk = chunks.at(idx);
-    int idx2 = abs(rand()) % chunk->get_size();
-    RowType *row = chunk->get_item(idx2);
-    if (OB_FAIL(sample_rows.push_back(row))) {
-      LOG_WARN("fail to push row", KR(ret));
+  ObArray<int64_t> row_count_prefix;
+  int64_t total_row_count = 0;
+  CompareType compare;
+  for (int64_t i = 0; OB_SUCC(ret) && i < chunks.count(); ++i) {
+    total_row_count += chunks.at(i)->get_size();
+    if (OB_FAIL(row_count_prefix.push_back(total_row_count))) {
+      LOG_WARN("fail to push back", KR(ret));
+    }
+  }
+  if (OB_SUCC(ret) && total_row_count > 0) {
+    const int64_t sample_count = MIN(DEFAULT_SAMPLE_TIMES, total_row_count);
+    if (OB_FAIL(sample_rows.reserve(sample_count))) {
+      LOG_WARN("fail to reserve", KR(ret), K(sample_count));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < sample_count; ++i) {
+      const int64_t pos = ObRandom::rand(0, total_row_count - 1);
+      const int64_t chunk_idx =
+        std::upper_bound(row_count_prefix.begin(), row_count_prefix.end(), pos) -
+        row_count_prefix.begin();
+      const int64_t row_idx = pos - (chunk_idx > 0 ? row_count_prefix.at(chunk_idx - 1) : 0);
+      if (OB_FAIL(sample_rows.push_back(chunks.at(chunk_idx)->get_item(row_idx)))) {
+        LOG_WARN("fail to push row", KR(ret));
+      }
     }
   }
   if (OB_SUCC(ret)) {
-    CompareType compare;
     if (OB_FAIL(compare.init(*(mem_ctx_->datum_utils_)))) {
       LOG_WARN("fail to init compare", KR(ret));
     } else {
       std::sort(sample_rows.begin(), sample_rows.end(), compare);
+      if (OB_FAIL(compare.get_error_code())) {
+        LOG_WARN("fail to sort sample rows", KR(ret));
+      }
     }
   }
 
-  int64_t step = DEFAULT_SAMPLE_TIMES / range_count_;
-
   RowType *last_row = nullptr;
-  for (int64_t i = 1; OB_SUCC(ret) && i <= range_count_; i ++) {
-    if (i != range_count_) {
-      if (OB_FAIL(ranges.push_back(RangeType(last_row, sample_rows[i * step])))) {
-        LOG_WARN("fail to push range", KR(ret));
-      } else {
-        last_row = sample_rows[i * step];
-      }
+  const int64_t sample_count = sample_rows.count();
+  for (int64_t i = 1; OB_SUCC(ret) && i < range_count_ && sample_count > 0; ++i) {
+    RowType *split_row = sample_rows.at(i * sample_count / range_count_);
+    if (nullptr != last_row && !compare(last_row, split_row)) {
+      // same split key, skip empty range
+    } else if (OB_FAIL(ranges.push_back(RangeType(last_row, split_row)))) {
+      LOG_WARN("fail to push range", KR(ret));
     } else {
-      if (OB_FAIL(ranges.push_back(RangeType(last_row, nullptr)))) {
-        LOG_WARN("fail to push range", KR(ret));
-      } else {
-        last_row = nullptr;
-      }
+      last_row = split_row;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    if (OB_FAIL(ranges.push_back(RangeType(last_row, nullptr)))) {
+      LOG_WARN("fail to push range", KR(ret));
     }
   }
   return ret;
@@ -77,7 +98,6 @@ int ObDirectLoadMemSample::do_work()
   ObArray<ChunkType *> chunks;
   ObArray<RangeType> ranges;
   auto context_ptr = ObTableLoadHandle<ObDirectLoadMemDump::Context>::make_handle();
-  context_ptr->sub_dump_count_ = range_count_;
 
   mem_ctx_->mem_chunk_queue_.pop_all(chunks);
 
@@ -101,10 +121,11 @@ int ObDirectLoadMemSample::do_work()
     if (OB_FAIL(gen_ranges(chunks, ranges))) {
       LOG_WARN("fail to gen ranges", KR(ret));
     } else {
-      ATOMIC_AAF(&(mem_ctx_->running_dump_count_), range_count_);
+      context_ptr->sub_dump_count_ = ranges.count();
+      ATOMIC_AAF(&(mem_ctx_->running_dump_count_), ranges.count());
     }
   }
-  for (int64_t i = 0; OB_SUCC(ret) && i < range_count_; i ++) {
+  for (int64_t i = 0; OB_SUCC(ret) && i < ranges.count(); i ++) {
     if (OB_FAIL(add_dump(i, chunks, ranges[i], context_ptr))) {
       LOG_WARN("fail to start dump", KR(ret));
     }
@@ -1776,6 +1776,196 @@ int ObLobManager::process_delta(ObLobAccessParam& param, ObLobLocatorV2& lob_loc
   return ret;
 }
 
+bool ObLobManager::can_do_partial_update(const ObLobCommon &old_lob_common,
+                                         const int64_t old_byte_len,
+                                         const ObObjType type,
+                                         const ObCollationType coll_type,
+                                         const int64_t new_byte_len)
+{
+  // binary lob and json(utf8mb4_bin) are supported, the diff range of json is aligned to chars
+  return (CS_TYPE_BINARY == coll_type || ob_is_json(type))
+      && is_partial_update_lob(old_lob_common, old_byte_len, new_byte_len);
+}
+
+bool ObLobManager::is_partial_update_lob(const ObLobCommon &old_lob_common,
+                                         const int64_t old_byte_len,
+                                         const int64_t new_byte_len)
+{
+  return !old_lob_common.in_row_
+      && old_lob_common.is_init_
+      && new_byte_len > LOB_IN_ROW_MAX_LENGTH
+      && new_byte_len <= LOB_PARTIAL_UPDATE_MAX_LENGTH
+      && old_byte_len <= LOB_PARTIAL_UPDATE_MAX_LENGTH;
+}
+
+void ObLobManager::calc_diff_range(const ObString &old_data,
+                                   const ObString &new_data,
+                                   const ObCollationType coll_type,
+                                   uint64_t &offset,
+                                   uint64_t &old_range_len,
+                                   uint64_t &new_range_len)
+{
+  const bool is_char = CS_TYPE_BINARY != coll_type;
+  const uint64_t old_len = old_data.length();
+  const uint64_t new_len = new_data.length();
+  const uint64_t min_len = MIN(old_len, new_len);
+  const char *old_ptr = old_data.ptr();
+  const char *new_ptr = new_data.ptr();
+  uint64_t prefix_len = 0;
+  uint64_t suffix_len = 0;
+  while (prefix_len < min_len && old_ptr[prefix_len] == new_ptr[prefix_len]) {
+    prefix_len++;
+  }
+  while (prefix_len + suffix_len < min_len
+      && old_ptr[old_len - suffix_len - 1] == new_ptr[new_len - suffix_len - 1]) {
+    suffix_len++;
+  }
+  if (is_char) {
+    // lob meta is located by char position, the range must start and end at char boundaries
+    int64_t char_cnt = 0;
+    int64_t mbmaxlen = 1;
+    prefix_len = ObCharset::max_bytes_charpos(coll_type, old_ptr, old_len, prefix_len, char_cnt);
+    if (OB_SUCCESS != ObCharset::get_mbmaxlen_by_coll(coll_type, mbmaxlen)) {
+      suffix_len = 0;
+    }
+    // the suffix starts at a char boundary of both old and new data,
+    // only if chars of the range and the suffix add up to chars after the prefix
+    const uint64_t old_tail_chars = ObCharset::strlen_char(coll_type, old_ptr + prefix_len, old_len - prefix_len);
+    const uint64_t new_tail_chars = ObCharset::strlen_char(coll_type, new_ptr + prefix_len, new_len - prefix_len);
+    bool aligned = (0 == suffix_len);
+    for (int64_t i = 0; !aligned && suffix_len > 0 && i < mbmaxlen; i++) {
+      const uint64_t suffix_chars = ObCharset::strlen_char(coll_type, old_ptr + old_len - suffix_len, suffix_len);
+      aligned = old_tail_chars == suffix_chars + ObCharset::strlen_char(coll_type, old_ptr + prefix_len,
+                                                                         old_len - prefix_len - suffix_len)
+             && new_tail_chars == suffix_chars + ObCharset::strlen_char(coll_type, new_ptr + prefix_len,
+                                                                         new_len - prefix_len - suffix_len);
+      if (!aligned) {
+        suffix_len--;
+      }
+    }
+    if (!aligned) {
+      suffix_len = 0;
+    }
+  }
+  old_range_len = old_len - prefix_len - suffix_len;
+  new_range_len = new_len - prefix_len - suffix_len;
+  if (new_range_len > old_range_len && 0 == old_range_len && old_len > 0) {
+    // pure insertion, replace one common char to locate the lob meta to insert into
+    uint64_t borrow_len = 1;
+    int64_t char_cnt = 0;
+    if (prefix_len > 0) {
+      if (is_char) {
+        borrow_len = prefix_len - ObCharset::max_bytes_charpos(coll_type, old_ptr, prefix_len, prefix_len - 1, char_cnt);
+      }
+      prefix_len -= borrow_len;
+    } else if (is_char) {
+      borrow_len = ObCharset::charpos(coll_type, old_ptr, old_len, 1);
+    }
+    old_range_len += borrow_len;
+    new_range_len += borrow_len;
+  }
+  offset = prefix_len;
+}
+
+// 1. read old data, and find the common prefix and suffix with new data
+// 2. overwrite the modified range in place, only pieces in the range are updated
+// 3. if length of lob is changed, insert or erase in the modified range, so the common suffix is kept
+// offset and len of lob param are chars for non binary collation, the byte range is converted before write
+int ObLobManager::process_diff(ObLobAccessParam& param, ObLobLocatorV2& new_lob)
+{
+  int ret = OB_SUCCESS;
+  ObString new_data;
+  ObString old_data;
+  char *buf = nullptr;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObLobManager is not initialized", K(ret));
+  } else if (OB_ISNULL(param.lob_common_) || OB_ISNULL(param.allocator_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid lob param", K(ret), K(param));
+  } else if (OB_FAIL(new_lob.get_inrow_data(new_data))) {
+    LOG_WARN("get new lob inrow data failed", K(ret), K(new_lob));
+  } else if (OB_UNLIKELY(!is_partial_update_lob(*param.lob_common_, param.byte_size_, new_data.length()))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("lob can not do partial update", K(ret), K(param), K(new_data.length()));
+  } else if (OB_ISNULL(buf = static_cast<char*>(param.allocator_->alloc(param.byte_size_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc buf failed.", K(ret), K(param.byte_size_));
+  } else {
+    old_data.assign_buffer(buf, param.byte_size_);
+    param.offset_ = 0;
+    // char count is never larger than byte count
+    param.len_ = param.byte_size_;
+    param.scan_backward_ = false;
+    if (OB_FAIL(query(param, old_data))) {
+      LOG_WARN("read old lob data failed", K(ret), K(param));
+    } else if (OB_UNLIKELY(old_data.length() != param.byte_size_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("old lob data is incomplete", K(ret), K(param), K(old_data.length()));
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    const bool is_char = param.coll_type_ != common::ObCollationType::CS_TYPE_BINARY;
+    const uint64_t old_len = old_data.length();
+    const uint64_t new_len = new_data.length();
+    const char *new_ptr = new_data.ptr();
+    uint64_t prefix_len = 0;
+    uint64_t old_range_len = 0;
+    uint64_t new_range_len = 0;
+    calc_diff_range(old_data, new_data, param.coll_type_, prefix_len, old_range_len, new_range_len);
+    ObString data(new_range_len, new_ptr + prefix_len);
+    // position in lob meta
+    const uint64_t offset = is_char ? ObCharset::strlen_char(param.coll_type_, new_ptr, prefix_len) : prefix_len;
+    const uint64_t old_range = is_char
+        ? ObCharset::strlen_char(param.coll_type_, old_data.ptr() + prefix_len, old_range_len) : old_range_len;
+    const uint64_t new_range = is_char
+        ? ObCharset::strlen_char(param.coll_type_, data.ptr(), data.length()) : new_range_len;
+    // pre-calc seq no for all operations
+    param.update_len_ = MAX(old_range_len, new_range_len);
+    if (0 == old_len) {
+      param.op_type_ = ObLobDataOutRowCtx::OpType::APPEND;
+      param.offset_ = 0;
+      param.len_ = new_len;
+      if (OB_FAIL(append(param, new_data))) {
+        LOG_WARN("failed to do lob append", K(ret), K(param), K(new_len));
+      }
+    } else if (new_range > old_range) {
+      param.op_type_ = ObLobDataOutRowCtx::OpType::WRITE;
+      param.offset_ = offset;
+      param.len_ = old_range;
+      if (OB_FAIL(replace_outrow(param, data))) {
+        LOG_WARN("failed to do lob replace", K(ret), K(param), K(offset), K(old_range), K(new_range));
+      }
+    } else {
+      if (new_range > 0) {
+        param.op_type_ = ObLobDataOutRowCtx::OpType::WRITE;
+        param.offset_ = offset;
+        param.len_ = new_range;
+        if (OB_FAIL(write(param, data))) {
+          LOG_WARN("failed to do lob write", K(ret), K(param), K(offset), K(new_range));
+        }
+      }
+      if (OB_SUCC(ret) && old_range > new_range) {
+        param.op_type_ = ObLobDataOutRowCtx::OpType::ERASE;
+        param.offset_ = offset + new_range;
+        param.len_ = old_range - new_range;
+        param.is_fill_zero_ = false;
+        if (OB_FAIL(erase(param))) {
+          LOG_WARN("failed to do lob erase", K(ret), K(param), K(old_range), K(new_range));
+        }
+      }
+    }
+    LOG_DEBUG("process lob diff", K(ret), K(old_len), K(new_len), K(prefix_len), K(old_range_len),
+              K(new_range_len), K(offset), K(old_range), K(new_range));
+  }
+
+  if (OB_NOT_NULL(buf)) {
+    param.allocator_->free(buf);
+  }
+  return ret;
+}
+
 int ObLobManager::getlength_remote(ObLobAccessParam& param, common::ObAddr& dst_addr, uint64_t &len)
 {
   int ret = OB_SUCCESS;
@@ -2469,6 +2659,49 @@ int ObLobManager::write(ObLobAccessParam& param, ObString& data)
   return ret;
 }
 
+int ObLobManager::replace_outrow(ObLobAccessParam& param, ObString& data)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t replace_len = param.len_;
+  ObString old_data;
+  bool out_row = false;
+  ObLobQueryIter *iter = nullptr;
+  ObString read_buffer;
+  char *read_buff = nullptr;
+  if (OB_ISNULL(param.lob_common_) || OB_UNLIKELY(!param.lob_common_->is_init_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid lob common", K(ret), K(param));
+  } else if (FALSE_IT(param.lob_data_ = reinterpret_cast<ObLobData*>(param.lob_common_->buffer_))) {
+  } else if (OB_FAIL(check_handle_size(param))) {
+    LOG_WARN("check handle size failed.", K(ret));
+  } else if (OB_FAIL(prepare_for_write(param, old_data, out_row))) {
+    LOG_WARN("prepare for write failed.", K(ret));
+  } else if (OB_UNLIKELY(!out_row || old_data.length() > 0)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("replace is only for out row lob", K(ret), K(param), K(out_row));
+  } else if (OB_ISNULL(read_buff = static_cast<char*>(param.allocator_->alloc(LOB_READ_BUFFER_LEN)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc buf failed.", K(ret));
+  } else if (FALSE_IT(read_buffer.assign_buffer(read_buff, LOB_READ_BUFFER_LEN))) {
+  } else if (FALSE_IT(param.len_ = data.length())) {
+    // iterate the whole data, rather than len_ of it as write does
+  } else if (OB_FAIL(query_inrow_get_iter(param, data, 0, false, iter))) {
+    LOG_WARN("fail to get query iter", K(ret), K(param), K(data.length()));
+  } else if (FALSE_IT(param.len_ = replace_len)) {
+  } else if (OB_FAIL(write_outrow_inner(param, iter, read_buffer, old_data))) {
+    LOG_WARN("fail to write outrow", K(ret), K(param));
+  }
+  param.len_ = replace_len;
+  if (OB_NOT_NULL(read_buff)) {
+    param.allocator_->free(read_buff);
+  }
+  if (OB_NOT_NULL(iter)) {
+    iter->reset();
+    common::sop_return(ObLobQueryIter, iter);
+  }
+  return ret;
+}
+
 int ObLobManager::replace_process_meta_info(ObLobAccessParam& param,
                                             ObLobMetaScanIter &meta_iter,
                                             ObLobQueryResult &result,
@@ -136,6 +136,7 @@ public:
   static const int64_t LOB_WITH_OUTROW_CTX_SIZE = sizeof(ObLobCommon) + sizeof(ObLobData) + sizeof(ObLobDataOutRowCtx);
   static const int64_t LOB_OUTROW_FULL_SIZE = sizeof(ObLobCommon) + sizeof(ObLobData) + sizeof(ObLobDataOutRowCtx) + sizeof(uint64_t);
   static const uint64_t LOB_READ_BUFFER_LEN = 1024L*1024L; // 1M
+  static const int64_t LOB_PARTIAL_UPDATE_MAX_LENGTH = 16L*1024L*1024L; // 16M, old data is read fully for diff
 private:
   explicit ObLobManager(const uint64_t tenant_id)
     : tenant_id_(tenant_id),
@@ -181,6 +182,24 @@ public:
   // Tmp Delta Lob locator interface
   int process_delta(ObLobAccessParam& param,
                     ObLobLocatorV2& lob_locator);
+  // Sql update of out row lob with full new data, only pieces of the modified range are rewritten
+  // instead of erasing the whole old lob and inserting the new one
+  static bool can_do_partial_update(const ObLobCommon &old_lob_common,
+                                    const int64_t old_byte_len,
+                                    const ObObjType type,
+                                    const ObCollationType coll_type,
+                                    const int64_t new_byte_len);
+  // modified range is [offset, offset + old_range_len) in old data, and is replaced by
+  // [offset, offset + new_range_len) of new data, the common prefix and suffix are kept.
+  // all are byte lengths, aligned to char boundaries if coll_type is not binary
+  static void calc_diff_range(const ObString &old_data,
+                              const ObString &new_data,
+                              const ObCollationType coll_type,
+                              uint64_t &offset,
+                              uint64_t &old_range_len,
+                              uint64_t &new_range_len);
+  int process_diff(ObLobAccessParam& param,
+                   ObLobLocatorV2& new_lob);
   // Lob data interface
   int append(ObLobAccessParam& param,
              ObString& data);
@@ -233,6 +252,11 @@ private:
   int write_outrow_result(ObLobAccessParam& param, ObLobMetaWriteIter &write_iter);
   int write_outrow_inner(ObLobAccessParam& param, ObLobQueryIter *iter, ObString& read_buf, ObString& old_data);
   int write_outrow(ObLobAccessParam& param, ObLobLocatorV2& lob, uint64_t offset, ObString& old_data);
+  static bool is_partial_update_lob(const ObLobCommon &old_lob_common,
+                                    const int64_t old_byte_len,
+                                    const int64_t new_byte_len);
+  // replace [offset_, offset_ + len_) of out row lob with the whole data, data can be longer than len_
+  int replace_outrow(ObLobAccessParam& param, ObString& data);
 
   int query_inrow_get_iter(ObLobAccessParam& param, ObString &data, uint32_t offset, bool scan_backward, ObLobQueryIter *&result);
   int erase_imple_inner(ObLobAccessParam& param);
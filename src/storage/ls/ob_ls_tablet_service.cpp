@@ -4148,6 +4148,95 @@ int ObLSTabletService::process_delta_lob(
   return ret;
 }
 
+int ObLSTabletService::check_lob_partial_update(
+    const ObColDesc &column,
+    const bool data_tbl_rowkey_change,
+    const bool is_total_quantity_log,
+    ObObj &old_obj,
+    ObLobLocatorV2 &new_lob,
+    bool &partial_update,
+    ObString &old_disk_lob)
+{
+  int ret = OB_SUCCESS;
+  ObLobLocatorV2 old_lob;
+  int64_t new_byte_len = 0;
+  partial_update = false;
+  if (data_tbl_rowkey_change || old_obj.is_null() || old_obj.is_nop_value()
+      || !new_lob.is_valid() || !new_lob.is_full_temp_lob()) {
+    // do full update
+  } else if (is_total_quantity_log) {
+    // libobcdc rebuilds the new lob from the whole delete and insert seq no range of the update,
+    // pieces kept by partial update are not in redo, do full update
+  } else if (OB_FAIL(old_obj.get_lob_locatorv2(old_lob))) {
+    LOG_WARN("get old lob locator failed.", K(ret), K(old_obj));
+  } else if (!old_lob.is_valid() || !old_lob.has_lob_header()) {
+    // do full update
+  } else if (OB_FAIL(old_lob.get_disk_locator(old_disk_lob))) {
+    LOG_WARN("fail to get old lob disk locator.", K(ret), K(old_lob));
+  } else if (old_disk_lob.length() < ObLobManager::LOB_WITH_OUTROW_CTX_SIZE) {
+    // inrow lob or lob without out row ctx, do full update
+  } else if (OB_FAIL(new_lob.get_lob_data_byte_len(new_byte_len))) {
+    LOG_WARN("fail to get new lob byte len", K(ret), K(new_lob));
+  } else {
+    const ObLobCommon *old_lob_common = reinterpret_cast<ObLobCommon*>(old_disk_lob.ptr());
+    partial_update = ObLobManager::can_do_partial_update(
+        *old_lob_common,
+        old_lob_common->get_byte_size(old_disk_lob.length()),
+        column.col_type_.get_type(),
+        column.col_type_.get_collation_type(),
+        new_byte_len);
+  }
+  return ret;
+}
+
+int ObLSTabletService::process_diff_lob(
+    ObDMLRunningCtx &run_ctx,
+    const ObColDesc &column,
+    const ObString &old_disk_lob,
+    ObLobLocatorV2 &new_lob,
+    ObObj &obj)
+{
+  int ret = OB_SUCCESS;
+  ObLobManager *lob_mngr = MTL(ObLobManager*);
+  char *buf = nullptr;
+  if (OB_ISNULL(lob_mngr)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("[STORAGE_LOB]failed to get lob manager handle.", K(ret));
+  } else if (OB_ISNULL(buf = static_cast<char*>(run_ctx.lob_allocator_.alloc(old_disk_lob.length())))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("[STORAGE_LOB]alloc memory failed.", K(ret), K(old_disk_lob));
+  } else {
+    // old row is still needed, modify the copy of its disk locator
+    MEMCPY(buf, old_disk_lob.ptr(), old_disk_lob.length());
+    ObLobAccessParam lob_param;
+    lob_param.tx_desc_ = run_ctx.store_ctx_.mvcc_acc_ctx_.tx_desc_;
+    lob_param.snapshot_ = run_ctx.dml_param_.snapshot_;
+    lob_param.is_total_quantity_log_ = run_ctx.dml_param_.is_total_quantity_log_;
+    if (lob_param.snapshot_.is_none_read()) {
+      lob_param.snapshot_.init_ls_read(run_ctx.store_ctx_.ls_id_,
+                                       run_ctx.store_ctx_.mvcc_acc_ctx_.snapshot_);
+    }
+    lob_param.tx_id_ = lob_param.tx_desc_->get_tx_id();
+    lob_param.sql_mode_ = run_ctx.dml_param_.sql_mode_;
+    lob_param.ls_id_ = run_ctx.store_ctx_.ls_id_;
+    lob_param.tablet_id_ = run_ctx.relative_table_.get_tablet_id();
+    lob_param.coll_type_ = column.col_type_.get_collation_type();
+    lob_param.allocator_ = &run_ctx.lob_allocator_;
+    lob_param.lob_locator_ = nullptr;
+    lob_param.lob_common_ = reinterpret_cast<ObLobCommon*>(buf);
+    lob_param.handle_size_ = old_disk_lob.length();
+    lob_param.byte_size_ = lob_param.lob_common_->get_byte_size(lob_param.handle_size_);
+    lob_param.timeout_ = run_ctx.dml_param_.timeout_;
+    lob_param.scan_backward_ = false;
+    if (OB_FAIL(lob_mngr->process_diff(lob_param, new_lob))) {
+      LOG_WARN("[STORAGE_LOB]failed to process diff lob.", K(ret), K(lob_param));
+    } else {
+      obj.set_lob_value(obj.get_type(), lob_param.lob_common_, lob_param.handle_size_);
+    }
+  }
+  return ret;
+}
+
 int ObLSTabletService::process_lob_row(
     ObTabletHandle &tablet_handle,
     ObDMLRunningCtx &run_ctx,
@@ -4190,7 +4279,20 @@ int ObLSTabletService::process_lob_row(
           ObString new_lob_str = (new_obj.is_null() || new_obj.is_nop_value())
                                  ? ObString(0, nullptr) : new_obj.get_string();
           ObLobLocatorV2 new_lob(new_lob_str, new_obj.has_lob_header());
+          bool partial_update = false;
+          ObString old_disk_lob;
           if (OB_FAIL(ret)) {
+          } else if (OB_FAIL(check_lob_partial_update(run_ctx.col_descs_->at(i), data_tbl_rowkey_change,
+                                                      run_ctx.dml_param_.is_total_quantity_log_, old_sql_obj,
+                                                      new_lob, partial_update, old_disk_lob))) {
+            LOG_WARN("[STORAGE_LOB]failed to check lob partial update", K(ret));
+          }
+          if (OB_FAIL(ret)) {
+          } else if (partial_update) {
+            // rewrite modified pieces only, redo is not proportional to the size of lob
+            if (OB_FAIL(process_diff_lob(run_ctx, run_ctx.col_descs_->at(i), old_disk_lob, new_lob, new_obj))) {
+              LOG_WARN("[STORAGE_LOB]failed to process diff lob.", K(ret));
+            }
           } else if (new_obj.is_null() || new_obj.is_nop_value() || new_lob.is_full_temp_lob() || new_lob.is_persist_lob()) {
             ObLobCommon *lob_common = nullptr;
             ObLobAccessParam lob_param;
@@ -681,6 +681,20 @@ private:
       ObObj &old_obj,
       ObLobLocatorV2 &delta_lob,
       ObObj &obj);
+  static int check_lob_partial_update(
+      const ObColDesc &column,
+      const bool data_tbl_rowkey_change,
+      const bool is_total_quantity_log,
+      ObObj &old_obj,
+      ObLobLocatorV2 &new_lob,
+      bool &partial_update,
+      ObString &old_disk_lob);
+  static int process_diff_lob(
+      ObDMLRunningCtx &run_ctx,
+      const ObColDesc &column,
+      const ObString &old_disk_lob,
+      ObLobLocatorV2 &new_lob,
+      ObObj &obj);
   static int process_lob_row(
       ObTabletHandle &tablet_handle,
       ObDMLRunningCtx &run_ctx,
@@ -593,9 +593,11 @@ int ObQueryEngine::split_range(const ObMemtableKey *start_key,
         TRANS_LOG(WARN, "estimate size fail", K(ret), K(*start_key), K(*end_key));
       } else if (OB_ENTRY_NOT_EXIST == ret) {
         TRANS_LOG(WARN, "range too small, not enough rows ro split", K(ret), K(*start_key), K(*end_key), K(part_count));
-      } else if (branch_count < part_count) {
+      } else if (branch_count <= 1) {
         ret = OB_ENTRY_NOT_EXIST;
-        TRANS_LOG(WARN, "branch fan out less than part count", K(branch_count), K(part_count));
+        TRANS_LOG(WARN, "branch fan out too small to split", K(branch_count), K(part_count));
+      } else if (FALSE_IT(part_count = MIN(part_count, branch_count))) {
+        // split as many parts as the fan out allows, callers use range_array.count()
       } else if (OB_FAIL(init_raw_iter_for_estimate(iter, start_key, end_key))) {
         TRANS_LOG(WARN, "init raw iter fail", K(ret), K(*start_key), K(*end_key));
       } else if (NULL == iter) {
@@ -101,6 +101,7 @@ ObLockWaitMgr::ObLockWaitMgr()
       deadlocked_sessions_index_(0)
 {
   memset(sequence_, 0, sizeof(sequence_));
+  memset(wait_time_, 0, sizeof(wait_time_));
 }
 
 ObLockWaitMgr::~ObLockWaitMgr() {}
@@ -216,7 +217,11 @@ bool ObLockWaitMgr::post_process(bool need_retry, bool& need_wait)
       wakeup(hold_key);
     }
     if (need_retry) {
-      if ((need_wait = node->need_wait())) {
+      if ((need_wait = node->need_wait()) && spin_wait_(node)) {
+        // the lock is released while spinning, the request skips the wait hash and the
+        // deadlock detector, and is requeued by the worker without waiting for a wakeup
+        TRANS_LOG(TRACE, "lock released while spinning", KPC(node));
+      } else if (need_wait) {
         // FIXME(xuwang.txw):create detector in check_timeout process
         // below code must keep current order to fix concurrency bug
         // more info see https://yuque.antfin.com/ob/transaction/arlswh
@@ -346,6 +351,57 @@ bool ObLockWaitMgr::wait(Node* node)
   return wait_succ;
 }
 
+bool ObLockWaitMgr::spin_wait_(const Node *node)
+{
+  bool released = false;
+  const uint64_t hash = node->hash();
+  const int64_t wait_time = ATOMIC_LOAD(&wait_time_[(hash >> 1) % LOCK_BUCKET_COUNT]);
+  // 1. no history or long waits: park at once
+  // 2. some requests are parked on the row already(hot row): park behind them, so that the
+  //    waiters are served in order and only one of them is woken up on each release
+  if (has_set_stop() || wait_time <= 0 || wait_time > MAX_SPIN_WAIT_US) {
+  } else if (is_rowkey_hash(hash) && has_waiter_(hash)) {
+  } else {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    const int64_t spin_time = MIN(2 * wait_time, MAX_SPIN_WAIT_US);
+    const int64_t lock_seq = node->lock_seq_;
+    for (int64_t i = 1; !released; ++i) {
+      if (get_seq(hash) != lock_seq) {
+        released = true;
+      } else if (0 == i % SPIN_YIELD_INTERVAL) {
+        if (ObTimeUtility::current_time() - start_ts > spin_time) {
+          break;
+        }
+        sched_yield();
+      } else {
+        PAUSE();
+      }
+    }
+    if (released) {
+      update_wait_time_(hash, ObTimeUtility::current_time() - start_ts);
+    }
+  }
+  return released;
+}
+
+bool ObLockWaitMgr::has_waiter_(const uint64_t hash)
+{
+  CriticalGuard(get_qs());
+  Node *node = NULL;
+  return NULL != hash_.get(hash, node);
+}
+
+void ObLockWaitMgr::update_wait_time_(const uint64_t hash, const int64_t wait_time)
+{
+  // wait_time = 7/8 * wait_time + 1/8 * new_wait_time, racy update is acceptable
+  int64_t &avg_wait_time = wait_time_[(hash >> 1) % LOCK_BUCKET_COUNT];
+  const int64_t old_wait_time = ATOMIC_LOAD(&avg_wait_time);
+  const int64_t new_wait_time = MAX(1, wait_time);
+  ATOMIC_STORE(&avg_wait_time, old_wait_time <= 0 ? new_wait_time
+                                                  : old_wait_time - (old_wait_time >> 3)
+                                                    + (new_wait_time >> 3));
+}
+
 void ObLockWaitMgr::wakeup(uint64_t hash)
 {
   TRANS_LOG(TRACE, "LockWaitMgr.wakeup.start", K(hash));
@@ -354,8 +410,10 @@ void ObLockWaitMgr::wakeup(uint64_t hash)
     node = fetch_waiter(hash);
 
     if (NULL != node) {
+      const int64_t wait_time = ObTimeUtility::current_time() - node->lock_ts_;
       EVENT_INC(MEMSTORE_WRITE_LOCK_WAKENUP_COUNT);
-      EVENT_ADD(MEMSTORE_WAIT_WRITE_LOCK_TIME, ObTimeUtility::current_time() - node->lock_ts_);
+      EVENT_ADD(MEMSTORE_WAIT_WRITE_LOCK_TIME, wait_time);
+      update_wait_time_(hash, wait_time);
       node->on_retry_lock(hash);
       (void)repost(node);
     }
@@ -186,6 +186,10 @@ public:
 public:
   enum { LOCK_BUCKET_COUNT = 16384};
   static const int64_t OB_SESSPAIR_COUNT = 16;
+  // the request spins on the lock sequence before parking only if the recent waits
+  // on the same bucket are shorter than this
+  static const int64_t MAX_SPIN_WAIT_US = 200;
+  static const int64_t SPIN_YIELD_INTERVAL = 64;
   typedef ObMemtableKey Key;
   typedef rpc::ObLockWaitNode Node;
   typedef FixedHash2<Node> Hash;
@@ -285,6 +289,10 @@ protected:
 private:
   int64_t get_wait_lock_timeout(int64_t timeout);
   bool wait(Node* node);
+  // spin or yield for a short while before parking, return true if the lock is released
+  bool spin_wait_(const Node *node);
+  bool has_waiter_(const uint64_t hash);
+  void update_wait_time_(const uint64_t hash, const int64_t wait_time);
   Node* get(uint64_t hash);
   void wakeup(uint64_t hash);
 private:
@@ -331,6 +339,8 @@ private:
   bool is_inited_;
   Hash hash_;
   int64_t sequence_[LOCK_BUCKET_COUNT];
+  // moving average of the lock wait time(us) of each bucket
+  int64_t wait_time_[LOCK_BUCKET_COUNT];
   char hash_buf_[sizeof(SpHashNode) * LOCK_BUCKET_COUNT];
 
 public:
@@ -2743,6 +2743,10 @@ int ObMemtable::post_row_write_conflict_(ObMvccAccessCtx &acc_ctx,
     mem_ctx->on_wlock_retry(row_key, conflict_tx_id);
     int tmp_ret = OB_SUCCESS;
     auto tx_ctx = acc_ctx.tx_ctx_;
+    // the writer queued on a row lock is a candidate of hot row early lock
+    // release, so that the next waiter is woken up once its commit log is
+    // submitted and the commits of the row are batched by the log group
+    tx_ctx->set_hot_row_writer();
     auto tx_id = acc_ctx.get_tx_id();
     bool remote_tx = tx_ctx->get_scheduler() != tx_ctx->get_addr();
     ObFunction<int(bool&, bool&)> recheck_func([&](bool &locked, bool &wait_on_row) -> int {
@@ -77,6 +77,14 @@ void ObTenantMetaMemMgr::RefreshConfigTask::runTimerTask()
   }
 }
 
+void ObTenantMetaMemMgr::TabletWashTask::runTimerTask()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(t3m_->wash_resident_tablets())) {
+    LOG_WARN("fail to wash resident tablets", K(ret));
+  }
+}
+
 ObTenantMetaMemMgr::ObTenantMetaMemMgr(const uint64_t tenant_id)
   : cmp_ret_(OB_SUCCESS),
     compare_(cmp_ret_),
@@ -90,6 +98,7 @@ ObTenantMetaMemMgr::ObTenantMetaMemMgr(const uint64_t tenant_id)
     table_gc_task_(this),
     min_minor_sstable_gc_task_(this),
     refresh_config_task_(),
+    tablet_wash_task_(this),
     free_tables_queue_(),
     gc_queue_lock_(common::ObLatchIds::TENANT_META_MEM_MGR_LOCK),
     last_min_minor_sstable_set_(),
@@ -192,6 +201,9 @@ int ObTenantMetaMemMgr::start()
   } else if (OB_FAIL(timer_.schedule(refresh_config_task_, REFRESH_CONFIG_INTERVAL_US,
       true/*repeat*/))) {
     LOG_WARN("fail to schedule refresh config task", K(ret));
+  } else if (OB_FAIL(timer_.schedule(tablet_wash_task_, TABLET_WASH_INTERVAL_US,
+      true/*repeat*/))) {
+    LOG_WARN("fail to schedule tablet wash task", K(ret));
   }
   return ret;
 }
@@ -1507,6 +1519,66 @@ int64_t ObTenantMetaMemMgr::calc_wash_tablet_cnt() const
   return wash_cnt;
 }
 
+// Keep the count of resident tablets under the tenant quota in background, so that loading
+// a washed tablet on access seldom needs to wash others synchronously in allocator.
+int ObTenantMetaMemMgr::wash_resident_tablets()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init ObTenantMetaMemMgr", K(ret));
+  } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id_));
+    const int64_t resident_limit = tenant_config.is_valid()
+        ? tenant_config->_storage_meta_resident_tablet_limit : 0;
+    if (OB_FAIL(wash_resident_tablets_(resident_limit))) {
+      LOG_WARN("fail to wash resident tablets", K(ret), K(resident_limit));
+    }
+  }
+  return ret;
+}
+
+int ObTenantMetaMemMgr::wash_resident_tablets_(const int64_t resident_limit)
+{
+  int ret = OB_SUCCESS;
+  const int64_t resident_cnt = tablet_pool_.get_used_obj_cnt();
+  if (resident_limit <= 0 || resident_cnt <= resident_limit) {
+    // under quota
+  } else {
+    const int64_t wash_cnt = min(MAX_WASH_TABLET_CNT_ONE_ROUND,
+        resident_cnt - resident_limit * RESIDENT_TABLET_LOW_WATERMARK_PCT / 100);
+    int cmp_ret = OB_SUCCESS;
+    HeapCompare compare(cmp_ret);
+    ObArray<InMemoryPinnedTabletInfo> mem_addr_tablet_info;
+    ObArenaAllocator allocator;
+    Heap heap(compare, &allocator);
+    GetWashTabletCandidate op(heap, mem_addr_tablet_info, *this, allocator);
+    int64_t wash_inner_cnt = 0;
+    int64_t wash_user_cnt = 0;
+    ObTimeGuard wash_time("wash_resident_tablets");
+    // the candidates are collected without wash_lock_, so that the allocating threads which
+    // wash synchronously are not blocked by the scan of the whole tablet map. wash_meta_obj
+    // checks the reference of each candidate again before washing it.
+    if (OB_FAIL(tablet_map_.for_each_value_store(op))) {
+      LOG_WARN("fail to get candidate tablet for wash", K(ret));
+    } else {
+      wash_time.click("get_candidate");
+      SpinWLockGuard guard(wash_lock_);
+      wash_time.click("wait_lock");
+      if (OB_FAIL(do_wash_candidate_tablet(wash_cnt, heap, wash_inner_cnt, wash_user_cnt))) {
+        LOG_WARN("fail to do wash candidate tablet", K(ret), K(wash_cnt));
+      }
+      wash_time.click("do_wash");
+    }
+    if (REACH_TIME_INTERVAL(10 * 1000 * 1000L)) { // 10s
+      FLOG_INFO("wash resident tablets exceeding quota", K(ret), K(resident_cnt),
+          K(resident_limit), K(wash_cnt), K(wash_inner_cnt), K(wash_user_cnt),
+          "remain_cnt", tablet_pool_.get_used_obj_cnt(), K(op), K(wash_time));
+    }
+  }
+  return ret;
+}
+
 int ObTenantMetaMemMgr::write_slog_and_wash_tablet(
     const ObTabletMapKey &key,
     const ObMetaDiskAddr &old_addr,
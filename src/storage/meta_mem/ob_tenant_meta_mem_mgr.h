@@ -287,6 +287,15 @@ private:
     virtual ~RefreshConfigTask() = default;
     virtual void runTimerTask() override;
   };
+  class TabletWashTask : public common::ObTimerTask
+  {
+  public:
+    explicit TabletWashTask(ObTenantMetaMemMgr *t3m) : t3m_(t3m) {}
+    virtual ~TabletWashTask() = default;
+    virtual void runTimerTask() override;
+  private:
+    ObTenantMetaMemMgr *t3m_;
+  };
   class MinMinorSSTableInfo final
   {
   public:
@@ -324,6 +333,7 @@ private:
   friend class ObT3mTabletMapIterator;
   friend class GetWashTabletCandidate;
   friend class TableGCTask;
+  friend class TabletWashTask;
   friend class ObTabletPointer;
   static const int64_t DEFAULT_BUCKET_NUM = 10243L;
   static const int64_t TOTAL_LIMIT = 15 * 1024L * 1024L * 1024L;
@@ -331,6 +341,9 @@ private:
   static const int64_t TABLE_GC_INTERVAL_US = 20 * 1000L; // 20ms
   static const int64_t MIN_MINOR_SSTABLE_GC_INTERVAL_US = 1 * 1000 * 1000L; // 1s
   static const int64_t REFRESH_CONFIG_INTERVAL_US = 10 * 1000 * 1000L; // 10s
+  static const int64_t TABLET_WASH_INTERVAL_US = 1 * 1000 * 1000L; // 1s
+  static const int64_t RESIDENT_TABLET_LOW_WATERMARK_PCT = 90; // wash to 90% of resident limit
+  static const int64_t MAX_WASH_TABLET_CNT_ONE_ROUND = 30000;
   static const int64_t ONE_ROUND_RECYCLE_COUNT_THRESHOLD = 20000L;
   static const int64_t DEFAULT_TABLET_WASH_HEAP_COUNT = 16;
   static const int64_t DEFAULT_MINOR_SSTABLE_SET_COUNT = 49999;
@@ -406,6 +419,8 @@ private:
       const ObMetaDiskAddr &old_addr,
       bool &is_wash);
   int64_t calc_wash_tablet_cnt() const;
+  int wash_resident_tablets();
+  int wash_resident_tablets_(const int64_t resident_limit);
   void dump_tablet();
   void dump_pinned_tablet() const;
   void dump_ls(ObLSService &ls_service) const;
@@ -440,6 +455,7 @@ private:
   TableGCTask table_gc_task_;
   MinMinorSSTableGCTask min_minor_sstable_gc_task_;
   RefreshConfigTask refresh_config_task_;
+  TabletWashTask tablet_wash_task_;
   common::ObLinkQueue free_tables_queue_;
   common::ObSpinLock gc_queue_lock_;
   SSTableSet last_min_minor_sstable_set_;
@@ -27,11 +27,12 @@ using namespace oceanbase::common;
 using namespace oceanbase::blocksstable;
 
 ObLinkedMacroBlockReader::ObLinkedMacroBlockReader()
-  : is_inited_(false), handle_pos_(0), macros_handle_(), prefetch_macro_block_idx_(0),
-    read_macro_block_cnt_(0)
+  : is_inited_(false), handle_pos_(0), read_handle_pos_(0), macros_handle_(),
+    prefetch_macro_block_idx_(0), read_macro_block_cnt_(0)
 {
-  handles_[0].reset();
-  handles_[1].reset();
+  for (int64_t i = 0; i < PREFETCH_DEPTH; ++i) {
+    handles_[i].reset();
+  }
 }
 
 int ObLinkedMacroBlockReader::init(const MacroBlockId &entry_block)
@@ -42,10 +43,16 @@ int ObLinkedMacroBlockReader::init(const MacroBlockId &entry_block)
     LOG_WARN("ObLinkedMacroBlockReader has been inited twice", K(ret));
   } else if (OB_FAIL(get_meta_blocks(entry_block))) {
     LOG_WARN("fail to get meta blocks", K(ret));
-  } else if (OB_FAIL(prefetch_block())) {
-    LOG_WARN("fail to prefetch block", K(ret));
   } else {
-    is_inited_ = true;
+    // keep one handle for the block returned to caller
+    for (int64_t i = 0; OB_SUCC(ret) && i < PREFETCH_DEPTH - 1; ++i) {
+      if (OB_FAIL(prefetch_block())) {
+        LOG_WARN("fail to prefetch block", K(ret), K(i));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      is_inited_ = true;
+    }
   }
   return ret;
 }
@@ -114,7 +121,7 @@ int ObLinkedMacroBlockReader::prefetch_block()
     if (OB_FAIL(ObBlockManager::async_read_block(read_info, handles_[handle_pos_]))) {
       LOG_WARN("fail to async read block", K(ret));
     } else {
-      handle_pos_ = 1 - handle_pos_;
+      handle_pos_ = (handle_pos_ + 1) % PREFETCH_DEPTH;
       --prefetch_macro_block_idx_;
     }
   }
@@ -124,7 +131,9 @@ int ObLinkedMacroBlockReader::prefetch_block()
 int ObLinkedMacroBlockReader::iter_read_block(char *&buf, int64_t &buf_len, MacroBlockId &block_id)
 {
   int ret = OB_SUCCESS;
-  const int64_t read_handle_pos = 1 - handle_pos_;
+  // the handle of the block returned last time is reused by the prefetch here, as
+  // the caller has done with it
+  const int64_t read_handle_pos = read_handle_pos_;
   const int64_t io_timeout_ms = GCONF._data_storage_io_timeout / 1000L;
   if (read_macro_block_cnt_ >= macros_handle_.count()) {
     ret = OB_ITER_END;
@@ -140,6 +149,7 @@ int ObLinkedMacroBlockReader::iter_read_block(char *&buf, int64_t &buf_len, Macr
       LOG_WARN("fail to check data checksum", K(ret));
     } else {
       ++read_macro_block_cnt_;
+      read_handle_pos_ = (read_handle_pos_ + 1) % PREFETCH_DEPTH;
     }
   }
   return ret;
@@ -213,9 +223,11 @@ ObIArray<MacroBlockId> &ObLinkedMacroBlockReader::get_meta_block_list()
 void ObLinkedMacroBlockReader::reset()
 {
   is_inited_ = false;
-  handles_[0].reset();
-  handles_[1].reset();
+  for (int64_t i = 0; i < PREFETCH_DEPTH; ++i) {
+    handles_[i].reset();
+  }
   handle_pos_ = 0;
+  read_handle_pos_ = 0;
   macros_handle_.reset();
   prefetch_macro_block_idx_ = 0;
   read_macro_block_cnt_ = 0;
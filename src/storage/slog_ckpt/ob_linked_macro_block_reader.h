@@ -50,9 +50,12 @@ private:
   static int check_data_checksum(const char *buf, const int64_t buf_len);
 
 private:
+  // the count of macro blocks being read in flight, one of them is held by caller
+  static const int64_t PREFETCH_DEPTH = 8;
   bool is_inited_;
-  blocksstable::ObMacroBlockHandle handles_[2];
+  blocksstable::ObMacroBlockHandle handles_[PREFETCH_DEPTH];
   int64_t handle_pos_;
+  int64_t read_handle_pos_;
   blocksstable::ObMacroBlocksHandle macros_handle_;
   int64_t prefetch_macro_block_idx_;
   int64_t read_macro_block_cnt_;
@@ -53,6 +53,27 @@ void ObTenantCheckpointSlogHandler::ObWriteCheckpointTask::runTimerTask()
   }
 }
 
+void ObTenantCheckpointSlogHandler::ObLoadTabletThreadPool::run1()
+{
+  int ret = OB_SUCCESS;
+  char *buf = nullptr;
+  int64_t buf_len = 0;
+  lib::set_thread_name("LoadTablet");
+  while (OB_SUCC(ret) && OB_SUCCESS == get_ret() && !has_set_stop()) {
+    const int64_t idx = ATOMIC_FAA(&next_idx_, 1);
+    if (idx >= tablets_.count()) {
+      break;
+    } else if (OB_FAIL(handler_.replay_load_tablet(tablets_.at(idx), buf, buf_len))) {
+      LOG_WARN("fail to load tablet", K(ret), K(idx), K(tablets_.at(idx)));
+      (void)ATOMIC_BCAS(&ret_, OB_SUCCESS, ret);
+    }
+  }
+  if (OB_NOT_NULL(buf)) {
+    ob_free(buf);
+    buf = nullptr;
+  }
+}
+
 ObTenantCheckpointSlogHandler::ObTenantCheckpointSlogHandler()
   : is_inited_(false),
     is_writing_checkpoint_(false),
@@ -63,7 +84,8 @@ ObTenantCheckpointSlogHandler::ObTenantCheckpointSlogHandler()
     tablet_block_handle_(),
     tg_id_(-1),
     write_ckpt_task_(this),
-    replay_tablet_disk_addr_map_()
+    replay_tablet_disk_addr_map_(),
+    replay_stat_()
 {
 }
 
@@ -153,6 +175,8 @@ int ObTenantCheckpointSlogHandler::replay_checkpoint_and_slog(const ObTenantSupe
   int ret = OB_SUCCESS;
   const ObMemAttr mem_attr(MTL_ID(), "TenantReplay");
   const int64_t replay_tablet_cnt = 10003;
+  const int64_t start_time = ObTimeUtility::current_time();
+  replay_stat_.reset();
   if (OB_UNLIKELY(!is_inited_)) {
     ret = OB_NOT_INIT;
     LOG_WARN("ObTenantCheckpointSlogHandler not init", K(ret));
@@ -167,6 +191,12 @@ int ObTenantCheckpointSlogHandler::replay_checkpoint_and_slog(const ObTenantSupe
   } else {
     replay_tablet_disk_addr_map_.destroy();
   }
+  const int64_t cost_time = ObTimeUtility::current_time() - start_time;
+  FLOG_INFO("finish replay tenant checkpoint and slog", K(ret), K(cost_time), K_(replay_stat));
+  SERVER_EVENT_ADD("storage", "replay tenant checkpoint and slog", "tenant_id", MTL_ID(),
+      "ret", ret, "cost_time(us)", cost_time, "ckpt_cost(us)",
+      replay_stat_.ls_ckpt_cost_ + replay_stat_.tablet_ckpt_cost_, "slog_cost(us)", replay_stat_.slog_cost_,
+      "load_tablet_cost(us)", replay_stat_.load_tablet_cost_, replay_stat_);
   return ret;
 }
 
@@ -176,6 +206,7 @@ int ObTenantCheckpointSlogHandler::replay_checkpoint(const ObTenantSuperBlock &s
 
   ObTenantStorageCheckpointReader tenant_storage_ckpt_reader;
   ObArray<MacroBlockId> meta_block_list;
+  int64_t start_time = 0;
 
   ObTenantStorageCheckpointReader::ObCheckpointMetaOp replay_ls_op =
       std::bind(&ObTenantCheckpointSlogHandler::replay_ls_meta,
@@ -190,16 +221,21 @@ int ObTenantCheckpointSlogHandler::replay_checkpoint(const ObTenantSuperBlock &s
   } else if (!replay_tablet_op.is_valid()) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("replay_tablet_op invalid", K(ret));
+  } else if (FALSE_IT(start_time = ObTimeUtility::current_time())) {
   } else if (OB_FAIL(tenant_storage_ckpt_reader.iter_read_checkpoint_item(
       super_block.ls_meta_entry_, replay_ls_op, meta_block_list))) {
     LOG_WARN("fail to replay ls meta checkpoint", K(ret));
   } else if (OB_FAIL(ls_block_handle_.add_macro_blocks(meta_block_list, true /*switch handle*/))) {
     LOG_WARN("fail to add_macro_blocks", K(ret));
+  } else if (FALSE_IT(replay_stat_.ls_ckpt_cost_ = ObTimeUtility::current_time() - start_time)) {
+  } else if (FALSE_IT(start_time = ObTimeUtility::current_time())) {
   } else if (OB_FAIL(tenant_storage_ckpt_reader.iter_read_checkpoint_item(
       super_block.tablet_meta_entry_, replay_tablet_op, meta_block_list))) {
     LOG_WARN("fail to replay tablet checkpoint", K(ret));
   } else if (OB_FAIL(tablet_block_handle_.add_macro_blocks(meta_block_list, true /*switch handle*/))) {
     LOG_WARN("fail to add_macro_blocks", K(ret));
+  } else {
+    replay_stat_.tablet_ckpt_cost_ = ObTimeUtility::current_time() - start_time;
   }
 
   LOG_INFO("finish replay tenant checkpoint", K(ret), K(super_block));
@@ -255,6 +291,7 @@ int ObTenantCheckpointSlogHandler::replay_tenant_slog(const common::ObLogCursor
   log_file_spec.retry_write_policy_ = "normal";
   log_file_spec.log_create_policy_ = "normal";
   log_file_spec.log_write_policy_ = "truncate";
+  const int64_t start_time = ObTimeUtility::current_time();
 
   if (OB_FAIL(replayer.init(MTL(ObStorageLogger *)->get_dir(), log_file_spec))) {
     LOG_WARN("fail to init slog replayer", K(ret));
@@ -263,6 +300,7 @@ int ObTenantCheckpointSlogHandler::replay_tenant_slog(const common::ObLogCursor
     LOG_WARN("fail to register redo module", K(ret));
   } else if (OB_FAIL(replayer.replay(start_point, replay_finish_point, MTL_ID()))) {
     LOG_WARN("fail to replay tenant slog", K(ret));
+  } else if (FALSE_IT(replay_stat_.slog_cost_ = ObTimeUtility::current_time() - start_time)) {
   } else if (OB_FAIL(replay_load_tablets())) {
     LOG_WARN("fail to replay load tablets", K(ret));
   } else if (OB_FAIL(replayer.replay_over())) {
@@ -279,11 +317,9 @@ int ObTenantCheckpointSlogHandler::replay_tenant_slog(const common::ObLogCursor
 int ObTenantCheckpointSlogHandler::replay_load_tablets()
 {
   int ret = OB_SUCCESS;
-  const ObMemAttr mem_attr(MTL_ID(), "TenantReplay");
+  const int64_t start_time = ObTimeUtility::current_time();
   char *buf = nullptr;
   int64_t buf_len = 0;
-  char *r_buf = nullptr;
-  int64_t r_len = 0;
   ObArray<ObTabletMapKey> tablets;
   ReplayTabletDiskAddrMap::iterator iter = replay_tablet_disk_addr_map_.begin();
   while (OB_SUCC(ret) && iter != replay_tablet_disk_addr_map_.end()) {
@@ -315,48 +351,109 @@ int ObTenantCheckpointSlogHandler::replay_load_tablets()
       return ret;
     });
   }
-  for (int64_t i = 0; OB_SUCC(ret) && i < tablets.count(); ++i) {
-    const ObTabletMapKey &map_key = tablets.at(i);
-    ObMetaDiskAddr tablet_addr;
-    ObLSTabletService *ls_tablet_svr = nullptr;
-    ObLSHandle ls_handle;
-    if (OB_FAIL(replay_tablet_disk_addr_map_.get_refactored(map_key, tablet_addr))) {
-      LOG_WARN("fail to get tablet address", K(ret), K(map_key));
+  // the inner tablets are loaded in order before others, the user tablets
+  // are independent of each other and loaded concurrently if there are many
+  int64_t user_tablet_start_idx = 0;
+  while (OB_SUCC(ret) && user_tablet_start_idx < tablets.count()
+      && tablets.at(user_tablet_start_idx).tablet_id_.is_inner_tablet()) {
+    if (OB_FAIL(replay_load_tablet(tablets.at(user_tablet_start_idx), buf, buf_len))) {
+      LOG_WARN("fail to load inner tablet", K(ret), K(tablets.at(user_tablet_start_idx)));
     } else {
-      if (OB_NOT_NULL(buf)) {
-        if (buf_len >= tablet_addr.size()) {
-          // reuse last buf to reduce malloc
-        } else {
-          ob_free(buf);
-          buf = nullptr;
-          buf_len = 0;
-        }
-      }
-      if (OB_ISNULL(buf)) {
-        if (OB_ISNULL(buf = (char*)ob_malloc(tablet_addr.size(), mem_attr))) {
-          ret = OB_ALLOCATE_MEMORY_FAILED;
-          LOG_WARN("fail to allocate tablet buffer", K(ret), K(tablet_addr));
-        } else {
-          buf_len = tablet_addr.size();
-        }
-      }
+      ++user_tablet_start_idx;
     }
-
-    if (OB_FAIL(ret)) {
-    } else if (OB_FAIL(read_from_disk_addr(tablet_addr, buf, buf_len, r_buf, r_len))) {
-      LOG_WARN("fail to read tablet from addr", K(ret), K(tablet_addr));
-    } else if (OB_FAIL(get_tablet_svr(map_key.ls_id_, ls_tablet_svr, ls_handle))) {
-     LOG_WARN("fail to get ls tablet service", K(ret));
-    } else if (OB_FAIL(ls_tablet_svr->replay_create_tablet(
-        tablet_addr, r_buf, r_len, map_key.tablet_id_))) {
-     LOG_WARN("fail to create tablet for replay", K(ret), K(map_key), K(tablet_addr));
+  }
+  if (OB_FAIL(ret)) {
+  } else if (tablets.count() - user_tablet_start_idx >= 2 * MIN_LOAD_TABLET_CNT_PER_THREAD) {
+    if (OB_FAIL(parallel_load_tablets(tablets, user_tablet_start_idx))) {
+      LOG_WARN("fail to load tablets in parallel", K(ret), K(user_tablet_start_idx));
+    }
+  } else {
+    replay_stat_.load_thread_cnt_ = 1;
+    for (int64_t i = user_tablet_start_idx; OB_SUCC(ret) && i < tablets.count(); ++i) {
+      if (OB_FAIL(replay_load_tablet(tablets.at(i), buf, buf_len))) {
+        LOG_WARN("fail to load tablet", K(ret), K(tablets.at(i)));
+      }
     }
-    LOG_INFO("Successfully load tablet", K(map_key), K(tablet_addr));
   }
   if (OB_NOT_NULL(buf)) {
     ob_free(buf);
     buf = nullptr;
   }
+  replay_stat_.tablet_cnt_ = tablets.count();
+  replay_stat_.load_tablet_cost_ = ObTimeUtility::current_time() - start_time;
+  return ret;
+}
+
+int ObTenantCheckpointSlogHandler::parallel_load_tablets(
+    const ObIArray<ObTabletMapKey> &tablets,
+    const int64_t start_idx)
+{
+  int ret = OB_SUCCESS;
+  const int64_t tablet_cnt = tablets.count() - start_idx;
+  const int64_t thread_cnt = MAX(1, MIN(MIN(MAX_LOAD_TABLET_THREAD_CNT, get_cpu_count()),
+      tablet_cnt / MIN_LOAD_TABLET_CNT_PER_THREAD));
+  ObLoadTabletThreadPool load_pool(*this, tablets, start_idx);
+  load_pool.set_run_wrapper(MTL_CTX());
+  if (OB_FAIL(load_pool.set_thread_count(thread_cnt))) {
+    LOG_WARN("fail to set thread count", K(ret), K(thread_cnt));
+  } else if (OB_FAIL(load_pool.start())) {
+    LOG_WARN("fail to start load tablet threads", K(ret), K(thread_cnt));
+  } else {
+    load_pool.wait();
+    if (OB_FAIL(load_pool.get_ret())) {
+      LOG_WARN("fail to load tablets", K(ret), K(thread_cnt), K(tablet_cnt));
+    }
+  }
+  load_pool.destroy();
+  replay_stat_.load_thread_cnt_ = thread_cnt;
+  LOG_INFO("finish load tablets in parallel", K(ret), K(thread_cnt), K(tablet_cnt));
+  return ret;
+}
+
+int ObTenantCheckpointSlogHandler::replay_load_tablet(
+    const ObTabletMapKey &map_key,
+    char *&buf,
+    int64_t &buf_len)
+{
+  int ret = OB_SUCCESS;
+  const ObMemAttr mem_attr(MTL_ID(), "TenantReplay");
+  char *r_buf = nullptr;
+  int64_t r_len = 0;
+  ObMetaDiskAddr tablet_addr;
+  ObLSTabletService *ls_tablet_svr = nullptr;
+  ObLSHandle ls_handle;
+  if (OB_FAIL(replay_tablet_disk_addr_map_.get_refactored(map_key, tablet_addr))) {
+    LOG_WARN("fail to get tablet address", K(ret), K(map_key));
+  } else {
+    if (OB_NOT_NULL(buf)) {
+      if (buf_len >= tablet_addr.size()) {
+        // reuse last buf to reduce malloc
+      } else {
+        ob_free(buf);
+        buf = nullptr;
+        buf_len = 0;
+      }
+    }
+    if (OB_ISNULL(buf)) {
+      if (OB_ISNULL(buf = (char*)ob_malloc(tablet_addr.size(), mem_attr))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to allocate tablet buffer", K(ret), K(tablet_addr));
+      } else {
+        buf_len = tablet_addr.size();
+      }
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(read_from_disk_addr(tablet_addr, buf, buf_len, r_buf, r_len))) {
+    LOG_WARN("fail to read tablet from addr", K(ret), K(tablet_addr));
+  } else if (OB_FAIL(get_tablet_svr(map_key.ls_id_, ls_tablet_svr, ls_handle))) {
+   LOG_WARN("fail to get ls tablet service", K(ret));
+  } else if (OB_FAIL(ls_tablet_svr->replay_create_tablet(
+      tablet_addr, r_buf, r_len, map_key.tablet_id_))) {
+   LOG_WARN("fail to create tablet for replay", K(ret), K(map_key), K(tablet_addr));
+  }
+  LOG_INFO("Successfully load tablet", K(map_key), K(tablet_addr));
   return ret;
 }
 
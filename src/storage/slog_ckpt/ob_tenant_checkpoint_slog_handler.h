@@ -14,6 +14,7 @@
 #define OB_STORAGE_CKPT_TENANT_CHECKPOINT_SLOG_HANDLER_H_
 
 #include "common/log/ob_log_cursor.h"
+#include "share/ob_thread_pool.h"
 #include "storage/slog_ckpt/ob_linked_macro_block_struct.h"
 #include "storage/slog_ckpt/ob_tenant_storage_checkpoint_reader.h"
 #include "storage/meta_mem/ob_tablet_map_key.h"
@@ -56,6 +57,51 @@ public:
     ObTenantCheckpointSlogHandler *handler_;
   };
 
+  // cost of each phase when the tenant replays checkpoint and slog at startup
+  struct ObReplayStat
+  {
+  public:
+    ObReplayStat() { reset(); }
+    void reset()
+    {
+      ls_ckpt_cost_ = 0;
+      tablet_ckpt_cost_ = 0;
+      slog_cost_ = 0;
+      load_tablet_cost_ = 0;
+      tablet_cnt_ = 0;
+      load_thread_cnt_ = 0;
+    }
+    TO_STRING_KV(K_(ls_ckpt_cost), K_(tablet_ckpt_cost), K_(slog_cost), K_(load_tablet_cost),
+        K_(tablet_cnt), K_(load_thread_cnt));
+  public:
+    int64_t ls_ckpt_cost_;
+    int64_t tablet_ckpt_cost_;
+    int64_t slog_cost_;
+    int64_t load_tablet_cost_;
+    int64_t tablet_cnt_;
+    int64_t load_thread_cnt_;
+  };
+
+  // load the tablets of replay map concurrently, each thread fetches the next tablet
+  // to load from the shared cursor
+  class ObLoadTabletThreadPool : public share::ObThreadPool
+  {
+  public:
+    ObLoadTabletThreadPool(
+        ObTenantCheckpointSlogHandler &handler,
+        const common::ObIArray<ObTabletMapKey> &tablets,
+        const int64_t start_idx)
+      : handler_(handler), tablets_(tablets), next_idx_(start_idx), ret_(common::OB_SUCCESS) {}
+    virtual ~ObLoadTabletThreadPool() = default;
+    virtual void run1() override;
+    int get_ret() const { return ATOMIC_LOAD(&ret_); }
+  private:
+    ObTenantCheckpointSlogHandler &handler_;
+    const common::ObIArray<ObTabletMapKey> &tablets_;
+    int64_t next_idx_;
+    int ret_;
+  };
+
   ObTenantCheckpointSlogHandler();
   ~ObTenantCheckpointSlogHandler() = default;
   ObTenantCheckpointSlogHandler(const ObTenantCheckpointSlogHandler &) = delete;
@@ -86,6 +132,8 @@ private:
   int update_tablet_meta_addr_and_block_list(ObTenantStorageCheckpointWriter &ckpt_writer);
   int replay_tenant_slog(const common::ObLogCursor &start_point);
   int replay_load_tablets();
+  int replay_load_tablet(const ObTabletMapKey &map_key, char *&buf, int64_t &buf_len);
+  int parallel_load_tablets(const common::ObIArray<ObTabletMapKey> &tablets, const int64_t start_idx);
 
   int inner_replay_update_ls_slog(const ObRedoModuleReplayParam &param);
   int inner_replay_create_ls_slog(const ObRedoModuleReplayParam &param);
@@ -102,6 +150,8 @@ private:
   int remove_tablets_from_replay_map_(const share::ObLSID &ls_id);
 
 private:
+  static const int64_t MAX_LOAD_TABLET_THREAD_CNT = 16;
+  static const int64_t MIN_LOAD_TABLET_CNT_PER_THREAD = 1000;
   typedef common::hash::ObHashMap<ObTabletMapKey, ObMetaDiskAddr> ReplayTabletDiskAddrMap;
   bool is_inited_;
   bool is_writing_checkpoint_;
@@ -114,6 +164,7 @@ private:
   int tg_id_;
   ObWriteCheckpointTask write_ckpt_task_;
   ReplayTabletDiskAddrMap replay_tablet_disk_addr_map_;
+  ObReplayStat replay_stat_;
 };
 
 }  // end namespace storage
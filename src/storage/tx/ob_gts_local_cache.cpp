@@ -159,5 +159,26 @@ int ObGTSLocalCache::update_latest_srr(const MonotonicTs latest_srr)
   return ret;
 }
 
+bool ObGTSLocalCache::try_update_latest_srr(const MonotonicTs stc, const MonotonicTs latest_srr)
+{
+  bool bool_ret = false;
+  bool need_retry = true;
+
+  while (need_retry) {
+    const int64_t cur_latest_srr = ATOMIC_LOAD(&latest_srr_.mts_);
+    if (cur_latest_srr >= stc.mts_ || cur_latest_srr >= latest_srr.mts_) {
+      // request covering stc has been sent by others
+      need_retry = false;
+    } else if (ATOMIC_BCAS(&latest_srr_.mts_, cur_latest_srr, latest_srr.mts_)) {
+      bool_ret = true;
+      need_retry = false;
+    } else {
+      PAUSE();
+    }
+  }
+
+  return bool_ret;
+}
+
 } // transaction
 } // oceanbase
@@ -45,6 +45,10 @@ public:
   int get_gts(const MonotonicTs stc, int64_t &gts, MonotonicTs &receive_gts_ts, bool &need_send_rpc) const;
   int get_srr_and_gts_safe(MonotonicTs &srr, int64_t &gts, MonotonicTs &receive_gts_ts) const;
   int update_latest_srr(const MonotonicTs latest_srr);
+  // Try to become the sender of the gts request serving stc, it fails if another
+  // request sent not earlier than stc is in flight, and waiters of stc can be
+  // served by its response.
+  bool try_update_latest_srr(const MonotonicTs stc, const MonotonicTs latest_srr);
 
   TO_STRING_KV(K_(srr), K_(gts), K_(latest_srr));
 private:
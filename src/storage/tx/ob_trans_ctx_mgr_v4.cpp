@@ -2173,6 +2173,8 @@ int ObTxCtxMgr::remove_ls(const ObLSID &ls_id, const bool graceful)
         if (OB_FAIL(ls_tx_ctx_mgr_map_.del(ls_id, ls_tx_ctx_mgr))) {
           TRANS_LOG(WARN, "remove ls error", KR(ret), K(ls_id));
         } else {
+          // the ls tx ctx mgr deleted is released in batch, release it now
+          ls_tx_ctx_mgr_map_.reclaim_deleted();
           ATOMIC_INC(&ls_release_cnt_);
           TRANS_LOG(INFO, "remove ls success", "total_alloc", ls_alloc_cnt_,
                                                "total_release", ls_release_cnt_,
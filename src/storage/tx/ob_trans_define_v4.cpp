@@ -1238,6 +1238,8 @@ int ObTxDescMgr::wait()
     int i = 0;
     bool done = false;
     while (!done && i++ < MAX_RETRY_TIMES) {
+      // the tx descs deleted from map are released in batch, release them now
+      map_.reclaim_deleted();
       active_cnt = map_.alloc_cnt();
       if (!active_cnt) {
         TRANS_LOG(INFO, "txDescMgr.wait done.");
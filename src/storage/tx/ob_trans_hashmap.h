@@ -16,6 +16,8 @@
 #include "lib/ob_define.h"
 #include "lib/utility/ob_print_utils.h"
 #include "lib/container/ob_se_array.h"
+#include "lib/allocator/ob_qsync.h"
+#include "lib/lock/ob_spin_lock.h"
 /*
  * For Example
  * 
@@ -56,7 +58,16 @@
  *   get()          // ref++
  *   revert         // ref --; 
  *
- * 5. More Attentions are as followed:
+ * 5. Concurrency
+ *   get and the value snapshot of for_each/remove_if do not take the bucket lock,
+ *   readers are protected by qsync and only hold the values whose ref is not zero,
+ *   writers unlink the value under the bucket write lock, and the unlinked values are
+ *   retired after the lock is released: their links and refs are released in batch
+ *   once readers are quiescent. The values deleted by del() are batched across calls,
+ *   so a delete waits for readers once per batch, and a value is reclaimed first if it
+ *   is inserted again.
+ *
+ * 6. More Attentions are as followed:
  *
  * 1) 'Key -> Value' must be 1:1，otherwise you should not use such hashmap;
  * 2) 'Key -> Value' must be 1:1，otherwise you should not use such hashmap;
@@ -72,10 +83,11 @@ template<typename Value>
 class ObTransHashLink
 {
 public:
-  ObTransHashLink() : ref_(0), prev_(NULL), next_(NULL) {}
+  ObTransHashLink() : ref_(0), retiring_(false), prev_(NULL), next_(NULL) {}
   ~ObTransHashLink()
   {
     ref_ = 0;
+    retiring_ = false;
     prev_ = NULL;
     next_ = NULL;
   }
@@ -94,8 +106,23 @@ public:
     }
     return ref;
   }
+  // inc ref only if the value has not been released, used by lock free readers
+  inline bool try_inc_ref(int32_t x)
+  {
+    bool bool_ret = false;
+    int32_t ref = ATOMIC_LOAD(&ref_);
+    while (!bool_ret && ref > 0) {
+      const int32_t old_ref = ref;
+      if (old_ref == (ref = ATOMIC_VCAS(&ref_, old_ref, old_ref + x))) {
+        bool_ret = true;
+      }
+    }
+    return bool_ret;
+  }
   int32_t get_ref() const { return ref_; }
   int32_t ref_;
+  // deleted by del() and not reclaimed yet, readers may still be walking through it
+  bool retiring_;
   Value *prev_;
   Value *next_;
 };
@@ -104,8 +131,11 @@ template<typename Key, typename Value, typename AllocHandle, typename LockType,
 class ObTransHashMap
 {
  typedef common::ObSEArray<Value *, 32> ValueArray;
+ class RetireList;
 public:
-  ObTransHashMap() : is_inited_(false), total_cnt_(0)
+  // del() waits for readers once per batch of deleted values
+  static const int64_t DELETED_BATCH_CNT = 32;
+  ObTransHashMap() : is_inited_(false), total_cnt_(0), deleted_lock_(), deleted_cnt_(0)
   {
     OB_ASSERT(BUCKETS_CNT > 0);
   }
@@ -118,6 +148,8 @@ public:
       // del all value from hash backet
       Value *curr = nullptr;
       Value *next = nullptr;
+      RetireList retire_list(*this);
+      retire_deleted_(retire_list);
       for (int64_t i = 0; i < BUCKETS_CNT; ++i) {
         {
           BucketWLockGuard guard(buckets_[i].lock_, get_itid());
@@ -126,14 +158,16 @@ public:
           while (OB_NOT_NULL(curr)) {
             next = curr->next_;
             del_from_bucket_(i, curr);
-            // dec ref and free curr value
-            revert(curr);
+            // dec ref and free curr value after readers leave
+            retire_list.retire(curr);
             curr = next;
           }
         }
         // reset bucket
         buckets_[i].reset();
       }
+      retire_list.reclaim();
+      qsync_.destroy();
       total_cnt_ = 0;
       is_inited_ = false;
     }
@@ -158,7 +192,13 @@ public:
           }
         }
       }
-      if (OB_SUCC(ret)) {
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(qsync_.init(mem_attr))) {
+        TRANS_LOG(WARN, "ObTransHashMap qsync init fail", K(ret));
+        for (int64_t i = 0 ; i < BUCKETS_CNT; ++i) {
+          buckets_[i].destroy();
+        }
+      } else {
         is_inited_ = true;
       }
     }
@@ -180,6 +220,10 @@ public:
       ret = OB_INVALID_ARGUMENT;
       TRANS_LOG(WARN, "invalid argument", K(key), KP(value));
     } else {
+      if (ATOMIC_LOAD(&value->retiring_)) {
+        // the value is deleted just now and readers may still follow its links
+        reclaim_deleted();
+      }
       int64_t pos = key.hash() % BUCKETS_CNT;
       BucketWLockGuard guard(buckets_[pos].lock_, get_itid());
       Value *curr = buckets_[pos].next_;
@@ -199,7 +243,8 @@ public:
         }
         value->next_ = buckets_[pos].next_;
         value->prev_ = NULL;
-        buckets_[pos].next_ = value;
+        // publish the value after its links are ready for lock free readers
+        ATOMIC_STORE(&buckets_[pos].next_, value);
         ATOMIC_INC(&total_cnt_);
       } else {
         ret = OB_ENTRY_EXIST;
@@ -224,38 +269,119 @@ public:
       TRANS_LOG(ERROR, "invalid argument", K(key), KP(value));
     } else {
       int64_t pos = key.hash() % BUCKETS_CNT;
-      BucketWLockGuard guard(buckets_[pos].lock_, get_itid());
-      if (buckets_[pos].next_ != value &&
-          (NULL == value->prev_ && NULL == value->next_)) {
-        // do nothing
-      } else {
-        del_from_bucket_(pos, value);
-        revert(value);
+      bool deleted = false;
+      {
+        BucketWLockGuard guard(buckets_[pos].lock_, get_itid());
+        if (!is_in_bucket_(pos, value)) {
+          // do nothing
+        } else {
+          del_from_bucket_(pos, value);
+          deleted = true;
+        }
+      }
+      if (deleted) {
+        // dec the ref held by hashmap after readers leave, together with other deleted values
+        Value *values[DELETED_BATCH_CNT];
+        int64_t cnt = 0;
+        {
+          common::ObSpinLockGuard guard(deleted_lock_);
+          ATOMIC_STORE(&value->retiring_, true);
+          deleted_values_[deleted_cnt_++] = value;
+          if (DELETED_BATCH_CNT == deleted_cnt_) {
+            cnt = take_deleted_(values);
+          }
+        }
+        if (cnt > 0) {
+          WaitQuiescentDynamic(qsync_);
+          for (int64_t i = 0; i < cnt; ++i) {
+            reclaim_value_(values[i]);
+          }
+        }
       }
     }
     return ret;
   }
 
+  // reclaim the values deleted by del() after readers leave, used before checking
+  // that all values are freed
+  void reclaim_deleted()
+  {
+    RetireList retire_list(*this);
+    retire_deleted_(retire_list);
+    retire_list.reclaim();
+  }
+
+  // should be called under the bucket write lock
+  bool is_in_bucket_(const int64_t pos, const Value *value) const
+  {
+    // readers never walk backward, so prev_ is reset once the value is unlinked
+    return buckets_[pos].next_ == value || NULL != value->prev_;
+  }
+
+  // unlink curr under the bucket write lock, lock free readers may still be walking
+  // through curr, so its next_ is kept and curr should be reclaimed after they leave
   void del_from_bucket_(const int64_t pos, Value *curr)
   {
     if (curr == buckets_[pos].next_) {
-      if (NULL == curr->next_) {
-        buckets_[pos].next_ = NULL;
-      } else {
-        buckets_[pos].next_ = curr->next_;
-        curr->next_->prev_ = curr->prev_;
-      }
+      ATOMIC_STORE(&buckets_[pos].next_, curr->next_);
     } else {
-      curr->prev_->next_ = curr->next_;
-      if (NULL != curr->next_) {
-        curr->next_->prev_ = curr->prev_;
-      }
+      ATOMIC_STORE(&curr->prev_->next_, curr->next_);
+    }
+    if (NULL != curr->next_) {
+      curr->next_->prev_ = curr->prev_;
     }
     curr->prev_ = NULL;
-    curr->next_ = NULL;
     ATOMIC_DEC(&total_cnt_);
   }
 
+  // readers have left the unlinked value, release its links and the ref held for it
+  void reclaim_value_(Value *value)
+  {
+    value->next_ = NULL;
+    ATOMIC_STORE(&value->retiring_, false);
+    revert(value);
+  }
+
+  // should be called under deleted_lock_
+  int64_t take_deleted_(Value **values)
+  {
+    const int64_t cnt = deleted_cnt_;
+    MEMCPY(values, deleted_values_, sizeof(Value *) * cnt);
+    deleted_cnt_ = 0;
+    return cnt;
+  }
+
+  // move the values deleted by del() to retire_list
+  void retire_deleted_(RetireList &retire_list)
+  {
+    Value *values[DELETED_BATCH_CNT];
+    int64_t cnt = 0;
+    {
+      common::ObSpinLockGuard guard(deleted_lock_);
+      cnt = take_deleted_(values);
+    }
+    for (int64_t i = 0; i < cnt; ++i) {
+      retire_list.retire(values[i]);
+    }
+  }
+
+  // reclaim the values deleted by del() only if readers are quiescent now
+  void try_reclaim_deleted_()
+  {
+    Value *values[DELETED_BATCH_CNT];
+    int64_t cnt = 0;
+    if (ATOMIC_LOAD(&deleted_cnt_) > 0) {
+      common::ObSpinLockGuard guard(deleted_lock_);
+      // all the values taken are deleted before the check
+      if (deleted_cnt_ > 0 && qsync_.try_sync()) {
+        cnt = take_deleted_(values);
+      }
+    }
+    for (int64_t i = 0; i < cnt; ++i) {
+      reclaim_value_(values[i]);
+    }
+  }
+
   int get(const Key &key, Value *&value)
   {
     int ret = OB_SUCCESS;
@@ -270,23 +396,22 @@ public:
       Value *tmp_value = NULL;
       int64_t pos = key.hash() % BUCKETS_CNT;
 
-      BucketRLockGuard guard(buckets_[pos].lock_, get_itid());
+      CriticalGuardDynamic(qsync_);
 
-      tmp_value = buckets_[pos].next_;
+      tmp_value = ATOMIC_LOAD(&buckets_[pos].next_);
       while (OB_NOT_NULL(tmp_value)) {
         if (tmp_value->contain(key)) {
-          value = tmp_value;
           break;
         } else {
-          tmp_value = tmp_value->next_;
+          tmp_value = ATOMIC_LOAD(&tmp_value->next_);
         }
       }
 
-      if (OB_ISNULL(tmp_value)) {
+      // inc ref when get value, the value being released is treated as not exist
+      if (OB_ISNULL(tmp_value) || !tmp_value->try_inc_ref(1)) {
         ret = OB_ENTRY_NOT_EXIST;
       } else {
-        // inc ref when get value
-        value->inc_ref(1);
+        value = tmp_value;
       }
     }
     return ret;
@@ -307,6 +432,10 @@ public:
     for (int64_t pos = 0 ; OB_SUCC(ret) && pos < BUCKETS_CNT; ++pos) {
       ret = for_each_in_one_bucket(fn, pos);
     }
+    // the values deleted by del() may wait long for the batch if deletes are rare
+    if (is_inited_) {
+      try_reclaim_deleted_();
+    }
     return ret;
   }
 
@@ -325,10 +454,7 @@ public:
           if (OB_SUCC(ret) && !fn(array.at(i))) {
             ret = OB_EAGAIN;
           }
-          if (0 == array.at(i)->dec_ref(1)) {
-            alloc_handle_.free_value(array.at(i));
-          }
-
+          revert(array.at(i));
         }
       }
     }
@@ -340,6 +466,8 @@ public:
     int ret = common::OB_SUCCESS;
 
     ValueArray array;
+    // the values removed from all buckets are reclaimed in batch
+    RetireList retire_list(*this);
     for (int64_t pos = 0 ; pos < BUCKETS_CNT; ++pos) {
       array.reset();
       if (OB_FAIL(generate_value_arr_(pos, array))) {
@@ -347,45 +475,61 @@ public:
       } else {
         const int64_t cnt = array.count();
         for (int64_t i = 0; i < cnt; ++i) {
+          bool deleted = false;
           if (fn(array.at(i))) {
             BucketWLockGuard guard(buckets_[pos].lock_, get_itid());
-            if (buckets_[pos].next_ != array.at(i)
-                && (NULL == array.at(i)->prev_ && NULL == array.at(i)->next_)) {
+            if (!is_in_bucket_(pos, array.at(i))) {
               // do nothing
             } else {
               del_from_bucket_(pos, array.at(i));
+              deleted = true;
             }
           }
-          if (0 == array.at(i)->dec_ref(1)) {
-            alloc_handle_.free_value(array.at(i));
+          if (deleted) {
+            // the ref of the snapshot is released after readers leave
+            retire_list.retire(array.at(i));
+          } else {
+            revert(array.at(i));
           }
         }
       }
     }
+    // including the values deleted by fn with del()
+    if (is_inited_) {
+      retire_deleted_(retire_list);
+    }
+    retire_list.reclaim();
     return ret;
   }
 
   int generate_value_arr_(const int64_t bucket_pos, ValueArray &arr)
   {
     int ret = common::OB_SUCCESS;
-    // read lock
-    BucketRLockGuard guard(buckets_[bucket_pos].lock_, get_itid());
-    Value *val = buckets_[bucket_pos].next_;
-
-    while (OB_SUCC(ret) && OB_NOT_NULL(val)) {
-      val->inc_ref(1);
-      if (OB_FAIL(arr.push_back(val))) {
-        TRANS_LOG(WARN, "value array push back error", K(ret));
-        val->dec_ref(1);
+    if (IS_NOT_INIT) {
+      // empty bucket
+    } else {
+      // snapshot the bucket without blocking writers
+      CriticalGuardDynamic(qsync_);
+      Value *val = ATOMIC_LOAD(&buckets_[bucket_pos].next_);
+
+      while (OB_SUCC(ret) && OB_NOT_NULL(val)) {
+        if (!val->try_inc_ref(1)) {
+          // the value is being released, skip it
+        } else if (OB_FAIL(arr.push_back(val))) {
+          TRANS_LOG(WARN, "value array push back error", K(ret));
+          val->dec_ref(1);
+        }
+        val = ATOMIC_LOAD(&val->next_);
       }
-      val = val->next_;
     }
 
     if (OB_FAIL(ret)) {
+      // the values may be deleted from the bucket concurrently, so release them by revert
       const int64_t cnt = arr.count();
       for (int64_t i = 0; i < cnt; ++i) {
-        arr.at(i)->dec_ref(1);
+        revert(arr.at(i));
       }
+      arr.reset();
     }
     return ret;
   }
@@ -518,6 +662,42 @@ private:
     return node;
   }
 
+  // the unlinked values which lock free readers may still be walking through, each of them
+  // holds one ref which is released after the readers are quiescent
+  class RetireList
+  {
+  public:
+    static const int64_t MAX_RETIRE_CNT = 1024;
+    explicit RetireList(ObTransHashMap &map) : map_(map), values_() {}
+    ~RetireList() { reclaim(); }
+    void retire(Value *value)
+    {
+      if (OB_SUCCESS != values_.push_back(value)) {
+        // reclaim it alone if the retire list can not hold it
+        reclaim();
+        WaitQuiescentDynamic(map_.qsync_);
+        map_.reclaim_value_(value);
+      } else if (values_.count() >= MAX_RETIRE_CNT) {
+        reclaim();
+      }
+    }
+    void reclaim()
+    {
+      const int64_t cnt = values_.count();
+      if (cnt > 0) {
+        WaitQuiescentDynamic(map_.qsync_);
+        for (int64_t i = 0; i < cnt; ++i) {
+          map_.reclaim_value_(values_.at(i));
+        }
+        values_.reuse();
+      }
+    }
+  private:
+    ObTransHashMap &map_;
+    ValueArray values_;
+    DISALLOW_COPY_AND_ASSIGN(RetireList);
+  };
+
 private:
   // sizeof(ObTransHashMap) = BUCKETS_CNT * sizeof(LockType);
   // sizeof(SpinRWLock) = 20B;
@@ -525,6 +705,12 @@ private:
   bool is_inited_;
   ObTransHashHeader buckets_[BUCKETS_CNT];
   int64_t total_cnt_;
+  // protects lock free readers of this map only
+  common::ObDynamicQSync qsync_;
+  // the values deleted by del() and not reclaimed yet
+  common::ObSpinLock deleted_lock_;
+  int64_t deleted_cnt_;
+  Value *deleted_values_[DELETED_BATCH_CNT];
 #ifndef NDEBUG
 public:
 #endif
@@ -297,6 +297,7 @@ void ObPartTransCtx::default_init_()
   start_replay_ts_.reset();
   is_incomplete_replay_ctx_ = false;
   is_submitting_redo_log_for_freeze_ = false;
+  is_hot_row_writer_ = false;
   start_working_log_ts_ = SCN::min_scn();
   max_2pc_commit_scn_.reset();
   coord_prepare_info_arr_.reset();
@@ -738,7 +739,9 @@ int ObPartTransCtx::commit(const ObLSArray &parts,
       TRANS_LOG(ERROR, "the size of participant is 0 when commit", KPC(this));
     } else if (parts.count() == 1 && parts[0] == ls_id_) {
       exec_info_.trans_type_ = TransType::SP_TRANS;
-      can_elr_ = (trans_service_->get_tx_elr_util().is_can_tenant_elr() ? true : false);
+      ObTxELRUtil &elr_util = trans_service_->get_tx_elr_util();
+      can_elr_ = elr_util.is_can_tenant_elr()
+          || (is_hot_row_writer() && elr_util.is_can_tenant_hot_row_elr());
       if (OB_FAIL(one_phase_commit_())) {
         TRANS_LOG(WARN, "start sp coimit fail", K(ret), KPC(this));
       }
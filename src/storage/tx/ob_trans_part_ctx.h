@@ -204,6 +204,9 @@ public:
 
   // for elr
   bool is_can_elr() const { return can_elr_; }
+  // mark the trans as a writer of hot row, called without ctx lock
+  void set_hot_row_writer() { ATOMIC_STORE(&is_hot_row_writer_, true); }
+  bool is_hot_row_writer() const { return ATOMIC_LOAD(&is_hot_row_writer_); }
 
   int check_for_standby(const share::SCN &snapshot,
                         bool &can_read,
@@ -796,6 +799,8 @@ private:
   bool is_incomplete_replay_ctx_;
   // set true when submitting redo log for freezing and reset after freezing
   bool is_submitting_redo_log_for_freeze_;
+  // set true when the trans has waited on a row lock, see ObTxELRUtil
+  bool is_hot_row_writer_;
   share::SCN start_replay_ts_; // replay debug
 
   share::SCN start_working_log_ts_;
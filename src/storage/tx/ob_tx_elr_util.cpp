@@ -24,7 +24,9 @@ int ObTxELRUtil::check_and_update_tx_elr_info(ObTxDesc &tx)
 {
   int ret = OB_SUCCESS;
   if (OB_SYS_TENANT_ID != MTL_ID() && MTL_IS_PRIMARY_TENANT()) {
-    if (can_tenant_elr_) {  // tenant config enable elr
+    // the readers must push up snapshot by the max elr commit version as long as
+    // any trans of the tenant may release its locks early
+    if (can_tenant_elr_ || can_tenant_hot_row_elr_) {  // tenant config enable elr
       tx.set_can_elr(true);
       TX_STAT_ELR_ENABLE_TRANS_INC(MTL_ID());
     }
@@ -33,6 +35,17 @@ int ObTxELRUtil::check_and_update_tx_elr_info(ObTxDesc &tx)
   return ret;
 }
 
+bool ObTxELRUtil::is_can_tenant_hot_row_elr()
+{
+  bool bool_ret = false;
+  if (OB_SYS_TENANT_ID != MTL_ID() && MTL_IS_PRIMARY_TENANT()) {
+    // the participant may not start any trans by itself, so refresh here as well
+    refresh_elr_tenant_config_();
+    bool_ret = can_tenant_hot_row_elr_;
+  }
+  return bool_ret;
+}
+
 void ObTxELRUtil::refresh_elr_tenant_config_()
 {
   bool need_refresh = ObClockGenerator::getClock() - last_refresh_ts_ > REFRESH_INTERVAL;
@@ -41,6 +54,7 @@ void ObTxELRUtil::refresh_elr_tenant_config_()
     omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
     if (OB_LIKELY(tenant_config.is_valid())) {
       can_tenant_elr_ = tenant_config->enable_early_lock_release;
+      can_tenant_hot_row_elr_ = tenant_config->_enable_hot_row_early_lock_release;
       last_refresh_ts_ = ObClockGenerator::getClock();
     }
     if (REACH_TIME_INTERVAL(10000000 /* 10s */)) {
@@ -27,15 +27,21 @@ class ObTxELRUtil
 {
 public:
   ObTxELRUtil() : last_refresh_ts_(0),
-                  can_tenant_elr_(false) {}
+                  can_tenant_elr_(false),
+                  can_tenant_hot_row_elr_(false) {}
   int check_and_update_tx_elr_info(ObTxDesc &tx);
   bool is_can_tenant_elr() const { return can_tenant_elr_; }
+  // the trans which has waited on a row lock is likely to be waited on by
+  // others in turn, release its locks early so that the updates on a hot row
+  // are not serialized by the log sync
+  bool is_can_tenant_hot_row_elr();
   void reset()
   {
     last_refresh_ts_ = 0;
     can_tenant_elr_ = false;
+    can_tenant_hot_row_elr_ = false;
   }
-  TO_STRING_KV(K_(last_refresh_ts), K_(can_tenant_elr));
+  TO_STRING_KV(K_(last_refresh_ts), K_(can_tenant_elr), K_(can_tenant_hot_row_elr));
 private:
   void refresh_elr_tenant_config_();
 private:
@@ -43,6 +49,7 @@ private:
 private:
   int64_t last_refresh_ts_;
   bool can_tenant_elr_;
+  bool can_tenant_hot_row_elr_;
 };
 
 } // transaction
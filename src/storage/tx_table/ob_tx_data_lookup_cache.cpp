@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "storage/tx_table/ob_tx_data_lookup_cache.h"
+#include "lib/allocator/ob_malloc.h"
+
+namespace oceanbase {
+namespace storage {
+
+int ObTxDataLookupCache::init(const uint64_t tenant_id, const int64_t slot_cnt)
+{
+  int ret = OB_SUCCESS;
+
+  if (OB_UNLIKELY(is_inited())) {
+    ret = OB_INIT_TWICE;
+    STORAGE_LOG(WARN, "tx data lookup cache init twice", KR(ret), KPC(this));
+  } else if (OB_UNLIKELY(slot_cnt <= 0 || 0 != (slot_cnt & (slot_cnt - 1)))) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "slot count should be power of 2", KR(ret), K(slot_cnt));
+  } else {
+    slot_cnt_ = slot_cnt;
+    slot_mask_ = slot_cnt - 1;
+    tenant_id_ = tenant_id;
+  }
+  return ret;
+}
+
+void ObTxDataLookupCache::destroy()
+{
+  if (OB_NOT_NULL(slots_)) {
+    ob_free(slots_);
+    slots_ = nullptr;
+  }
+  slot_cnt_ = 0;
+  slot_mask_ = 0;
+  tenant_id_ = OB_INVALID_TENANT_ID;
+}
+
+void ObTxDataLookupCache::clear()
+{
+  Slot *slots = ATOMIC_LOAD(&slots_);
+  if (OB_NOT_NULL(slots)) {
+    for (int64_t i = 0; i < slot_cnt_; i++) {
+      Slot &slot = slots[i];
+      int64_t seq = 0;
+      while (true) {
+        seq = ATOMIC_LOAD(&slot.seq_);
+        if (0 == (seq & 1) && ATOMIC_BCAS(&slot.seq_, seq, seq + 1)) {
+          break;
+        }
+        PAUSE();
+      }
+      slot.data_.reset();
+      ATOMIC_STORE(&slot.seq_, seq + 2);
+    }
+  }
+}
+
+bool ObTxDataLookupCache::get(const transaction::ObTransID tx_id, ObTxCommitData &commit_data)
+{
+  bool hit = false;
+  Slot *slots = ATOMIC_LOAD(&slots_);
+  if (OB_NOT_NULL(slots)) {
+    Slot &slot = get_slot_(slots, tx_id);
+    const int64_t seq = ATOMIC_LOAD(&slot.seq_);
+    if (0 == (seq & 1)) {
+      commit_data = slot.data_;
+      MEM_BARRIER();
+      hit = (seq == ATOMIC_LOAD(&slot.seq_)) && commit_data.tx_id_ == tx_id;
+    }
+  }
+  return hit;
+}
+
+void ObTxDataLookupCache::put(const ObTxData &tx_data)
+{
+  if ((ObTxData::COMMIT == tx_data.state_ || ObTxData::ABORT == tx_data.state_)
+      && nullptr == tx_data.undo_status_list_.head_) {
+    put_(tx_data);
+  }
+}
+
+ObTxDataLookupCache::Slot *ObTxDataLookupCache::get_or_alloc_slots_()
+{
+  Slot *slots = ATOMIC_LOAD(&slots_);
+  void *ptr = nullptr;
+  ObMemAttr mem_attr(tenant_id_, "TxDataLkpCache", ObCtxIds::TX_DATA_TABLE);
+
+  if (OB_NOT_NULL(slots) || OB_UNLIKELY(!is_inited())) {
+  } else if (OB_ISNULL(ptr = ob_malloc(slot_cnt_ * sizeof(Slot), mem_attr))) {
+    if (REACH_TIME_INTERVAL(10 * 1000 * 1000 /* 10s */)) {
+      STORAGE_LOG_RET(WARN, OB_ALLOCATE_MEMORY_FAILED, "allocate tx data lookup cache failed", K_(slot_cnt));
+    }
+  } else {
+    Slot *new_slots = new (ptr) Slot[slot_cnt_];
+    if (ATOMIC_BCAS(&slots_, nullptr, new_slots)) {
+      slots = new_slots;
+    } else {
+      // allocated by another writer
+      ob_free(ptr);
+      slots = ATOMIC_LOAD(&slots_);
+    }
+  }
+  return slots;
+}
+
+void ObTxDataLookupCache::put_(const ObTxCommitData &data)
+{
+  Slot *slots = get_or_alloc_slots_();
+  if (OB_NOT_NULL(slots)) {
+    Slot &slot = get_slot_(slots, data.tx_id_);
+    const int64_t seq = ATOMIC_LOAD(&slot.seq_);
+    // skip if another writer is filling the slot
+    if (0 == (seq & 1) && ATOMIC_BCAS(&slot.seq_, seq, seq + 1)) {
+      slot.data_ = data;
+      MEM_BARRIER();
+      ATOMIC_STORE(&slot.seq_, seq + 2);
+    }
+  }
+}
+
+}  // namespace storage
+}  // namespace oceanbase
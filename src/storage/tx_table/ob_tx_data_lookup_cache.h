@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_OB_TX_DATA_LOOKUP_CACHE_
+#define OCEANBASE_STORAGE_OB_TX_DATA_LOOKUP_CACHE_
+
+#include "lib/ob_define.h"
+#include "lib/atomic/ob_atomic.h"
+#include "lib/utility/ob_print_utils.h"
+#include "storage/tx/ob_tx_data_define.h"
+
+namespace oceanbase {
+namespace storage {
+
+// A direct mapped cache of the decided tx data which are read from tx data sstables.
+//
+// Tx data in sstables never change once the transaction is committed or aborted, but every read
+// of them builds a single row getter on the tx data tablet. Readers of recently compacted minor
+// sstables check the same transactions again and again, so the commit data of decided
+// transactions are kept here. A tx which is not found in tx data sstables may be found after its
+// tx data memtable is flushed, so the miss is never cached.
+//
+// Each slot is protected by a sequence number: writers make it odd while filling the slot and
+// give up if another writer is there, readers never wait and treat a changed sequence as a miss.
+//
+// Slots are allocated by the first put, so that the log streams which never read tx data
+// sstables cost nothing.
+class ObTxDataLookupCache
+{
+public:
+  static const int64_t DEFAULT_SLOT_CNT = 16384; /* 1 << 14, 768KB */
+
+public:
+  ObTxDataLookupCache()
+    : slots_(nullptr), slot_cnt_(0), slot_mask_(0), tenant_id_(OB_INVALID_TENANT_ID) {}
+  ~ObTxDataLookupCache() { destroy(); }
+
+  int init(const uint64_t tenant_id, const int64_t slot_cnt = DEFAULT_SLOT_CNT);
+  void destroy();
+  // invalidate all cached tx data, it may wait for the writers of slots
+  void clear();
+
+  /**
+   * @brief get the commit data of tx_id from cache
+   *
+   * @param[in] tx_id the tx id to look up
+   * @param[out] commit_data the cached commit data
+   * @return true if hit
+   */
+  bool get(const transaction::ObTransID tx_id, ObTxCommitData &commit_data);
+  // only the tx data without undo actions which have been decided is cached
+  void put(const ObTxData &tx_data);
+
+  OB_INLINE bool is_inited() const { return slot_cnt_ > 0; }
+  TO_STRING_KV(KP_(slots), K_(slot_cnt), K_(tenant_id));
+
+private:
+  struct Slot
+  {
+    Slot() : seq_(0), data_() {}
+    int64_t seq_;
+    ObTxCommitData data_;
+  };
+
+  OB_INLINE Slot &get_slot_(Slot *slots, const transaction::ObTransID tx_id)
+  {
+    return slots[tx_id.hash() & slot_mask_];
+  }
+  Slot *get_or_alloc_slots_();
+  void put_(const ObTxCommitData &data);
+
+private:
+  Slot *slots_;
+  int64_t slot_cnt_;
+  int64_t slot_mask_;
+  uint64_t tenant_id_;
+  DISALLOW_COPY_AND_ASSIGN(ObTxDataLookupCache);
+};
+
+}  // namespace storage
+}  // namespace oceanbase
+
+#endif  // OCEANBASE_STORAGE_OB_TX_DATA_LOOKUP_CACHE_
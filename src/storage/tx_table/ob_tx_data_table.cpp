@@ -56,6 +56,8 @@ int ObTxDataTable::init(ObLS *ls, ObTxCtxTable *tx_ctx_table)
     STORAGE_LOG(ERROR, "slice_allocator_ init fail");
   } else if (OB_FAIL(init_tx_data_read_schema_())) {
     STORAGE_LOG(WARN, "init tx data read ctx failed.", KR(ret), K(tablet_id_));
+  } else if (OB_FAIL(lookup_cache_.init(MTL_ID()))) {
+    STORAGE_LOG(WARN, "init tx data lookup cache failed.", KR(ret), K(tablet_id_));
   } else {
     slice_allocator_.set_nway(ObTxDataTable::TX_DATA_MAX_CONCURRENCY);
 
@@ -202,6 +204,7 @@ void ObTxDataTable::reset()
   calc_upper_info_.reset();
   calc_upper_trans_version_cache_.reset();
   memtables_cache_.reuse();
+  lookup_cache_.destroy();
   slice_allocator_.purge_extra_cached_block(0);
   is_started_ = false;
   is_inited_ = false;
@@ -227,6 +230,8 @@ int ObTxDataTable::offline()
   } else {
     calc_upper_info_.reset();
     calc_upper_trans_version_cache_.reset();
+    // tx data sstables may be replaced before online again
+    lookup_cache_.clear();
   }
   return ret;
 }
@@ -658,9 +663,15 @@ int ObTxDataTable::check_tx_data_in_sstable_(const ObTransID tx_id, ObITxDataChe
   int ret = OB_SUCCESS;
   ObTxData tx_data;
   tx_data.reset();
+  bool hit = false;
 
-  if (OB_FAIL(get_tx_data_in_sstable_(tx_id, tx_data))) {
+  if (OB_FAIL(check_tx_data_in_lookup_cache_(tx_id, fn, hit))) {
+    STORAGE_LOG(WARN, "check tx data in lookup cache failed.", KR(ret), K(tx_id));
+  } else if (hit) {
+    // check done with the cached tx data
+  } else if (OB_FAIL(get_tx_data_in_sstable_(tx_id, tx_data))) {
     STORAGE_LOG(WARN, "get tx data from sstable failed.", KR(ret), K(tx_id));
+  } else if (FALSE_IT(lookup_cache_.put(tx_data))) {
   } else if (OB_FAIL(fn(tx_data))) {
     STORAGE_LOG(WARN, "check tx data in sstable failed.", KR(ret), KP(this), K(tablet_id_));
   }
@@ -672,6 +683,24 @@ int ObTxDataTable::check_tx_data_in_sstable_(const ObTransID tx_id, ObITxDataChe
   return ret;
 }
 
+int ObTxDataTable::check_tx_data_in_lookup_cache_(const ObTransID tx_id, ObITxDataCheckFunctor &fn, bool &hit)
+{
+  int ret = OB_SUCCESS;
+  ObTxCommitData commit_data;
+
+  if (!(hit = lookup_cache_.get(tx_id, commit_data))) {
+    // read tx data sstable
+  } else {
+    // decided tx data without undo actions is cached only
+    ObTxData tx_data;
+    tx_data = commit_data;
+    if (OB_FAIL(fn(tx_data))) {
+      STORAGE_LOG(WARN, "check cached tx data failed.", KR(ret), KP(this), K(tx_data));
+    }
+  }
+  return ret;
+}
+
 int ObTxDataTable::get_tx_data_in_sstable_(const transaction::ObTransID tx_id, ObTxData &tx_data)
 {
   int ret = OB_SUCCESS;
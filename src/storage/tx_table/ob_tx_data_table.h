@@ -17,6 +17,7 @@
 #include "lib/future/ob_future.h"
 #include "share/scn.h"
 #include "storage/tx_table/ob_tx_data_memtable_mgr.h"
+#include "storage/tx_table/ob_tx_data_lookup_cache.h"
 #include "storage/tx_table/ob_tx_table_define.h"
 #include "share/ob_occam_timer.h"
 namespace oceanbase
@@ -136,7 +137,8 @@ public:  // ObTxDataTable
       read_schema_(),
       calc_upper_info_(),
       calc_upper_trans_version_cache_(),
-      memtables_cache_() {}
+      memtables_cache_(),
+      lookup_cache_() {}
   ~ObTxDataTable() {}
 
   virtual int init(ObLS *ls, ObTxCtxTable *tx_ctx_table);
@@ -232,6 +234,7 @@ public:  // ObTxDataTable
                K_(tablet_id),
                K_(calc_upper_info),
                K_(memtables_cache),
+               K_(lookup_cache),
                KP_(ls),
                KP_(ls_tablet_svr),
                KP_(memtable_mgr),
@@ -262,6 +265,7 @@ private:
   int get_tx_data_from_cache_(const transaction::ObTransID tx_id, ObTxDataGuard &tx_data_guard, bool &find);
 
   int check_tx_data_in_sstable_(const transaction::ObTransID tx_id, ObITxDataCheckFunctor &fn);
+  int check_tx_data_in_lookup_cache_(const transaction::ObTransID tx_id, ObITxDataCheckFunctor &fn, bool &hit);
 
   int get_tx_data_in_cache_(const transaction::ObTransID tx_id, ObTxData *&tx_data);
 
@@ -336,6 +340,8 @@ private:
   CalcUpperInfo calc_upper_info_;
   CalcUpperTransSCNCache calc_upper_trans_version_cache_;
   MemtableHandlesCache memtables_cache_;
+  // decided tx data read from tx data sstables
+  ObTxDataLookupCache lookup_cache_;
 };  // tx_table
 
 
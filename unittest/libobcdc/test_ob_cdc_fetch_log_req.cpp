@@ -0,0 +1,398 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * This file defines test_ob_cdc_fetch_log_req.cpp
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "logservice/cdcservice/ob_cdc_req.h"
+#undef private
+#include "logservice/libobcdc/src/ob_log_ls_fetch_ctx.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace obrpc;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace unittest
+{
+// ObCdcLSFetchLogReq and ObCdcLSFetchLogResp before log type filter is supported
+struct OldFetchLogReq
+{
+  int64_t rpc_ver_;
+  ObLSID ls_id_;
+  LSN start_lsn_;
+  int64_t upper_limit_ts_;
+  uint64_t client_pid_;
+  ObCdcRpcId client_id_;
+  int64_t progress_;
+  int8_t flag_;
+  OB_UNIS_VERSION(1);
+};
+OB_SERIALIZE_MEMBER(OldFetchLogReq, rpc_ver_, ls_id_, start_lsn_,
+                    upper_limit_ts_, client_pid_, client_id_, progress_, flag_);
+
+struct OldFetchLogResp
+{
+  int64_t rpc_ver_;
+  int err_;
+  int debug_err_;
+  ObLSID ls_id_;
+  ObCdcLSFetchLogResp::FeedbackType feedback_type_;
+  ObCdcFetchStatus fetch_status_;
+  LSN next_req_lsn_;
+  int64_t log_num_;
+  int64_t pos_;
+  const char *log_entry_buf_;
+  int64_t server_progress_;
+  OB_UNIS_VERSION(1);
+};
+OB_DEF_SERIALIZE(OldFetchLogResp)
+{
+  int ret = OB_SUCCESS;
+  LST_DO_CODE(OB_UNIS_ENCODE, rpc_ver_, err_, debug_err_,
+              ls_id_, feedback_type_, fetch_status_, next_req_lsn_,
+              log_num_, pos_);
+  if (OB_SUCC(ret) && pos_ > 0) {
+    if (buf_len - pos < pos_) {
+      ret = OB_BUF_NOT_ENOUGH;
+    } else {
+      MEMCPY(buf + pos, log_entry_buf_, pos_);
+      pos += pos_;
+    }
+  }
+  LST_DO_CODE(OB_UNIS_ENCODE, server_progress_);
+  return ret;
+}
+OB_DEF_SERIALIZE_SIZE(OldFetchLogResp)
+{
+  int64_t len = 0;
+  LST_DO_CODE(OB_UNIS_ADD_LEN, rpc_ver_, err_, debug_err_,
+              ls_id_, feedback_type_, fetch_status_, next_req_lsn_,
+              log_num_, pos_);
+  len += pos_;
+  LST_DO_CODE(OB_UNIS_ADD_LEN, server_progress_);
+  return len;
+}
+OB_DEF_DESERIALIZE(OldFetchLogResp)
+{
+  int ret = OB_SUCCESS;
+  LST_DO_CODE(OB_UNIS_DECODE, rpc_ver_, err_, debug_err_,
+              ls_id_, feedback_type_, fetch_status_, next_req_lsn_,
+              log_num_, pos_);
+  if (OB_SUCC(ret) && pos_ > 0) {
+    log_entry_buf_ = buf + pos;
+    pos += pos_;
+  }
+  LST_DO_CODE(OB_UNIS_DECODE, server_progress_);
+  return ret;
+}
+
+class TestObCdcFetchLogReq : public ::testing::Test
+{
+public:
+  static const int64_t BUF_LEN = 4 * 1024 * 1024;
+  TestObCdcFetchLogReq() : resp_(NULL), buf_(NULL) {}
+  virtual void SetUp() override
+  {
+    // response is too large to be on stack
+    resp_ = new ObCdcLSFetchLogResp();
+    buf_ = new char[BUF_LEN];
+  }
+  virtual void TearDown() override
+  {
+    delete resp_;
+    resp_ = NULL;
+    delete []buf_;
+    buf_ = NULL;
+  }
+
+  // the response filled by server: fill LogGroupEntries of 'size' bytes, or skip them if filtered
+  void fill_log(const int64_t size)
+  {
+    int64_t remain_size = 0;
+    char *remain_buf = resp_->get_remain_buf(remain_size);
+    ASSERT_LE(size, remain_size);
+    MEMSET(remain_buf, static_cast<char>('a' + resp_->get_log_num() % 26), size);
+    resp_->log_entry_filled(size);
+  }
+  void check_segment(const ObCdcLSFetchLogResp &resp,
+      const int64_t seg_idx,
+      const int64_t expect_start_pos,
+      const int64_t expect_end_pos,
+      const int64_t expect_log_cnt,
+      const int64_t expect_filtered_size)
+  {
+    int64_t start_pos = -1;
+    int64_t end_pos = -1;
+    int64_t log_cnt = -1;
+    int64_t filtered_size = -1;
+    ASSERT_EQ(OB_SUCCESS, resp.get_log_segment(seg_idx, start_pos, end_pos, log_cnt, filtered_size));
+    EXPECT_EQ(expect_start_pos, start_pos) << seg_idx;
+    EXPECT_EQ(expect_end_pos, end_pos) << seg_idx;
+    EXPECT_EQ(expect_log_cnt, log_cnt) << seg_idx;
+    EXPECT_EQ(expect_filtered_size, filtered_size) << seg_idx;
+  }
+  // segments must cover all logs of response, and the lsn of all segments and holes
+  void check_all_segments(const ObCdcLSFetchLogResp &resp, const int64_t expect_total_size)
+  {
+    int64_t total_log_cnt = 0;
+    int64_t total_size = 0;
+    int64_t last_end_pos = 0;
+    for (int64_t seg_idx = 0; seg_idx < resp.get_log_segment_count(); seg_idx++) {
+      int64_t start_pos = 0;
+      int64_t end_pos = 0;
+      int64_t log_cnt = 0;
+      int64_t filtered_size = 0;
+      ASSERT_EQ(OB_SUCCESS, resp.get_log_segment(seg_idx, start_pos, end_pos, log_cnt, filtered_size));
+      ASSERT_EQ(last_end_pos, start_pos);
+      last_end_pos = end_pos;
+      total_log_cnt += log_cnt;
+      total_size += end_pos - start_pos + filtered_size;
+    }
+    ASSERT_EQ(resp.get_pos(), last_end_pos);
+    ASSERT_EQ(resp.get_log_num(), total_log_cnt);
+    ASSERT_EQ(expect_total_size, total_size);
+  }
+  // serialize resp_ and deserialize it into a new response
+  void check_resp_round_trip(ObCdcLSFetchLogResp &out)
+  {
+    int64_t pos = 0;
+    const int64_t size = resp_->get_serialize_size();
+    ASSERT_GE(BUF_LEN, size);
+    ASSERT_EQ(OB_SUCCESS, resp_->serialize(buf_, BUF_LEN, pos));
+    ASSERT_EQ(size, pos);
+    pos = 0;
+    ASSERT_EQ(OB_SUCCESS, out.deserialize(buf_, size, pos));
+    ASSERT_EQ(size, pos);
+    ASSERT_EQ(resp_->get_err(), out.get_err());
+    ASSERT_EQ(resp_->get_ls_id(), out.get_ls_id());
+    ASSERT_EQ(resp_->get_next_req_lsn(), out.get_next_req_lsn());
+    ASSERT_EQ(resp_->get_log_num(), out.get_log_num());
+    ASSERT_EQ(resp_->get_pos(), out.get_pos());
+    ASSERT_EQ(0, MEMCMP(resp_->get_log_entry_buf(), out.get_log_entry_buf(), resp_->get_pos()));
+    ASSERT_EQ(resp_->get_progress(), out.get_progress());
+    ASSERT_EQ(resp_->get_filtered_logs().count(), out.get_filtered_logs().count());
+    for (int64_t i = 0; i < resp_->get_filtered_logs().count(); i++) {
+      ASSERT_EQ(resp_->get_filtered_logs().at(i).pos_, out.get_filtered_logs().at(i).pos_);
+      ASSERT_EQ(resp_->get_filtered_logs().at(i).log_num_, out.get_filtered_logs().at(i).log_num_);
+      ASSERT_EQ(resp_->get_filtered_logs().at(i).size_, out.get_filtered_logs().at(i).size_);
+    }
+  }
+
+protected:
+  ObCdcLSFetchLogResp *resp_;
+  char *buf_;
+};
+
+TEST_F(TestObCdcFetchLogReq, req_serialize)
+{
+  ObCdcLSFetchLogReq req;
+  ObCdcLSFetchLogReq out_req;
+  ObCdcRpcId client_id;
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, client_id.init(100, ObAddr(ObAddr::IPV4, "127.0.0.1", 8888)));
+  req.reset(ObLSID(1001), LSN(1024), 200);
+  req.set_client_pid(100);
+  req.set_client_id(client_id);
+  req.set_progress(300);
+  req.set_log_type_filter(LSFetchCtx::FETCH_LOG_TYPE_FILTER);
+
+  // round trip with log type filter
+  ASSERT_EQ(OB_SUCCESS, req.serialize(buf_, BUF_LEN, pos));
+  ASSERT_EQ(req.get_serialize_size(), pos);
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, out_req.deserialize(buf_, req.get_serialize_size(), pos));
+  ASSERT_EQ(req, out_req);
+  ASSERT_EQ(req.get_client_pid(), out_req.get_client_pid());
+  ASSERT_EQ(req.get_progress(), out_req.get_progress());
+  ASSERT_EQ(LSFetchCtx::FETCH_LOG_TYPE_FILTER, out_req.get_log_type_filter());
+
+  // old server ignores the log type filter
+  OldFetchLogReq old_req;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_req.deserialize(buf_, req.get_serialize_size(), pos));
+  ASSERT_EQ(req.get_serialize_size(), pos);
+  ASSERT_EQ(req.get_ls_id(), old_req.ls_id_);
+  ASSERT_EQ(req.get_start_lsn(), old_req.start_lsn_);
+  ASSERT_EQ(req.get_progress(), old_req.progress_);
+
+  // request from old client fetches all logs
+  pos = 0;
+  out_req.reset();
+  out_req.set_log_type_filter(LSFetchCtx::FETCH_LOG_TYPE_FILTER);
+  ASSERT_EQ(OB_SUCCESS, old_req.serialize(buf_, BUF_LEN, pos));
+  ASSERT_EQ(old_req.get_serialize_size(), pos);
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, out_req.deserialize(buf_, old_req.get_serialize_size(), pos));
+  ASSERT_EQ(req, out_req);
+  ASSERT_EQ(0, out_req.get_log_type_filter());
+}
+
+TEST_F(TestObCdcFetchLogReq, resp_serialize)
+{
+  ObCdcLSFetchLogResp *out = new ObCdcLSFetchLogResp();
+  resp_->set_ls_id(ObLSID(1001));
+  resp_->set_next_req_lsn(LSN(4096));
+  resp_->set_progress(500);
+
+  // without filtered log
+  fill_log(100);
+  fill_log(200);
+  check_resp_round_trip(*out);
+  ASSERT_FALSE(out->has_filtered_log());
+
+  // with filtered logs
+  ASSERT_EQ(OB_SUCCESS, resp_->log_entry_filtered(1000));
+  fill_log(300);
+  ASSERT_EQ(OB_SUCCESS, resp_->log_entry_filtered(2000));
+  out->reset();
+  check_resp_round_trip(*out);
+  ASSERT_EQ(2, out->get_filtered_logs().count());
+  check_all_segments(*out, 3600);
+
+  // old client reads logs only
+  OldFetchLogResp old_resp;
+  char *new_buf = buf_ + BUF_LEN / 2;
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, resp_->serialize(new_buf, BUF_LEN / 2, pos));
+  const int64_t size = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_resp.deserialize(new_buf, size, pos));
+  ASSERT_EQ(size, pos);
+  ASSERT_EQ(resp_->get_log_num(), old_resp.log_num_);
+  ASSERT_EQ(resp_->get_pos(), old_resp.pos_);
+  ASSERT_EQ(resp_->get_progress(), old_resp.server_progress_);
+
+  // response from old server has no hole
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_resp.serialize(buf_, BUF_LEN / 2, pos));
+  ASSERT_EQ(old_resp.get_serialize_size(), pos);
+  const int64_t old_size = pos;
+  pos = 0;
+  out->reset();
+  ASSERT_EQ(OB_SUCCESS, out->deserialize(buf_, old_size, pos));
+  ASSERT_EQ(old_size, pos);
+  ASSERT_EQ(resp_->get_log_num(), out->get_log_num());
+  ASSERT_EQ(resp_->get_pos(), out->get_pos());
+  ASSERT_EQ(0, MEMCMP(resp_->get_log_entry_buf(), out->get_log_entry_buf(), resp_->get_pos()));
+  ASSERT_FALSE(out->has_filtered_log());
+  check_all_segments(*out, 600);
+
+  delete out;
+}
+
+TEST_F(TestObCdcFetchLogReq, hole_in_middle)
+{
+  fill_log(100);
+  ASSERT_EQ(OB_SUCCESS, resp_->log_entry_filtered(1000));
+  // continuous filtered logs are merged into one hole
+  ASSERT_EQ(OB_SUCCESS, resp_->log_entry_filtered(500));
+  fill_log(200);
+  fill_log(300);
+  ASSERT_EQ(OB_SUCCESS, resp_->log_entry_filtered(2000));
+  fill_log(400);
+
+  ASSERT_EQ(3, resp_->get_log_segment_count());
+  check_segment(*resp_, 0, 0, 100, 1, 1500);
+  check_segment(*resp_, 1, 100, 600, 2, 2000);
+  check_segment(*resp_, 2, 600, 1000, 1, 0);
+  check_all_segments(*resp_, 4500);
+}
+
+TEST_F(TestObCdcFetchLogReq, hole_first)
+{
+  ASSERT_EQ(OB_SUCCESS, resp_->log_entry_filtered(1000));
+  fill_log(100);
+  fill_log(200);
+
+  ASSERT_EQ(2, resp_->get_log_segment_count());
+  // nothing to read before skipping the first hole
+  check_segment(*resp_, 0, 0, 0, 0, 1000);
+  check_segment(*resp_, 1, 0, 300, 2, 0);
+  check_all_segments(*resp_, 1300);
+}
+
+TEST_F(TestObCdcFetchLogReq, hole_last)
+{
+  fill_log(100);
+  fill_log(200);
+  ASSERT_EQ(OB_SUCCESS, resp_->log_entry_filtered(1000));
+
+  ASSERT_EQ(2, resp_->get_log_segment_count());
+  check_segment(*resp_, 0, 0, 300, 2, 1000);
+  // nothing to read after skipping the last hole
+  check_segment(*resp_, 1, 300, 300, 0, 0);
+  check_all_segments(*resp_, 1300);
+}
+
+TEST_F(TestObCdcFetchLogReq, only_holes)
+{
+  ASSERT_EQ(OB_SUCCESS, resp_->log_entry_filtered(1000));
+  ASSERT_EQ(OB_SUCCESS, resp_->log_entry_filtered(2000));
+
+  // the response makes progress without any log
+  ASSERT_EQ(0, resp_->get_log_num());
+  ASSERT_TRUE(resp_->has_filtered_log());
+  ASSERT_EQ(2, resp_->get_log_segment_count());
+  check_segment(*resp_, 0, 0, 0, 0, 3000);
+  check_segment(*resp_, 1, 0, 0, 0, 0);
+  check_all_segments(*resp_, 3000);
+}
+
+TEST_F(TestObCdcFetchLogReq, invalid_hole)
+{
+  int64_t start_pos = 0;
+  int64_t end_pos = 0;
+  int64_t log_cnt = 0;
+  int64_t filtered_size = 0;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, resp_->log_entry_filtered(0));
+  // too many holes
+  for (int64_t i = 0; i < ObCdcLSFetchLogResp::MAX_FILTERED_LOG_CNT; i++) {
+    ASSERT_EQ(OB_SUCCESS, resp_->log_entry_filtered(10));
+    fill_log(10);
+  }
+  ASSERT_EQ(OB_SIZE_OVERFLOW, resp_->log_entry_filtered(10));
+  check_all_segments(*resp_, ObCdcLSFetchLogResp::MAX_FILTERED_LOG_CNT * 20);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, resp_->get_log_segment(-1, start_pos, end_pos, log_cnt, filtered_size));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, resp_->get_log_segment(resp_->get_log_segment_count(),
+      start_pos, end_pos, log_cnt, filtered_size));
+
+  // holes out of order, e.g. a broken response
+  resp_->filtered_logs_.at(1).pos_ = 30;
+  ASSERT_EQ(OB_INVALID_DATA, resp_->get_log_segment(2, start_pos, end_pos, log_cnt, filtered_size));
+  resp_->filtered_logs_.at(1).pos_ = 10;
+  resp_->filtered_logs_.at(1).log_num_ = resp_->get_log_num() + 1;
+  ASSERT_EQ(OB_INVALID_DATA, resp_->get_log_segment(1, start_pos, end_pos, log_cnt, filtered_size));
+  resp_->filtered_logs_.at(1).log_num_ = 1;
+  resp_->filtered_logs_.at(1).size_ = 0;
+  ASSERT_EQ(OB_INVALID_DATA, resp_->get_log_segment(1, start_pos, end_pos, log_cnt, filtered_size));
+  resp_->filtered_logs_.at(1).size_ = 10;
+  check_all_segments(*resp_, ObCdcLSFetchLogResp::MAX_FILTERED_LOG_CNT * 20);
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_ob_cdc_fetch_log_req.log*");
+  OB_LOGGER.set_file_name("test_ob_cdc_fetch_log_req.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * This file defines test_ob_log_formatter.cpp
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "logservice/libobcdc/src/ob_log_formatter.h"
+#include "logservice/libobcdc/src/ob_log_part_trans_task.h"
+#include "logservice/libobcdc/src/ob_log_binlog_record.h"
+#undef private
+#include "lib/allocator/page_arena.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace unittest
+{
+
+// Formats nothing: records the thread of each stmt, then finishes the stmt as ObLogFormatter does
+class MockFormatter : public ObLogFormatter
+{
+public:
+  static const int64_t MAX_STMT_CNT = 4096;
+
+  MockFormatter() : handled_cnt_(0)
+  {
+    for (int64_t i = 0; i < MAX_STMT_CNT; i++) {
+      stmt_thread_[i] = -1;
+    }
+  }
+
+  int init(const int64_t thread_num)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_FAIL(FormatterThread::init(thread_num, MAX_STMT_CNT))) {
+      LOG_ERROR("init formatter queue thread fail", KR(ret), K(thread_num));
+    } else {
+      inited_ = true;
+    }
+    return ret;
+  }
+
+  virtual int handle(void *data, const int64_t thread_index, volatile bool &stop_flag) override
+  {
+    int ret = OB_SUCCESS;
+    DmlStmtTask *stmt_task = static_cast<DmlStmtTask *>(data);
+    stmt_thread_[stmt_task->get_row_index()] = thread_index;
+    ATOMIC_INC(&handled_cnt_);
+    if (OB_FAIL(finish_format_(stmt_task->get_host(), stmt_task->get_redo_log_entry_task(), stop_flag))) {
+      LOG_ERROR("finish_format_ fail", KR(ret), KPC(stmt_task));
+    }
+    return ret;
+  }
+
+public:
+  int64_t handled_cnt_;
+  int64_t stmt_thread_[MAX_STMT_CNT];
+};
+
+class TestObLogFormatter : public ::testing::Test
+{
+public:
+  static const int64_t THREAD_NUM = 4;
+
+  TestObLogFormatter() : allocator_(), part_trans_task_(), redo_node_(), log_entry_task_() {}
+  virtual void SetUp() override
+  {
+    TenantLSID tls_id(1001, share::ObLSID(1001));
+    EXPECT_EQ(OB_SUCCESS, log_entry_task_.init(tls_id, "participant", transaction::ObTransID(1), &redo_node_));
+  }
+
+  // build stmts of one log entry, the row index is the position in the log entry
+  void build_stmts(const int64_t stmt_cnt)
+  {
+    brs_ = new ObLogUnserilizedBR[stmt_cnt];
+    stmts_ = static_cast<DmlStmtTask **>(allocator_.alloc(sizeof(DmlStmtTask *) * stmt_cnt));
+    ASSERT_NE(nullptr, stmts_);
+    for (int64_t i = 0; i < stmt_cnt; i++) {
+      void *row_buf = allocator_.alloc(sizeof(MutatorRow));
+      void *stmt_buf = allocator_.alloc(sizeof(DmlStmtTask));
+      ASSERT_NE(nullptr, row_buf);
+      ASSERT_NE(nullptr, stmt_buf);
+      MutatorRow *row = new (row_buf) MutatorRow(allocator_);
+      stmts_[i] = new (stmt_buf) DmlStmtTask(part_trans_task_, log_entry_task_, *row);
+      stmts_[i]->set_binlog_record(&brs_[i]);
+      ASSERT_EQ(OB_SUCCESS, log_entry_task_.add_stmt(i, stmts_[i]));
+    }
+    stmt_cnt_ = stmt_cnt;
+  }
+
+  // push the stmts of the log entry as the dml parser does and wait until the rows are linked
+  void push_and_wait(MockFormatter &formatter)
+  {
+    volatile bool stop_flag = false;
+    ASSERT_EQ(OB_SUCCESS, formatter.push(log_entry_task_.get_stmt_list().head_, stop_flag));
+    const int64_t start_ts = ObTimeUtility::current_time();
+    while (!redo_node_.is_formatted() && ObTimeUtility::current_time() - start_ts < 10 * 1000 * 1000) {
+      ob_usleep(1000);
+    }
+    ASSERT_TRUE(redo_node_.is_formatted());
+    ASSERT_EQ(stmt_cnt_, ATOMIC_LOAD(&formatter.handled_cnt_));
+  }
+
+  // all rows are linked once in the order of row index
+  void check_row_list()
+  {
+    ASSERT_EQ(stmt_cnt_, redo_node_.get_valid_row_num());
+    ASSERT_EQ(stmt_cnt_, log_entry_task_.get_row_ref_cnt());
+    int64_t row_cnt = 0;
+    IStmtTask *stmt = static_cast<IStmtTask *>(redo_node_.get_row_head());
+    while (NULL != stmt) {
+      ASSERT_EQ(row_cnt, static_cast<int64_t>(stmt->get_row_index()));
+      ASSERT_EQ(static_cast<IStmtTask *>(stmts_[row_cnt]), stmt);
+      row_cnt++;
+      stmt = stmt->get_next();
+    }
+    ASSERT_EQ(stmt_cnt_, row_cnt);
+    ASSERT_EQ(static_cast<ObLink *>(stmts_[stmt_cnt_ - 1]), redo_node_.get_row_tail());
+  }
+
+  virtual void TearDown() override
+  {
+    for (int64_t i = 0; i < stmt_cnt_; i++) {
+      stmts_[i]->set_binlog_record(NULL);
+      stmts_[i]->~DmlStmtTask();
+    }
+    delete []brs_;
+    brs_ = NULL;
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  PartTransTask part_trans_task_;
+  DmlRedoLogNode redo_node_;
+  ObLogEntryTask log_entry_task_;
+  ObLogUnserilizedBR *brs_ = NULL;
+  DmlStmtTask **stmts_ = NULL;
+  int64_t stmt_cnt_ = 0;
+};
+
+TEST_F(TestObLogFormatter, small_log_entry_on_one_thread)
+{
+  MockFormatter formatter;
+  ASSERT_EQ(OB_SUCCESS, formatter.init(THREAD_NUM));
+  ASSERT_EQ(OB_SUCCESS, formatter.start());
+  build_stmts(ObLogFormatter::PARALLEL_FORMAT_STMT_BATCH);
+  push_and_wait(formatter);
+  check_row_list();
+  for (int64_t i = 1; i < stmt_cnt_; i++) {
+    ASSERT_EQ(formatter.stmt_thread_[0], formatter.stmt_thread_[i]);
+  }
+  formatter.stop();
+}
+
+TEST_F(TestObLogFormatter, large_log_entry_on_all_threads)
+{
+  MockFormatter formatter;
+  ASSERT_EQ(OB_SUCCESS, formatter.init(THREAD_NUM));
+  ASSERT_EQ(OB_SUCCESS, formatter.start());
+  // stmts of the last batch are less than a batch
+  const int64_t batch = ObLogFormatter::PARALLEL_FORMAT_STMT_BATCH;
+  build_stmts(batch * THREAD_NUM * 3 + 17);
+  push_and_wait(formatter);
+  check_row_list();
+  // each batch goes to the next thread
+  bool used[THREAD_NUM] = {false};
+  for (int64_t i = 0; i < stmt_cnt_; i++) {
+    ASSERT_EQ((formatter.stmt_thread_[0] + i / batch) % THREAD_NUM, formatter.stmt_thread_[i]) << i;
+    used[formatter.stmt_thread_[i]] = true;
+  }
+  for (int64_t i = 0; i < THREAD_NUM; i++) {
+    ASSERT_TRUE(used[i]);
+  }
+  formatter.stop();
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_ob_log_formatter.log");
+  OB_LOGGER.set_file_name("test_ob_log_formatter.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
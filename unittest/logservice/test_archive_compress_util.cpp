@@ -0,0 +1,349 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "lib/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+#include "logservice/archiveservice/ob_archive_compress_util.h"
+#include "logservice/archiveservice/ob_archive_define.h"
+#include "logservice/palf/log_entry_header.h"
+#include "logservice/palf/log_group_entry_header.h"
+#include "logservice/palf/log_writer_utils.h"
+#include "logservice/restoreservice/ob_remote_data_generator.h"
+#include "share/scn.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace archive;
+using namespace palf;
+namespace unittest
+{
+
+class TestArchiveCompressUtil : public ::testing::Test
+{
+public:
+  static const int64_t BUF_SIZE = 8 * ARCHIVE_COMPRESS_BLOCK_SIZE;
+  TestArchiveCompressUtil() : src_(NULL), src_len_(0), compressed_(NULL), compressed_len_(0),
+      dst_(NULL), dst_len_(0), max_size_(0), seed_(88172645463325252ULL), log_id_(1) {}
+  virtual void SetUp() override
+  {
+    src_ = new char[BUF_SIZE];
+    dst_ = new char[BUF_SIZE];
+  }
+  virtual void TearDown() override
+  {
+    delete [] src_;
+    delete [] dst_;
+    delete [] compressed_;
+  }
+
+  // append a LogGroupEntry with one LogEntry of body_len to src_, and record the entry end
+  void append_entry(const int64_t body_len, const bool compressible)
+  {
+    LogGroupEntryHeader group_header;
+    LogEntryHeader entry_header;
+    const int64_t group_header_size = group_header.get_serialize_size();
+    const int64_t entry_header_size = entry_header.get_serialize_size();
+    char *buf = src_ + src_len_;
+    char *body = buf + group_header_size + entry_header_size;
+    ASSERT_LE(src_len_ + group_header_size + entry_header_size + body_len, BUF_SIZE);
+    for (int64_t i = 0; i < body_len; i++) {
+      if (compressible) {
+        body[i] = static_cast<char>('a' + (i / 100) % 26);
+      } else {
+        seed_ ^= seed_ << 13;
+        seed_ ^= seed_ >> 7;
+        seed_ ^= seed_ << 17;
+        body[i] = static_cast<char>(seed_);
+      }
+    }
+    int64_t pos = 0;
+    ASSERT_EQ(OB_SUCCESS, entry_header.generate_header(body, body_len, share::SCN::base_scn()));
+    ASSERT_EQ(OB_SUCCESS, entry_header.serialize(buf + group_header_size, entry_header_size, pos));
+    LogWriteBuf write_buf;
+    int64_t data_checksum = 0;
+    ASSERT_EQ(OB_SUCCESS, write_buf.push_back(buf, group_header_size + entry_header_size + body_len));
+    ASSERT_EQ(OB_SUCCESS, group_header.generate(false, false, write_buf, entry_header_size + body_len,
+          share::SCN::base_scn(), log_id_++, LSN(src_len_), 1, data_checksum));
+    group_header.update_header_checksum();
+    pos = 0;
+    ASSERT_EQ(OB_SUCCESS, group_header.serialize(buf, group_header_size, pos));
+    src_len_ += group_header_size + entry_header_size + body_len;
+    entry_ends_.push_back(src_len_);
+  }
+  void compress(const ObCompressorType type)
+  {
+    ASSERT_EQ(OB_SUCCESS, ObArchiveCompressUtil::get_max_compressed_size(type, src_len_, max_size_));
+    compressed_ = new char[max_size_];
+    compressed_len_ = 0;
+    ASSERT_EQ(OB_SUCCESS, ObArchiveCompressUtil::compress(type, src_, src_len_,
+          compressed_, max_size_, compressed_len_));
+    // compressed data never grows, so an archive file always holds its logs
+    ASSERT_LE(compressed_len_, src_len_);
+  }
+  bool is_entry_end(const int64_t offset) const
+  {
+    bool bret = false;
+    for (int64_t i = 0; ! bret && i < static_cast<int64_t>(entry_ends_.size()); i++) {
+      bret = entry_ends_[i] == offset;
+    }
+    return bret;
+  }
+  // decompress every unit one by one, each one must decompress to whole log group entries
+  void check_units(int64_t &block_count)
+  {
+    int64_t pos = 0;
+    dst_len_ = 0;
+    block_count = 0;
+    while (pos < compressed_len_) {
+      int64_t consumed_len = 0;
+      ObArchiveBlockMeta meta;
+      int64_t meta_pos = 0;
+      if (ObArchiveBlockMeta::is_block_meta(compressed_ + pos, compressed_len_ - pos)) {
+        ASSERT_EQ(OB_SUCCESS, meta.deserialize(compressed_ + pos, compressed_len_ - pos, meta_pos));
+        consumed_len = meta_pos + meta.data_len_;
+        block_count++;
+      } else {
+        LogGroupEntryHeader header;
+        ASSERT_EQ(OB_SUCCESS, header.deserialize(compressed_ + pos, compressed_len_ - pos, meta_pos));
+        consumed_len = meta_pos + header.get_data_len();
+      }
+      ASSERT_EQ(OB_SUCCESS, ObArchiveCompressUtil::decompress(compressed_ + pos, consumed_len,
+            dst_, BUF_SIZE, dst_len_));
+      ASSERT_TRUE(is_entry_end(dst_len_)) << dst_len_;
+      pos += consumed_len;
+    }
+    ASSERT_EQ(src_len_, dst_len_);
+    ASSERT_EQ(0, MEMCMP(src_, dst_, src_len_));
+  }
+
+protected:
+  char *src_;
+  int64_t src_len_;
+  char *compressed_;
+  int64_t compressed_len_;
+  char *dst_;
+  int64_t dst_len_;
+  int64_t max_size_;
+  uint64_t seed_;
+  int64_t log_id_;
+  std::vector<int64_t> entry_ends_;
+};
+
+TEST_F(TestArchiveCompressUtil, compress_and_decompress)
+{
+  for (int64_t i = 0; i < 10; i++) {
+    append_entry(300 * 1024 + i, true);
+  }
+  compress(ZSTD_1_3_8_COMPRESSOR);
+  EXPECT_TRUE(ObArchiveBlockMeta::is_block_meta(compressed_, compressed_len_));
+  EXPECT_LT(compressed_len_, src_len_);
+
+  bool is_compressed = false;
+  int64_t origin_len = 0;
+  int64_t consumed_len = 0;
+  EXPECT_EQ(OB_SUCCESS, ObArchiveCompressUtil::scan(compressed_, compressed_len_,
+        is_compressed, origin_len, consumed_len));
+  EXPECT_TRUE(is_compressed);
+  EXPECT_EQ(src_len_, origin_len);
+  EXPECT_EQ(compressed_len_, consumed_len);
+  EXPECT_EQ(OB_SUCCESS, ObArchiveCompressUtil::decompress(compressed_, consumed_len, dst_, BUF_SIZE, dst_len_));
+  EXPECT_EQ(src_len_, dst_len_);
+  EXPECT_EQ(0, MEMCMP(src_, dst_, src_len_));
+
+  // blocks are cut at log group entry boundaries and no larger than ARCHIVE_COMPRESS_BLOCK_SIZE
+  int64_t block_count = 0;
+  check_units(block_count);
+  EXPECT_EQ(2, block_count);
+}
+
+// the file is read in two steps, and the first read stops in the middle of a block,
+// the restart offset must match the lsn of the decompressed data
+TEST_F(TestArchiveCompressUtil, split_read)
+{
+  for (int64_t i = 0; i < 20; i++) {
+    append_entry(300 * 1024 + i, true);
+  }
+  compress(LZ4_COMPRESSOR);
+  for (int64_t cut = 1; cut < compressed_len_; cut += compressed_len_ / 7) {
+    bool is_compressed = false;
+    int64_t origin_len = 0;
+    int64_t first_consumed_len = 0;
+    int64_t second_consumed_len = 0;
+    int64_t first_len = 0;
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressUtil::scan(compressed_, cut, is_compressed, origin_len, first_consumed_len));
+    EXPECT_LE(first_consumed_len, cut);
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressUtil::decompress(compressed_, first_consumed_len, dst_, BUF_SIZE, first_len));
+    EXPECT_EQ(origin_len, first_len);
+    EXPECT_TRUE(0 == first_len || is_entry_end(first_len)) << cut << " " << first_len;
+
+    // read again from the consumed offset
+    int64_t second_len = first_len;
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressUtil::scan(compressed_ + first_consumed_len,
+          compressed_len_ - first_consumed_len, is_compressed, origin_len, second_consumed_len));
+    EXPECT_EQ(compressed_len_, first_consumed_len + second_consumed_len);
+    EXPECT_EQ(OB_SUCCESS, ObArchiveCompressUtil::decompress(compressed_ + first_consumed_len,
+          second_consumed_len, dst_, BUF_SIZE, second_len));
+    EXPECT_EQ(src_len_, second_len);
+    EXPECT_EQ(0, MEMCMP(src_, dst_, src_len_)) << cut;
+  }
+}
+
+TEST_F(TestArchiveCompressUtil, incompressible_entries)
+{
+  for (int64_t i = 0; i < 5; i++) {
+    append_entry(4096 * (i + 1), false);
+  }
+  compress(LZ4_COMPRESSOR);
+  // random data is kept as log group entries, without block meta
+  EXPECT_EQ(src_len_, compressed_len_);
+  EXPECT_EQ(0, MEMCMP(src_, compressed_, src_len_));
+  bool is_compressed = true;
+  int64_t origin_len = 0;
+  int64_t consumed_len = 0;
+  EXPECT_EQ(OB_SUCCESS, ObArchiveCompressUtil::scan(compressed_, compressed_len_,
+        is_compressed, origin_len, consumed_len));
+  EXPECT_FALSE(is_compressed);
+  EXPECT_EQ(src_len_, origin_len);
+  int64_t block_count = 0;
+  check_units(block_count);
+  EXPECT_EQ(0, block_count);
+}
+
+TEST_F(TestArchiveCompressUtil, large_entry)
+{
+  // a log larger than ARCHIVE_COMPRESS_BLOCK_SIZE takes a block alone
+  append_entry(ARCHIVE_COMPRESS_BLOCK_SIZE + 1024, true);
+  append_entry(1024, true);
+  ASSERT_GT(entry_ends_[0], ARCHIVE_COMPRESS_BLOCK_SIZE);
+  ASSERT_LE(entry_ends_[0], MAX_ARCHIVE_COMPRESS_BLOCK_SIZE);
+  compress(ZSTD_1_3_8_COMPRESSOR);
+  ObArchiveBlockMeta meta;
+  int64_t pos = 0;
+  EXPECT_EQ(OB_SUCCESS, meta.deserialize(compressed_, compressed_len_, pos));
+  EXPECT_TRUE(meta.is_valid());
+  EXPECT_EQ(entry_ends_[0], meta.origin_data_len_);
+  int64_t block_count = 0;
+  check_units(block_count);
+  EXPECT_EQ(2, block_count);
+}
+
+TEST_F(TestArchiveCompressUtil, invalid_data)
+{
+  append_entry(300 * 1024, true);
+  append_entry(300 * 1024, true);
+  int64_t max_size = 0;
+  int64_t pos = 0;
+  EXPECT_EQ(OB_SUCCESS, ObArchiveCompressUtil::get_max_compressed_size(LZ4_COMPRESSOR, src_len_, max_size));
+  compressed_ = new char[max_size];
+  // source data must be complete log group entries
+  EXPECT_EQ(OB_INVALID_DATA, ObArchiveCompressUtil::compress(LZ4_COMPRESSOR, src_, src_len_ - 1,
+        compressed_, max_size, pos));
+  pos = 0;
+  EXPECT_NE(OB_SUCCESS, ObArchiveCompressUtil::compress(LZ4_COMPRESSOR, src_ + 1, src_len_ - 1,
+        compressed_, max_size, pos));
+  delete [] compressed_;
+  compressed_ = NULL;
+
+  // corrupted data is detected by checksum
+  compress(LZ4_COMPRESSOR);
+  ASSERT_TRUE(ObArchiveBlockMeta::is_block_meta(compressed_, compressed_len_));
+  compressed_[compressed_len_ - 1] ^= 0xFF;
+  EXPECT_EQ(OB_INVALID_DATA, ObArchiveCompressUtil::decompress(compressed_, compressed_len_, dst_, BUF_SIZE, dst_len_));
+}
+
+class MockDataGenerator : public logservice::RemoteDataGenerator
+{
+public:
+  MockDataGenerator() : RemoteDataGenerator(OB_SERVER_TENANT_ID, share::ObLSID(1001), LSN(0),
+      LSN(palf::LOG_MAX_LSN_VAL), share::SCN::max_scn()) {}
+  virtual int next_buffer(palf::LSN &lsn, char *&buf, int64_t &buf_size) override
+  {
+    UNUSED(lsn);
+    UNUSED(buf);
+    UNUSED(buf_size);
+    return OB_NOT_SUPPORTED;
+  }
+  virtual int update_max_lsn(const palf::LSN &lsn) override { return update_max_lsn_(lsn); }
+  int process(char *origin_buf, const int64_t origin_buf_size, char *&buf, int64_t &buf_size, int64_t &consumed_size)
+  {
+    return process_origin_data_(origin_buf, origin_buf_size, buf, buf_size, consumed_size);
+  }
+};
+
+// a range read of a file with raw log group entries followed by compressed blocks
+TEST_F(TestArchiveCompressUtil, process_origin_data)
+{
+  // the first block is filled with incompressible entries and kept raw,
+  // the following compressible ones are compressed in blocks
+  for (int64_t i = 0; i < 2; i++) {
+    append_entry(ARCHIVE_COMPRESS_BLOCK_SIZE / 2 - 1024, false);
+  }
+  const int64_t raw_len = src_len_;
+  for (int64_t i = 0; i < 10; i++) {
+    append_entry(300 * 1024 + i, true);
+  }
+  compress(ZSTD_1_3_8_COMPRESSOR);
+  ASSERT_EQ(0, MEMCMP(src_, compressed_, raw_len));
+  ASSERT_TRUE(ObArchiveBlockMeta::is_block_meta(compressed_ + raw_len, compressed_len_ - raw_len));
+  ObArchiveBlockMeta meta;
+  int64_t meta_pos = 0;
+  ASSERT_EQ(OB_SUCCESS, meta.deserialize(compressed_ + raw_len, compressed_len_ - raw_len, meta_pos));
+  const int64_t first_block_len = meta_pos + meta.data_len_;
+
+  MockDataGenerator generator;
+  char *buf = NULL;
+  int64_t buf_size = 0;
+  int64_t consumed_size = 0;
+  // [raw entries][incomplete block], only the raw entries are returned
+  const int64_t cut_list[] = {raw_len + 1, raw_len + ObArchiveBlockMeta::get_meta_size(),
+      raw_len + first_block_len - 1};
+  for (int64_t i = 0; i < 3; i++) {
+    EXPECT_EQ(OB_SUCCESS, generator.process(compressed_, cut_list[i], buf, buf_size, consumed_size));
+    EXPECT_EQ(compressed_, buf);
+    EXPECT_EQ(raw_len, buf_size) << cut_list[i];
+    EXPECT_EQ(raw_len, consumed_size) << cut_list[i];
+  }
+  // [raw entries][complete block][incomplete block], decompressed to whole log group entries
+  EXPECT_EQ(OB_SUCCESS, generator.process(compressed_, raw_len + first_block_len + 1,
+        buf, buf_size, consumed_size));
+  EXPECT_EQ(raw_len + first_block_len, consumed_size);
+  EXPECT_EQ(raw_len + meta.origin_data_len_, buf_size);
+  EXPECT_TRUE(is_entry_end(buf_size));
+  EXPECT_EQ(0, MEMCMP(src_, buf, buf_size));
+  // read again from the consumed offset
+  const int64_t first_size = buf_size;
+  EXPECT_EQ(OB_SUCCESS, generator.process(compressed_ + consumed_size, compressed_len_ - consumed_size,
+        buf, buf_size, consumed_size));
+  EXPECT_EQ(src_len_, first_size + buf_size);
+  EXPECT_EQ(0, MEMCMP(src_ + first_size, buf, buf_size));
+  // only an incomplete block, nothing can be read
+  EXPECT_EQ(OB_ITER_END, generator.process(compressed_ + raw_len, first_block_len - 1,
+        buf, buf_size, consumed_size));
+  // raw entries with incomplete tail are returned as before
+  EXPECT_EQ(OB_SUCCESS, generator.process(compressed_, raw_len - 1, buf, buf_size, consumed_size));
+  EXPECT_EQ(raw_len - 1, buf_size);
+  EXPECT_EQ(raw_len - 1, consumed_size);
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_archive_compress_util.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "logservice/palf/log_hot_cache.h"
+#include "share/allocator/ob_tenant_mutil_allocator.h"
+#undef private
+#include "lib/ob_errno.h"
+#include "logservice/palf/log_writer_utils.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace palf;
+
+class TestLogHotCache : public ::testing::Test
+{
+public:
+  static const int64_t CACHE_SIZE = 64;
+  static const int64_t DATA_SIZE = 1024;
+  TestLogHotCache() : alloc_mgr_(OB_SERVER_TENANT_ID) {}
+  virtual void SetUp() override
+  {
+    // the byte at lsn i is data_[i], so the content read from any lsn can be checked
+    for (int64_t i = 0; i < DATA_SIZE; i++) {
+      data_[i] = static_cast<char>('a' + i % 26);
+    }
+  }
+  virtual void TearDown() override { cache_.destroy(); }
+
+  // fill [start, start + size) in two pieces, just like LogStorage::writev
+  void fill(const int64_t start, const int64_t size)
+  {
+    LogWriteBuf write_buf;
+    const int64_t first_size = size / 2;
+    ASSERT_EQ(OB_SUCCESS, write_buf.push_back(data_ + start, first_size));
+    ASSERT_EQ(OB_SUCCESS, write_buf.push_back(data_ + start + first_size, size - first_size));
+    cache_.fill(LSN(start), write_buf);
+  }
+  void check_hit(const int64_t start, const int64_t size)
+  {
+    char buf[DATA_SIZE];
+    ASSERT_EQ(OB_SUCCESS, cache_.read(LSN(start), size, buf)) << start << " " << size;
+    ASSERT_EQ(0, MEMCMP(data_ + start, buf, size)) << start << " " << size;
+  }
+  void check_miss(const int64_t start, const int64_t size)
+  {
+    char buf[DATA_SIZE];
+    ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.read(LSN(start), size, buf)) << start << " " << size;
+  }
+
+protected:
+  ObTenantMutilAllocator alloc_mgr_;
+  LogHotCache cache_;
+  char data_[DATA_SIZE];
+};
+
+TEST_F(TestLogHotCache, init_and_budget)
+{
+  char buf[CACHE_SIZE];
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.read(LSN(0), 1, buf));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.init(1, 0, &alloc_mgr_));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.init(1, CACHE_SIZE, NULL));
+  // hot cache takes at most 5% of the tenant memory, only one cache can be allocated
+  const int64_t total_limit = 2 * CACHE_SIZE * 100 / alloc_mgr_.LOG_HOT_CACHE_MEM_LIMIT_PERCENT - 100;
+  alloc_mgr_.set_limit(total_limit);
+  ASSERT_LT(alloc_mgr_.log_hot_cache_limit_, 2 * CACHE_SIZE);
+  // nothing is carved out of the common budget before a cache is allocated
+  const int64_t common_limit = alloc_mgr_.common_blk_alloc_.limit();
+  ASSERT_EQ(total_limit - alloc_mgr_.clog_blk_alloc_.limit() - alloc_mgr_.inner_table_replay_blk_alloc_.limit()
+            - alloc_mgr_.user_table_replay_blk_alloc_.limit(), common_limit);
+  ASSERT_EQ(0, alloc_mgr_.common_blk_alloc_.hold());
+  ASSERT_EQ(OB_SUCCESS, cache_.init(1, CACHE_SIZE, &alloc_mgr_));
+  ASSERT_EQ(OB_INIT_TWICE, cache_.init(1, CACHE_SIZE, &alloc_mgr_));
+  // the cache is charged to the common budget when allocated
+  ASSERT_EQ(CACHE_SIZE, alloc_mgr_.log_hot_cache_hold_);
+  ASSERT_EQ(CACHE_SIZE, alloc_mgr_.common_blk_alloc_.hold());
+  ASSERT_EQ(common_limit, alloc_mgr_.common_blk_alloc_.limit());
+  LogHotCache other_cache;
+  ASSERT_EQ(OB_ALLOCATE_MEMORY_FAILED, other_cache.init(2, CACHE_SIZE, &alloc_mgr_));
+  ASSERT_FALSE(other_cache.is_inited());
+  ASSERT_EQ(CACHE_SIZE, alloc_mgr_.log_hot_cache_hold_);
+  ASSERT_EQ(CACHE_SIZE, alloc_mgr_.common_blk_alloc_.hold());
+  // memory is given back to the common budget after destroy
+  cache_.destroy();
+  ASSERT_EQ(0, alloc_mgr_.log_hot_cache_hold_);
+  ASSERT_EQ(0, alloc_mgr_.common_blk_alloc_.hold());
+  ASSERT_EQ(OB_SUCCESS, other_cache.init(2, CACHE_SIZE, &alloc_mgr_));
+  other_cache.destroy();
+  ASSERT_EQ(0, alloc_mgr_.log_hot_cache_hold_);
+  ASSERT_EQ(0, alloc_mgr_.common_blk_alloc_.hold());
+}
+
+TEST_F(TestLogHotCache, fill_and_read)
+{
+  ASSERT_EQ(OB_SUCCESS, cache_.init(1, CACHE_SIZE, &alloc_mgr_));
+  // nothing is cached before the start lsn is known
+  fill(0, 10);
+  check_miss(0, 10);
+  cache_.reset(LSN(10));
+  fill(10, 20);
+  fill(30, 20);
+  check_hit(10, 40);
+  check_hit(10, 1);
+  check_hit(25, 10);
+  check_hit(49, 1);
+  // out of [start_lsn_, end_lsn_)
+  check_miss(0, 11);
+  check_miss(9, 1);
+  check_miss(40, 11);
+  check_miss(50, 1);
+  char buf[CACHE_SIZE];
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.read(LSN(10), 0, buf));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.read(LSN(10), 1, NULL));
+}
+
+TEST_F(TestLogHotCache, overwrite)
+{
+  ASSERT_EQ(OB_SUCCESS, cache_.init(1, CACHE_SIZE, &alloc_mgr_));
+  cache_.reset(LSN(0));
+  fill(0, 40);
+  fill(40, 40);
+  // the oldest logs are overwritten, and the cached logs wrap around the end of ring
+  ASSERT_EQ(80 - CACHE_SIZE, cache_.start_lsn_.val_);
+  ASSERT_EQ(80, cache_.end_lsn_.val_);
+  check_miss(0, 10);
+  check_miss(80 - CACHE_SIZE - 1, 10);
+  check_hit(80 - CACHE_SIZE, CACHE_SIZE);
+  check_hit(60, 20);
+  // keep writing several rounds
+  for (int64_t start = 80; start + 30 <= DATA_SIZE; start += 30) {
+    fill(start, 30);
+    check_hit(start + 30 - CACHE_SIZE, CACHE_SIZE);
+    check_miss(start + 30 - CACHE_SIZE - 1, 1);
+  }
+}
+
+TEST_F(TestLogHotCache, reset)
+{
+  ASSERT_EQ(OB_SUCCESS, cache_.init(1, CACHE_SIZE, &alloc_mgr_));
+  cache_.reset(LSN(0));
+  fill(0, 40);
+  check_hit(0, 40);
+  // non-continuous logs, restart from the next write
+  fill(100, 20);
+  ASSERT_EQ(0, cache_.reset_seq_ & 1);
+  check_miss(0, 40);
+  check_miss(100, 20);
+  fill(120, 20);
+  check_hit(120, 20);
+  // logs larger than cache
+  fill(140, CACHE_SIZE + 1);
+  check_miss(140, CACHE_SIZE);
+  fill(141 + CACHE_SIZE, 10);
+  check_hit(141 + CACHE_SIZE, 10);
+  // truncate or flashback
+  cache_.reset(LSN(145 + CACHE_SIZE));
+  check_miss(141 + CACHE_SIZE, 10);
+  check_miss(145 + CACHE_SIZE, 1);
+  fill(145 + CACHE_SIZE, 20);
+  check_hit(145 + CACHE_SIZE, 20);
+  // destroyed cache never hits
+  cache_.destroy();
+  check_miss(145 + CACHE_SIZE, 20);
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_log_hot_cache.log*");
+  OB_LOGGER.set_file_name("test_log_hot_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "observer/table_load/ob_table_load_obj_cast.h"
+#undef private
+#include "share/object/ob_obj_cast.h"
+#include "lib/allocator/page_arena.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace observer
+{
+
+class TestTableLoadColumnCaster : public ::testing::Test
+{
+public:
+  TestTableLoadColumnCaster()
+    : allocator_(ObModIds::TEST),
+      cast_ctx_(&allocator_, &dtc_params_, CM_NONE, CS_TYPE_UTF8MB4_GENERAL_CI)
+  {}
+  virtual ~TestTableLoadColumnCaster() {}
+  virtual void SetUp() {}
+  virtual void TearDown() { allocator_.reset(); }
+
+  // the fast path must agree with ObObjCaster on every input it accepts
+  void check_int(const char *str, const ObObjType expect_type, const bool expect_fast);
+  void check_date(const char *str, const bool expect_fast);
+  void check_datetime(const char *str, const bool expect_fast);
+  void cast_by_obj_caster(const char *str, const ObObjType expect_type, ObObj &out_obj);
+
+protected:
+  ObArenaAllocator allocator_;
+  const ObDataTypeCastParams dtc_params_;
+  ObCastCtx cast_ctx_;
+};
+
+void TestTableLoadColumnCaster::cast_by_obj_caster(const char *str,
+                                                   const ObObjType expect_type,
+                                                   ObObj &out_obj)
+{
+  ObObj src;
+  src.set_varchar(str, static_cast<int32_t>(strlen(str)));
+  src.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+  ASSERT_EQ(OB_SUCCESS, ObObjCaster::to_type(expect_type, cast_ctx_, src, out_obj)) << str;
+}
+
+void TestTableLoadColumnCaster::check_int(const char *str,
+                                          const ObObjType expect_type,
+                                          const bool expect_fast)
+{
+  int64_t value = 0;
+  const int ret = ObTableLoadColumnCaster::int_fast_from(str, strlen(str), expect_type, value);
+  if (!expect_fast) {
+    ASSERT_EQ(OB_EAGAIN, ret) << str;
+  } else {
+    ObObj out_obj;
+    ASSERT_EQ(OB_SUCCESS, ret) << str;
+    cast_by_obj_caster(str, expect_type, out_obj);
+    ASSERT_EQ(out_obj.get_int(), value) << str;
+  }
+}
+
+void TestTableLoadColumnCaster::check_date(const char *str, const bool expect_fast)
+{
+  int32_t date = 0;
+  const int ret = ObTableLoadColumnCaster::date_fast_from(str, strlen(str), date);
+  if (!expect_fast) {
+    ASSERT_EQ(OB_EAGAIN, ret) << str;
+  } else {
+    ObObj out_obj;
+    ASSERT_EQ(OB_SUCCESS, ret) << str;
+    cast_by_obj_caster(str, ObDateType, out_obj);
+    ASSERT_EQ(out_obj.get_date(), date) << str;
+  }
+}
+
+void TestTableLoadColumnCaster::check_datetime(const char *str, const bool expect_fast)
+{
+  int64_t datetime = 0;
+  const int ret = ObTableLoadColumnCaster::datetime_fast_from(str, strlen(str), datetime);
+  if (!expect_fast) {
+    ASSERT_EQ(OB_EAGAIN, ret) << str;
+  } else {
+    ObObj out_obj;
+    ASSERT_EQ(OB_SUCCESS, ret) << str;
+    cast_by_obj_caster(str, ObDateTimeType, out_obj);
+    ASSERT_EQ(out_obj.get_datetime(), datetime) << str;
+  }
+}
+
+TEST_F(TestTableLoadColumnCaster, int_fast_from)
+{
+  // boundary
+  check_int("0", ObTinyIntType, true);
+  check_int("-0", ObTinyIntType, true);
+  check_int("+127", ObTinyIntType, true);
+  check_int("-128", ObTinyIntType, true);
+  check_int("32767", ObSmallIntType, true);
+  check_int("-2147483648", ObInt32Type, true);
+  check_int("000000000000000001", ObIntType, true);
+  check_int("999999999999999999", ObIntType, true);
+  check_int("-999999999999999999", ObIntType, true);
+  // overflow, left to the generic path to truncate or report by cast mode
+  check_int("128", ObTinyIntType, false);
+  check_int("-129", ObTinyIntType, false);
+  check_int("2147483648", ObInt32Type, false);
+  check_int("9223372036854775807", ObIntType, false);
+  check_int("-9223372036854775808", ObIntType, false);
+  check_int("99999999999999999999", ObIntType, false);
+  // invalid
+  check_int("", ObIntType, false);
+  check_int("+", ObIntType, false);
+  check_int("-", ObIntType, false);
+  check_int("12a", ObIntType, false);
+  check_int(" 12", ObIntType, false);
+  check_int("12 ", ObIntType, false);
+  check_int("1.5", ObIntType, false);
+  check_int("1e3", ObIntType, false);
+  check_int("--1", ObIntType, false);
+}
+
+TEST_F(TestTableLoadColumnCaster, date_fast_from)
+{
+  // boundary
+  check_date("1970-01-01", true);
+  check_date("1969-12-31", true);
+  check_date("1000-01-01", true);
+  check_date("9999-12-31", true);
+  check_date("2000-02-29", true);
+  check_date("2020-02-29", true);
+  check_date("2023-04-30", true);
+  // out of range
+  check_date("0999-12-31", false);
+  check_date("1900-02-29", false);
+  check_date("2019-02-29", false);
+  check_date("2023-04-31", false);
+  check_date("2020-13-01", false);
+  check_date("2020-00-10", false);
+  check_date("2020-01-00", false);
+  // invalid
+  check_date("", false);
+  check_date("2020-1-01", false);
+  check_date("2020/01/01", false);
+  check_date("20200101", false);
+  check_date("2020-01-01 ", false);
+  check_date("2020-0a-01", false);
+}
+
+TEST_F(TestTableLoadColumnCaster, datetime_fast_from)
+{
+  // boundary
+  check_datetime("1970-01-01 00:00:00", true);
+  check_datetime("1969-12-31 23:59:59", true);
+  check_datetime("1000-01-01 00:00:00", true);
+  check_datetime("9999-12-31 23:59:59", true);
+  check_datetime("2020-02-29 12:34:56", true);
+  check_datetime("2020-02-29", true);
+  // out of range
+  check_datetime("2019-02-29 00:00:00", false);
+  check_datetime("2020-02-29 24:00:00", false);
+  check_datetime("2020-02-29 23:60:00", false);
+  check_datetime("2020-02-29 23:59:60", false);
+  // invalid
+  check_datetime("", false);
+  check_datetime("2020-02-29T23:59:59", false);
+  check_datetime("2020-02-29 23:59:59.5", false);
+  check_datetime("2020-02-29 23-59-59", false);
+  check_datetime("2020-02-29 3:59:59", false);
+  check_datetime("2020-02-29 23:59", false);
+}
+
+} // namespace observer
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
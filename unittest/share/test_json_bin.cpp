@@ -1047,6 +1047,38 @@ TEST_F(TestJsonBin, test_seek_array_range) {
   }
 }
 
+TEST_F(TestJsonBin, test_seek_simple_path) {
+  ObArenaAllocator allocator(ObModIds::TEST);
+  common::ObString j_text("{\"a\": [1, {\"b\": \"x\", \"c\": [2, 3]}], \"d\": 4}");
+  const char *paths[] = { "$", "$.a[1].c[last]", "$.a[1].b", "$.d[0]", "$.a[5]", "$.e", "$.d.b", "$.a[1].c[1][0]" };
+  for (int64_t i = 0; i < ARRAYSIZEOF(paths); ++i) {
+    ObJsonPath test_path(paths[i], &allocator);
+    ASSERT_EQ(OB_SUCCESS, test_path.parse_path());
+    ASSERT_TRUE(test_path.is_simple_path());
+    ObIJsonBase *j_bin = NULL;
+    ASSERT_EQ(OB_SUCCESS, ObJsonBaseFactory::get_json_base(&allocator, j_text,
+        ObJsonInType::JSON_TREE, ObJsonInType::JSON_BIN, j_bin));
+    ObJsonBaseVector hit;
+    ASSERT_EQ(OB_SUCCESS, j_bin->seek(test_path, test_path.path_node_cnt(), true, false, hit));
+    // seek in place gets the same result as generic seek
+    bool is_found = false;
+    ASSERT_EQ(OB_SUCCESS, static_cast<ObJsonBin *>(j_bin)->seek_simple_path(test_path,
+        test_path.path_node_cnt(), true, is_found));
+    ASSERT_EQ(hit.size() == 1, is_found);
+    if (is_found) {
+      ObJsonBuffer expect_buf(&allocator);
+      ObJsonBuffer actual_buf(&allocator);
+      ASSERT_EQ(OB_SUCCESS, hit[0]->print(expect_buf, false));
+      ASSERT_EQ(OB_SUCCESS, j_bin->print(actual_buf, false));
+      ASSERT_EQ(0, expect_buf.string().compare(actual_buf.string()));
+    }
+  }
+
+  ObJsonPath wildcard_path("$.a[*]", &allocator);
+  ASSERT_EQ(OB_SUCCESS, wildcard_path.parse_path());
+  ASSERT_FALSE(wildcard_path.is_simple_path());
+}
+
 TEST_F(TestJsonBin, test_seek_ellipsis) {
   common::ObString path_str("$**[0]");
   std::cout<<"path_expression:"<<path_str.ptr()<<std::endl;
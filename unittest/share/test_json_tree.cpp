@@ -303,6 +303,185 @@ TEST_F(TestJsonTree, test_rapijson)
   ASSERT_EQ(13, wr_info_offest);
 }
 
+TEST_F(TestJsonTree, test_parse_long_whitespace_and_string)
+{
+  // with RAPIDJSON_SSE2 whitespaces are skipped in blocks of 16 bytes, cover all offsets around block boundary
+  common::ObArenaAllocator allocator(ObModIds::TEST);
+  const char *syntaxerr = NULL;
+  ObJsonNode *json_tree = NULL;
+  for (int64_t len = 0; len < 40; ++len) {
+    ObJsonBuffer j_text(&allocator);
+    ObJsonBuffer expect(&allocator);
+    for (int64_t i = 0; i < len; ++i) {
+      ASSERT_EQ(OB_SUCCESS, j_text.append(i % 2 == 0 ? " " : "\n"));
+    }
+    ASSERT_EQ(OB_SUCCESS, j_text.append("[\""));
+    ASSERT_EQ(OB_SUCCESS, expect.append("[\""));
+    for (int64_t i = 0; i < len; ++i) {
+      ASSERT_EQ(OB_SUCCESS, j_text.append(i == len - 1 ? "\\\"" : "a"));
+      ASSERT_EQ(OB_SUCCESS, expect.append(i == len - 1 ? "\\\"" : "a"));
+    }
+    ASSERT_EQ(OB_SUCCESS, j_text.append("\"]"));
+    ASSERT_EQ(OB_SUCCESS, expect.append("\"]"));
+    for (int64_t i = 0; i < len; ++i) {
+      ASSERT_EQ(OB_SUCCESS, j_text.append("\t"));
+    }
+    ASSERT_EQ(OB_SUCCESS, ObJsonParser::parse_json_text(&allocator, j_text.ptr(),
+        j_text.length(), syntaxerr, NULL, json_tree));
+    ObJsonBuffer j_buf(&allocator);
+    ASSERT_EQ(OB_SUCCESS, json_tree->print(j_buf, false));
+    ASSERT_EQ(0, expect.string().compare(j_buf.string()));
+
+    // control character in string is invalid, and the error offset is exact
+    uint64_t err_offset = 0;
+    const char *err_info = NULL;
+    ObJsonBuffer wrong_text(&allocator);
+    for (int64_t i = 0; i < len; ++i) {
+      ASSERT_EQ(OB_SUCCESS, wrong_text.append(" "));
+    }
+    ASSERT_EQ(OB_SUCCESS, wrong_text.append("\""));
+    for (int64_t i = 0; i < len; ++i) {
+      ASSERT_EQ(OB_SUCCESS, wrong_text.append("b"));
+    }
+    ASSERT_EQ(OB_SUCCESS, wrong_text.append("\x01\""));
+    ASSERT_EQ(OB_ERR_INVALID_JSON_TEXT, ObJsonParser::parse_json_text(&allocator,
+        wrong_text.ptr(), wrong_text.length(), err_info, &err_offset, json_tree));
+    ASSERT_EQ(2 * len + 1, err_offset);
+  }
+}
+
+// ObJsonParser is built with RAPIDJSON_SSE2 on x86_64, this file is not.
+// A different stack allocator type gives a reader instantiation of this file only,
+// so ScalarJsonReader is the reader without SIMD.
+#ifdef RAPIDJSON_SSE2
+#error "the reference json reader must be built without RAPIDJSON_SSE2"
+#endif
+
+class ScalarJsonAllocator : public ObRapidJsonAllocator
+{
+public:
+  ScalarJsonAllocator() {}
+  explicit ScalarJsonAllocator(ObIAllocator *allocator) : ObRapidJsonAllocator(allocator) {}
+};
+typedef rapidjson::GenericReader<rapidjson::UTF8<>, rapidjson::UTF8<>, ScalarJsonAllocator> ScalarJsonReader;
+
+// same flags as ob_json_parse.cpp
+#define TEST_RELAXJSON_FLAG rapidjson::kParseObjectKeyNoQuotesFlag \
+                           | rapidjson::kParseIgnoreCaseForKeyword \
+                           | rapidjson::kParseRelaxNumberFlag \
+                           | rapidjson::kParseCommentsFlag \
+                           | rapidjson::kParseTrailingCommasFlag
+#define TEST_STRICTJSON_FLAG rapidjson::kParseObjectKeyNoQuotesFlag
+
+// ObJsonParser::parse_json_text with ScalarJsonReader
+static int scalar_parse_json_text(ObIAllocator *allocator, const ObString &text, uint32_t parse_flag,
+                                  uint64_t &offset, ObJsonNode *&j_tree)
+{
+  int ret = OB_SUCCESS;
+  char *buf = NULL;
+  if (OB_ISNULL(buf = static_cast<char *>(allocator->alloc(text.length() + 1)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else {
+    MEMCPY(buf, text.ptr(), text.length());
+    buf[text.length()] = '\0';
+    ObRapidJsonHandler handler(allocator, HAS_FLAG(parse_flag, ObJsonParser::JSN_UNIQUE_FLAG));
+    ScalarJsonAllocator parse_allocator(allocator);
+    rapidjson::InsituStringStream ss(buf);
+    ScalarJsonReader reader(&parse_allocator);
+    rapidjson::ParseResult r;
+    if (HAS_FLAG(parse_flag, ObJsonParser::JSN_RELAXED_FLAG)) {
+      r = reader.Parse<TEST_RELAXJSON_FLAG>(ss, handler);
+    } else if (HAS_FLAG(parse_flag, ObJsonParser::JSN_STRICT_FLAG)) {
+      r = reader.Parse<TEST_STRICTJSON_FLAG>(ss, handler);
+    } else {
+      r = reader.Parse<rapidjson::kParseInsituFlag>(ss, handler);
+    }
+    if (r.IsError()) {
+      ret = handler.has_duplicate_key() ? OB_ERR_DUPLICATE_KEY : OB_ERR_INVALID_JSON_TEXT;
+      offset = reader.GetErrorOffset();
+    } else if (OB_ISNULL(j_tree = handler.get_built_doc())) {
+      ret = OB_ERR_UNEXPECTED;
+    }
+  }
+  return ret;
+}
+
+TEST_F(TestJsonTree, test_parse_equal_to_scalar_reader)
+{
+  common::ObArenaAllocator allocator(ObModIds::TEST);
+  const char *corpus[] = {
+    "{ \"greeting\" : \"Hello!\", \"farewell\" : \"bye-bye!\"}",
+    "{\"a\":1,\"b\":[true,false,null],\"c\":{\"d\":\"e\",\"f\":[[],{}]}}",
+    "[0, -0, 1.5, -1.5e-3, 1E10, 18446744073709551615, -9223372036854775808, 123456789012345678901234567890]",
+    "[\"\\u4e2d\\u6587\", \"\xe4\xb8\xad\xe6\x96\x87\", \"\\ud83d\\ude00\", \"\\b\\f\\n\\r\\t\\/\\\\\\\"\"]",
+    "\"a string longer than sixteen bytes with an escape at the end\\n\"",
+    "{\"k\": \"                                        \", \"k2\" : [ 1 , 2 , 3 ] }",
+    "{a:1, b:[1,2,], /* comment */ c:{d:TRUE, e:Null}, } // line comment",
+    "[.5, 1., +1, 0x10]",
+    "{\"a\":1,\"a\":2}",
+    "[1,]",
+    "{\"a\"}",
+    "\"unterminated",
+    "[1 2]",
+    "{\"a\":1}}",
+    "\"control\x01char\"",
+    "\"tab\tin string\"",
+    "[tru]",
+    "\"\\ud800\"",
+    "\"\\x\"",
+    "/* unterminated comment",
+    "{\"a\":[{\"b\":[{\"c\":[{\"d\":\"deep\"}]}]}]}",
+  };
+  const char *whitespaces = " \n\r\t";
+  const uint32_t parse_flags[] = {
+    ObJsonParser::JSN_DEFAULT_FLAG,
+    ObJsonParser::JSN_STRICT_FLAG,
+    ObJsonParser::JSN_RELAXED_FLAG,
+    ObJsonParser::JSN_UNIQUE_FLAG,
+  };
+  for (int64_t i = 0; i < ARRAYSIZEOF(corpus); ++i) {
+    // pad the document and the tokens with whitespace runs of every length around the 16 bytes block
+    for (int64_t pad = 0; pad < 40; ++pad) {
+      ObJsonBuffer j_text(&allocator);
+      for (int64_t k = 0; k < pad; ++k) {
+        ASSERT_EQ(OB_SUCCESS, j_text.append(whitespaces + k % 4, 1));
+      }
+      for (const char *c = corpus[i]; *c != '\0'; ++c) {
+        ASSERT_EQ(OB_SUCCESS, j_text.append(c, 1));
+        if (pad % 3 == 0 && (*c == ',' || *c == ':' || *c == '[' || *c == '{')) {
+          for (int64_t k = 0; k < pad; ++k) {
+            ASSERT_EQ(OB_SUCCESS, j_text.append(whitespaces + k % 4, 1));
+          }
+        }
+      }
+      for (int64_t k = 0; k < pad; ++k) {
+        ASSERT_EQ(OB_SUCCESS, j_text.append(" ", 1));
+      }
+      for (int64_t f = 0; f < ARRAYSIZEOF(parse_flags); ++f) {
+        const char *syntaxerr = NULL;
+        uint64_t offset = 0;
+        uint64_t scalar_offset = 0;
+        ObJsonNode *j_tree = NULL;
+        ObJsonNode *scalar_tree = NULL;
+        int ret = ObJsonParser::parse_json_text(&allocator, j_text.ptr(), j_text.length(),
+                                                syntaxerr, &offset, j_tree, parse_flags[f]);
+        int scalar_ret = scalar_parse_json_text(&allocator, j_text.string(), parse_flags[f],
+                                                scalar_offset, scalar_tree);
+        ASSERT_EQ(scalar_ret, ret) << i << " " << pad << " " << f;
+        if (OB_SUCCESS == ret) {
+          ObJsonBuffer j_buf(&allocator);
+          ObJsonBuffer scalar_buf(&allocator);
+          ASSERT_EQ(OB_SUCCESS, j_tree->print(j_buf, false));
+          ASSERT_EQ(OB_SUCCESS, scalar_tree->print(scalar_buf, false));
+          ASSERT_EQ(0, scalar_buf.string().compare(j_buf.string())) << i << " " << pad << " " << f;
+        } else {
+          ASSERT_EQ(scalar_offset, offset) << i << " " << pad << " " << f;
+        }
+      }
+    }
+  }
+}
+
 TEST_F(TestJsonTree, test_json_object)
 {
   ObArenaAllocator allocator(ObModIds::TEST);
@@ -67,6 +67,74 @@ TEST_F(ObExprGeoUtilsTest, parse_axis_order_test)
   ASSERT_EQ(ObGeoAxisOrder::INVALID, axis_order);
 }
 
+static void append_uint32(std::string &wkb, uint32_t val)
+{
+  wkb.append(reinterpret_cast<const char *>(&val), sizeof(val));
+}
+
+static void append_point(std::string &wkb, double x, double y)
+{
+  wkb.append(reinterpret_cast<const char *>(&x), sizeof(x));
+  wkb.append(reinterpret_cast<const char *>(&y), sizeof(y));
+}
+
+// little endian wkb with srid 0
+static std::string make_point_wkb(double x, double y)
+{
+  std::string wkb;
+  append_uint32(wkb, 0);
+  wkb.append(1, static_cast<char>(1));
+  append_uint32(wkb, 1);
+  append_point(wkb, x, y);
+  return wkb;
+}
+
+TEST_F(ObExprGeoUtilsTest, const_param_cache_test)
+{
+  ObArenaAllocator allocator;
+  // POLYGON((0 0, 10 0, 10 10, 0 10, 0 0))
+  std::string poly_wkb;
+  append_uint32(poly_wkb, 0);
+  poly_wkb.append(1, static_cast<char>(1));
+  append_uint32(poly_wkb, 3);
+  append_uint32(poly_wkb, 1);
+  append_uint32(poly_wkb, 5);
+  append_point(poly_wkb, 0, 0);
+  append_point(poly_wkb, 10, 0);
+  append_point(poly_wkb, 10, 10);
+  append_point(poly_wkb, 0, 10);
+  append_point(poly_wkb, 0, 0);
+
+  ObGeoConstParamCache cache;
+  ObString wkb(poly_wkb.length(), poly_wkb.data());
+  ASSERT_EQ(OB_SUCCESS, cache.init(allocator, wkb, 1, NULL, "unit_test"));
+  ASSERT_TRUE(cache.is_inited());
+  ASSERT_EQ(1, cache.get_param_idx());
+  ASSERT_TRUE(NULL != cache.get_geo());
+  ASSERT_EQ(OB_INIT_TWICE, cache.init(allocator, wkb, 1, NULL, "unit_test"));
+
+  std::string inner_wkb = make_point_wkb(5, 5);
+  std::string outer_wkb = make_point_wkb(20, 5);
+  ObGeometry *inner = NULL;
+  ObGeometry *outer = NULL;
+  ASSERT_EQ(OB_SUCCESS, ObGeoExprUtils::build_geometry(allocator,
+      ObString(inner_wkb.length(), inner_wkb.data()), inner, NULL, "unit_test"));
+  ASSERT_EQ(OB_SUCCESS, ObGeoExprUtils::build_geometry(allocator,
+      ObString(outer_wkb.length(), outer_wkb.data()), outer, NULL, "unit_test"));
+
+  bool may_satisfy = false;
+  ASSERT_EQ(OB_SUCCESS, cache.check_mbr(allocator, *inner, ObGeoRelationType::T_INTERSECTS, may_satisfy));
+  ASSERT_TRUE(may_satisfy);
+  ASSERT_EQ(OB_SUCCESS, cache.check_mbr(allocator, *inner, ObGeoRelationType::T_COVERS, may_satisfy));
+  ASSERT_TRUE(may_satisfy);
+  ASSERT_EQ(OB_SUCCESS, cache.check_mbr(allocator, *inner, ObGeoRelationType::T_COVEREDBY, may_satisfy));
+  ASSERT_FALSE(may_satisfy);
+  ASSERT_EQ(OB_SUCCESS, cache.check_mbr(allocator, *outer, ObGeoRelationType::T_INTERSECTS, may_satisfy));
+  ASSERT_FALSE(may_satisfy);
+  ASSERT_EQ(OB_SUCCESS, cache.check_mbr(allocator, *outer, ObGeoRelationType::T_COVERS, may_satisfy));
+  ASSERT_FALSE(may_satisfy);
+}
+
 int main(int argc, char **argv)
 {
   oceanbase::common::ObLogger::get_logger().set_log_level("DEBUG");
@@ -13,6 +13,8 @@
 #define USING_LOG_PREFIX SQL
 
 #include <gtest/gtest.h>
+#include <string>
+#include <vector>
 //#include "lib/utility/ob_test_util.h"
 //#include "sql/engine/test_engine_util.h"
 #include "sql/ob_sql_init.h"
@@ -305,6 +307,153 @@ TEST_F(TestParser, general_parser_escape)
 
 }
 
+TEST_F(TestParser, simd_parser_escape)
+{
+  ObDataInFileStruct file_struct;
+  file_struct.field_term_str_ = "|";
+  const int64_t column_num = 3;
+  const char *lines[] = {
+    "a|b|c\n",
+    "a\\|b|c|d\n",
+    "\\N|\\\\|x\\\n",
+    "\n",
+    "abc|def|\n",
+    "1|2|3|\n",
+    "\\\\\\||\\t\\Z|\\n\n",
+    "\xe4\xb8\xad|\\\xe4\xb8\xad|z\n",
+  };
+  std::string data;
+  const int64_t ROUND = 50;
+  const int64_t line_cnt = static_cast<int64_t>(sizeof(lines) / sizeof(lines[0]));
+  for (int64_t i = 0; i < ROUND; ++i) {
+    for (int64_t j = 0; j < line_cnt; ++j) {
+      data.append(lines[(i + j) % line_cnt]);
+    }
+  }
+  data.append("tail|without|newline");
+
+  ObCSVGeneralParser general_parser;
+  ObCSVGeneralParser simd_parser;
+  ASSERT_EQ(OB_SUCCESS, general_parser.init(file_struct, column_num, CS_TYPE_UTF8MB4_BIN));
+  ASSERT_EQ(OB_SUCCESS, simd_parser.init(file_struct, column_num, CS_TYPE_UTF8MB4_BIN));
+  ASSERT_TRUE(simd_parser.is_simd_scan_supported());
+
+  std::vector<std::string> general_fields;
+  std::vector<std::string> simd_fields;
+  auto collect = [](ObIArray<ObCSVGeneralParser::FieldValue> &arr, std::vector<std::string> &out) {
+    for (int64_t i = 0; i < arr.count(); ++i) {
+      out.push_back(arr.at(i).is_null_ ? std::string("<NULL>")
+                                       : std::string(arr.at(i).ptr_, arr.at(i).len_));
+    }
+    return OB_SUCCESS;
+  };
+  auto general_handler = [&](ObIArray<ObCSVGeneralParser::FieldValue> &arr) -> int {
+    return collect(arr, general_fields);
+  };
+  auto simd_handler = [&](ObIArray<ObCSVGeneralParser::FieldValue> &arr) -> int {
+    return collect(arr, simd_fields);
+  };
+  std::vector<char> escape_buf(data.size());
+  ObSEArray<ObCSVGeneralParser::LineErrRec, 16> general_errors;
+  ObSEArray<ObCSVGeneralParser::LineErrRec, 16> simd_errors;
+  const char *ptr = data.data();
+  const char *end = data.data() + data.size();
+  int64_t general_rows = 0;
+  for (int64_t nrows = 1; nrows > 0 && ptr < end; general_rows += nrows) {
+    nrows = 1;
+    ASSERT_EQ(OB_SUCCESS, (general_parser.scan<decltype(general_handler), true>(
+        ptr, end, nrows, escape_buf.data(), escape_buf.data() + escape_buf.size(),
+        general_handler, general_errors, true)));
+  }
+  ptr = data.data();
+  int64_t simd_rows = 0;
+  for (int64_t nrows = 7; nrows > 0 && ptr < end; simd_rows += nrows) {
+    nrows = 7;
+    ASSERT_EQ(OB_SUCCESS, simd_parser.scan_simd(ptr, end, nrows, escape_buf.data(),
+        escape_buf.data() + escape_buf.size(), simd_handler, simd_errors, true));
+  }
+  ASSERT_EQ(general_rows, simd_rows);
+  ASSERT_EQ(general_errors.count(), simd_errors.count());
+  for (int64_t i = 0; i < general_errors.count(); ++i) {
+    ASSERT_EQ(general_errors.at(i).err_code, simd_errors.at(i).err_code);
+  }
+  ASSERT_EQ(general_fields.size(), simd_fields.size());
+  for (size_t i = 0; i < general_fields.size(); ++i) {
+    ASSERT_EQ(general_fields[i], simd_fields[i]);
+  }
+
+  ObSEArray<ObString, 8> pieces;
+  ASSERT_EQ(OB_SUCCESS, simd_parser.split_lines(data.data(), end, 8, pieces));
+  int64_t total_len = 0;
+  for (int64_t i = 0; i < pieces.count(); ++i) {
+    ASSERT_EQ(data.data() + total_len, pieces.at(i).ptr());
+    total_len += pieces.at(i).length();
+    if (i + 1 < pieces.count()) {
+      const char *last = pieces.at(i).ptr() + pieces.at(i).length() - 1;
+      ASSERT_EQ('\n', *last);
+      ASSERT_NE('\\', *(last - 1));
+    }
+  }
+  ASSERT_EQ(static_cast<int64_t>(data.size()), total_len);
+}
+
+TEST_F(TestParser, simd_parser_bench)
+{
+  ObDataInFileStruct file_struct;
+  file_struct.field_term_str_ = "|";
+  FileMeta &f_meta = tpch_file_metas[TPCH_LINE_ITEM];
+
+  std::string file_name;
+  if (file_path != NULL) {
+    file_name.append(file_path).append("/").append(f_meta.file_name);
+  } else {
+    file_name = f_meta.file_name;
+  }
+  ObFileReader reader;
+  ASSERT_EQ(OB_SUCCESS, reader.open(file_name.c_str(), false));
+  const int64_t file_size = get_file_size(file_name.c_str());
+  std::vector<char> data(file_size);
+  std::vector<char> escape_buf(file_size);
+  int64_t read_bytes = 0;
+  ASSERT_EQ(OB_SUCCESS, reader.pread(data.data(), file_size, 0, read_bytes));
+  ASSERT_EQ(file_size, read_bytes);
+
+  auto counting_lines = [](ObIArray<ObCSVGeneralParser::FieldValue> &arr) -> int {
+    UNUSED(arr);
+    return OB_SUCCESS;
+  };
+  const int64_t LOOP = 20;
+  const int64_t BATCH_ROWS = 100;
+  ObSEArray<ObCSVGeneralParser::LineErrRec, 16> errors;
+  for (int64_t k = 0; k < 2; ++k) {
+    const bool use_simd = (1 == k);
+    ObCSVGeneralParser parser;
+    ASSERT_EQ(OB_SUCCESS, parser.init(file_struct, f_meta.column_num, CS_TYPE_UTF8MB4_BIN));
+    int64_t rows = 0;
+    const int64_t start_time = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < LOOP; ++i) {
+      const char *ptr = data.data();
+      const char *end = data.data() + file_size;
+      while (ptr < end) {
+        int64_t nrows = BATCH_ROWS;
+        if (use_simd) {
+          ASSERT_EQ(OB_SUCCESS, parser.scan_simd(ptr, end, nrows, escape_buf.data(),
+              escape_buf.data() + file_size, counting_lines, errors, true));
+        } else {
+          ASSERT_EQ(OB_SUCCESS, (parser.scan<decltype(counting_lines), true>(ptr, end, nrows,
+              escape_buf.data(), escape_buf.data() + file_size, counting_lines, errors, true)));
+        }
+        ASSERT_EQ(0, errors.count());
+        rows += nrows;
+      }
+    }
+    const int64_t time_dur = MAX(1, ObTimeUtility::current_time() - start_time);
+    fprintf(stdout, "## %s parser\trows:%ld\ttime:%ldus\tspeed:%ldM/s\n",
+            use_simd ? "simd" : "general", rows, time_dur,
+            ((file_size * LOOP) >> 20) * USECS_PER_SEC / time_dur);
+  }
+}
+
 int main(int argc, char **argv)
 {
   init_sql_factories();
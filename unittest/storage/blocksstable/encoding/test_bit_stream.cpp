@@ -227,6 +227,39 @@ TEST(ObBitStream, perf)
   std::cout << "second run: " << end_time - start_time << std::endl;
 }
 
+TEST(ObBitStream, batch_unpack)
+{
+  const int64_t NUM_CNT = 1000;
+  uint64_t values[NUM_CNT];
+  uint64_t scalar_values[NUM_CNT];
+  for (int64_t cnt = 1; cnt <= 64; ++cnt) {
+    // leading bits like extend value bits before the packed values
+    const int64_t start_offset = cnt % 7;
+    const int64_t length = (start_offset + NUM_CNT * cnt + 7) / 8;
+    unsigned char *buf = new unsigned char[length + 8];
+    MEMSET(buf, 0, length + 8);
+    const uint64_t mask = 64 == cnt ? UINT64_MAX : (1UL << cnt) - 1;
+    int64_t offset = start_offset;
+    for (int64_t i = 0; i < NUM_CNT; ++i) {
+      ObBitStream::memory_safe_set(buf, offset, cnt, static_cast<uint64_t>(i * 7919) & mask);
+      offset += cnt;
+    }
+    for (int64_t start = 0; start < NUM_CNT; start += 333) {
+      const int64_t unpack_cnt = std::min(NUM_CNT - start, 500L);
+      ObBitStream::batch_unpack(buf, length, start_offset + start * cnt, cnt, unpack_cnt, values);
+      ObBitStream::batch_unpack_scalar(
+          buf, length, start_offset + start * cnt, cnt, unpack_cnt, scalar_values);
+      for (int64_t i = 0; i < unpack_cnt; ++i) {
+        uint64_t v = 0;
+        ObBitStream::get(buf, start_offset + (start + i) * cnt, cnt, v);
+        ASSERT_EQ(v, values[i]) << "cnt: " << cnt << ", row: " << start + i;
+        ASSERT_EQ(v, scalar_values[i]) << "cnt: " << cnt << ", row: " << start + i;
+      }
+    }
+    delete [] buf;
+  }
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
 
@@ -221,6 +221,91 @@ TEST_F(TestDictLargeVarchar, test_dict_large_varchar)
   ASSERT_TRUE(ObDatum::binary_equal(row.storage_datums_[3], read_row.storage_datums_[3]));
 }
 
+static ObObjType test_adaptive_detection_col_types[3] = {ObIntType, ObVarcharType, ObNumberType};
+class TestAdaptiveDetection : public TestIColumnEncoder
+{
+public:
+  static const int64_t MICRO_BLOCK_CNT = 64;
+  static const int64_t ROW_CNT_PER_MICRO_BLOCK = 256;
+  TestAdaptiveDetection()
+  {
+    rowkey_cnt_ = 1;
+    column_cnt_ = 3;
+    col_types_ = reinterpret_cast<ObObjType *>(allocator_.alloc(sizeof(ObObjType) * column_cnt_));
+    for (int64_t i = 0; i < column_cnt_; ++i) {
+      col_types_[i] = test_adaptive_detection_col_types[i];
+    }
+  }
+  virtual ~TestAdaptiveDetection()
+  {
+    allocator_.free(col_types_);
+  }
+  void build_micro_blocks(const bool adaptive_detection, int64_t &total_size, int64_t &cost_us);
+};
+
+void TestAdaptiveDetection::build_micro_blocks(
+    const bool adaptive_detection, int64_t &total_size, int64_t &cost_us)
+{
+  ctx_.adaptive_detection_ = adaptive_detection;
+  ObMicroBlockEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, column_cnt_));
+  ObDatumRow read_row;
+  ASSERT_EQ(OB_SUCCESS, read_row.init(column_cnt_));
+  total_size = 0;
+  cost_us = 0;
+  for (int64_t i = 0; i < MICRO_BLOCK_CNT; ++i) {
+    const int64_t start_us = ObTimeUtility::current_time();
+    encoder.reuse();
+    for (int64_t j = 0; j < ROW_CNT_PER_MICRO_BLOCK; ++j) {
+      // low cardinality data with the same distribution in each micro block
+      ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(j % 16, row));
+      row.storage_datums_[0].set_int(i * ROW_CNT_PER_MICRO_BLOCK + j);
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row));
+    }
+    char *buf = nullptr;
+    int64_t size = 0;
+    ASSERT_EQ(OB_SUCCESS, encoder.build_block(buf, size));
+    cost_us += ObTimeUtility::current_time() - start_us;
+    total_size += size;
+
+    ObMicroBlockData micro_data(buf, size);
+    ObMicroBlockDecoder decoder;
+    ASSERT_EQ(OB_SUCCESS, decoder.init(micro_data, read_info_));
+    const int64_t row_idx = i % ROW_CNT_PER_MICRO_BLOCK;
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(row_idx % 16, row));
+    row.storage_datums_[0].set_int(i * ROW_CNT_PER_MICRO_BLOCK + row_idx);
+    ASSERT_EQ(OB_SUCCESS, decoder.get_row(row_idx, read_row));
+    for (int64_t k = 0; k < column_cnt_; ++k) {
+      ASSERT_TRUE(ObDatum::binary_equal(row.storage_datums_[k], read_row.storage_datums_[k]));
+    }
+  }
+  if (adaptive_detection) {
+    ASSERT_EQ(column_cnt_, encoder.ctx_.encoding_histories_.count());
+    // low cardinality varchar column keeps the same encoding across micro blocks
+    ASSERT_GE(encoder.ctx_.encoding_histories_.at(1).stable_cnt_,
+        ObColumnEncodingHistory::STABLE_MICRO_BLOCK_CNT);
+  }
+}
+
+TEST_F(TestAdaptiveDetection, test_adaptive_detection)
+{
+  int64_t full_size = 0;
+  int64_t full_cost_us = 0;
+  int64_t adaptive_size = 0;
+  int64_t adaptive_cost_us = 0;
+  build_micro_blocks(false, full_size, full_cost_us);
+  build_micro_blocks(true, adaptive_size, adaptive_cost_us);
+  const int64_t row_cnt = MICRO_BLOCK_CNT * ROW_CNT_PER_MICRO_BLOCK;
+  LOG_INFO("encoder detection benchmark", K(row_cnt), K(full_size), K(full_cost_us),
+      K(adaptive_size), K(adaptive_cost_us),
+      "full_rows_per_ms", row_cnt * 1000 / MAX(full_cost_us, 1),
+      "adaptive_rows_per_ms", row_cnt * 1000 / MAX(adaptive_cost_us, 1));
+  // the reused encodings should not make micro blocks notably larger
+  ASSERT_LE(adaptive_size * 100, full_size * 110);
+}
+
 class TestEncodingRowBufHolder : public ::testing::Test
 {
 public:
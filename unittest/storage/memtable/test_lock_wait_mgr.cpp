@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+
+#include "storage/memtable/ob_lock_wait_mgr.h"
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace oceanbase::common;
+using namespace oceanbase::memtable;
+
+// a transaction hash, so that spinning does not look up the waiters of a row
+static const uint64_t TEST_HASH = (1UL << 63) | (1024UL << 1) | 1;
+
+class TestLockWaitMgr : public ::testing::Test
+{
+public:
+  virtual void SetUp() override
+  {
+    mgr_ = new ObLockWaitMgr();
+    // spin_wait_ gives up at once when the thread pool is stopped
+    mgr_->stop_ = false;
+    node_.hash_ = TEST_HASH;
+    node_.lock_seq_ = mgr_->get_seq(TEST_HASH);
+  }
+  virtual void TearDown() override
+  {
+    mgr_->stop_ = true;
+    delete mgr_;
+    mgr_ = NULL;
+  }
+  int64_t &wait_time() { return mgr_->wait_time_[(TEST_HASH >> 1) % ObLockWaitMgr::LOCK_BUCKET_COUNT]; }
+  void release_lock() { ATOMIC_INC(&mgr_->sequence_[(TEST_HASH >> 1) % ObLockWaitMgr::LOCK_BUCKET_COUNT]); }
+protected:
+  ObLockWaitMgr *mgr_;
+  ObLockWaitMgr::Node node_;
+};
+
+TEST_F(TestLockWaitMgr, park_without_history)
+{
+  // no wait history on the bucket, park at once even if the lock is released
+  release_lock();
+  ASSERT_EQ(0, wait_time());
+  ASSERT_FALSE(mgr_->spin_wait_(&node_));
+}
+
+TEST_F(TestLockWaitMgr, park_on_long_wait)
+{
+  wait_time() = ObLockWaitMgr::MAX_SPIN_WAIT_US + 1;
+  release_lock();
+  ASSERT_FALSE(mgr_->spin_wait_(&node_));
+}
+
+TEST_F(TestLockWaitMgr, spin_on_short_wait)
+{
+  wait_time() = 10;
+  release_lock();
+  ASSERT_TRUE(mgr_->spin_wait_(&node_));
+  ASSERT_GT(wait_time(), 0);
+  ASSERT_LE(wait_time(), ObLockWaitMgr::MAX_SPIN_WAIT_US);
+
+}
+
+TEST_F(TestLockWaitMgr, spin_timeout)
+{
+  // the lock is not released, park after spinning at most twice the average wait time
+  wait_time() = 50;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  ASSERT_FALSE(mgr_->spin_wait_(&node_));
+  ASSERT_GE(ObTimeUtility::current_time() - start_ts, 100);
+  ASSERT_EQ(50, wait_time());
+}
+
+TEST_F(TestLockWaitMgr, update_wait_time)
+{
+  mgr_->update_wait_time_(TEST_HASH, 80);
+  ASSERT_EQ(80, wait_time());
+  // moving average with weight 1/8
+  mgr_->update_wait_time_(TEST_HASH, 160);
+  ASSERT_EQ(80 - 10 + 20, wait_time());
+  // zero wait time is counted as 1us, so the bucket keeps a history
+  wait_time() = 0;
+  mgr_->update_wait_time_(TEST_HASH, 0);
+  ASSERT_EQ(1, wait_time());
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_lock_wait_mgr.log*");
+  OB_LOGGER.set_file_name("test_lock_wait_mgr.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
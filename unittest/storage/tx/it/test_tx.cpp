@@ -2310,6 +2310,54 @@ TEST_F(ObTestTx, interrupt_get_read_snapshot)
   ROLLBACK_TX(n1, tx);
 }
 
+TEST_F(ObTestTx, hot_row_early_lock_release)
+{
+  START_ONE_TX_NODE(n1);
+  // only hot row elr is enabled, and keep the config from refreshing
+  ObTxELRUtil &elr_util = n1->txs_.get_tx_elr_util();
+  elr_util.can_tenant_elr_ = false;
+  elr_util.can_tenant_hot_row_elr_ = true;
+  elr_util.last_refresh_ts_ = INT64_MAX;
+  PREPARE_TX(n1, tx);
+  PREPARE_TX_PARAM(tx_param);
+  ObTxReadSnapshot snapshot;
+  ASSERT_EQ(OB_SUCCESS, n1->get_read_snapshot(tx, tx_param.isolation_, n1->ts_after_ms(100), snapshot));
+  CREATE_IMPLICIT_SAVEPOINT(n1, tx, tx_param, sp);
+  ASSERT_EQ(OB_SUCCESS, n1->write(tx, snapshot, 100, 112));
+  // the writer has waited on the row
+  ObPartTransCtx *ctx = NULL;
+  ASSERT_EQ(OB_SUCCESS, n1->get_tx_ctx(n1->ls_id_, tx.tx_id_, ctx));
+  ctx->set_hot_row_writer();
+  // the commit log is submitted but not synced, the locks are released early
+  n1->fake_tx_log_adapter_->set_pause();
+  ASYNC_DO(async_commit, n1->commit_tx(tx, n1->ts_after_ms(5 * 1000)));
+  int64_t wait_cnt = 0;
+  while (!ctx->elr_handler_.is_elr_prepared() && wait_cnt++ < 1000) {
+    usleep(1000);
+  }
+  ASSERT_TRUE(ctx->is_can_elr());
+  ASSERT_TRUE(ctx->elr_handler_.is_elr_prepared());
+  {
+    // a later reader must see the early released commit
+    ObTxDesc *tx2_ptr = NULL;
+    ASSERT_EQ(OB_SUCCESS, n1->acquire_tx(tx2_ptr));
+    ObTxDesc &tx2 = *tx2_ptr;
+    ASSERT_EQ(OB_SUCCESS, elr_util.check_and_update_tx_elr_info(tx2));
+    ASSERT_TRUE(tx2.is_can_elr());
+    ObTxReadSnapshot snapshot2;
+    ASSERT_EQ(OB_SUCCESS, n1->get_read_snapshot(tx2, tx_param.isolation_, n1->ts_after_ms(100), snapshot2));
+    ASSERT_GE(snapshot2.core_.version_, ctx->ctx_tx_data_.get_commit_version());
+    int64_t val = 0;
+    ASSERT_EQ(OB_SUCCESS, n1->read(snapshot2, 100, val));
+    ASSERT_EQ(112, val);
+    ASSERT_EQ(OB_SUCCESS, n1->release_tx(tx2));
+  }
+  ASSERT_EQ(OB_SUCCESS, n1->revert_tx_ctx(ctx));
+  n1->fake_tx_log_adapter_->clear_pause();
+  ASYNC_WAIT(async_commit, 5 * 1000 * 1000, commit_ret);
+  ASSERT_EQ(OB_SUCCESS, commit_ret);
+}
+
 ////
 /// APPEND NEW TEST HERE, USE PRE DEFINED MACRO IN FILE `test_tx.dsl`
 /// SEE EXAMPLE: TEST_F(ObTestTx, rollback_savepoint_timeout)
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "storage/tx/ob_gts_local_cache.h"
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace transaction;
+namespace unittest
+{
+
+class TestObGTSLocalCache : public ::testing::Test
+{
+public :
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_F(TestObGTSLocalCache, try_update_latest_srr)
+{
+  ObGTSLocalCache cache;
+  // the first waiter sends the request
+  EXPECT_TRUE(cache.try_update_latest_srr(MonotonicTs(100), MonotonicTs(110)));
+  EXPECT_EQ(110, cache.get_latest_srr().mts_);
+  // waiters start before the request is sent share its response
+  EXPECT_FALSE(cache.try_update_latest_srr(MonotonicTs(100), MonotonicTs(120)));
+  EXPECT_FALSE(cache.try_update_latest_srr(MonotonicTs(110), MonotonicTs(120)));
+  EXPECT_EQ(110, cache.get_latest_srr().mts_);
+  // waiters start after the request is sent need a new request
+  EXPECT_TRUE(cache.try_update_latest_srr(MonotonicTs(111), MonotonicTs(120)));
+  EXPECT_EQ(120, cache.get_latest_srr().mts_);
+
+  int64_t gts = 0;
+  MonotonicTs receive_gts_ts;
+  bool need_send_rpc = false;
+  bool update = false;
+  EXPECT_EQ(OB_SUCCESS, cache.update_gts(MonotonicTs(120), 1000, MonotonicTs(130), update));
+  EXPECT_EQ(OB_SUCCESS, cache.get_gts(MonotonicTs(115), gts, receive_gts_ts, need_send_rpc));
+  EXPECT_EQ(1000, gts);
+  EXPECT_EQ(OB_EAGAIN, cache.get_gts(MonotonicTs(125), gts, receive_gts_ts, need_send_rpc));
+  EXPECT_TRUE(need_send_rpc);
+}
+
+TEST_F(TestObGTSLocalCache, concurrent_waiters)
+{
+  ObGTSLocalCache cache;
+  const int64_t THREAD_CNT = 16;
+  const int64_t ROUND_CNT = 10000;
+  int64_t rpc_cnt = 0;
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < THREAD_CNT; i++) {
+    threads.push_back(std::thread([&]() {
+      for (int64_t round = 1; round <= ROUND_CNT; round++) {
+        // all waiters of one round start at the same time
+        if (cache.try_update_latest_srr(MonotonicTs(round * 10), MonotonicTs(round * 10 + 1))) {
+          ATOMIC_INC(&rpc_cnt);
+        }
+      }
+    }));
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  // one request for each round no matter how many waiters
+  EXPECT_EQ(ROUND_CNT, rpc_cnt);
+  TRANS_LOG(INFO, "gts rpc count of concurrent waiters", K(THREAD_CNT), K(ROUND_CNT), K(rpc_cnt));
+}
+
+}//end of unittest
+}//end of oceanbase
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_gts_local_cache.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}
@@ -12,6 +12,8 @@
 
 #include "storage/tx/ob_trans_hashmap.h"
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 #include "share/ob_errno.h"
 #include "lib/oblog/ob_log.h"
 #include "storage/tx/ob_trans_define.h"
@@ -209,6 +211,110 @@ TEST_F(TestObTrans, hashmap_init_invalid)
   EXPECT_EQ(0, map.count());
 }
 
+TEST_F(TestObTrans, hashmap_concurrent_get_and_del)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+
+  TestHashMap map;
+  map.init(lib::ObMemAttr(OB_SERVER_TENANT_ID, "TestObTrans"));
+  const int64_t KEY_CNT = 1000;
+  const int64_t READER_CNT = 8;
+  bool stop = false;
+  std::vector<std::thread> readers;
+  for (int64_t i = 0; i < READER_CNT; i++) {
+    readers.push_back(std::thread([&]() {
+      ObTransTestValue *val = NULL;
+      while (!ATOMIC_LOAD(&stop)) {
+        for (int64_t key = 1; key <= KEY_CNT; key++) {
+          if (OB_SUCCESS == map.get(ObTransID(key), val)) {
+            EXPECT_TRUE(val->contain(ObTransID(key)));
+            EXPECT_LT(0, val->get_ref());
+            map.revert(val);
+          }
+        }
+      }
+    }));
+  }
+  // writer keeps inserting and deleting values while readers get them without lock
+  for (int64_t round = 0; round < 20; round++) {
+    ObTransTestValue *v = NULL;
+    for (int64_t key = 1; key <= KEY_CNT; key++) {
+      ObTransTestValue *val = NULL;
+      EXPECT_EQ(OB_SUCCESS, map.alloc_value(val));
+      EXPECT_EQ(OB_SUCCESS, val->init(ObTransID(key)));
+      EXPECT_EQ(OB_SUCCESS, map.insert_and_get(ObTransID(key), val, &v));
+      map.revert(val);
+    }
+    EXPECT_EQ(KEY_CNT, map.count());
+    RemoveFunctor remove_if_fn(&map);
+    map.remove_if(remove_if_fn);
+    EXPECT_EQ(0, map.count());
+  }
+  ATOMIC_STORE(&stop, true);
+  for (auto &t : readers) {
+    t.join();
+  }
+}
+
+TEST_F(TestObTrans, hashmap_del_in_batch)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+
+  TestHashMap map;
+  map.init(lib::ObMemAttr(OB_SERVER_TENANT_ID, "TestObTrans"));
+  const int64_t BATCH_CNT = TestHashMap::DELETED_BATCH_CNT;
+  ObTransTestValue *vals[BATCH_CNT];
+  ObTransTestValue *v = NULL;
+  for (int64_t i = 0; i < BATCH_CNT; i++) {
+    EXPECT_EQ(OB_SUCCESS, map.alloc_value(vals[i]));
+    EXPECT_EQ(OB_SUCCESS, vals[i]->init(ObTransID(i + 1)));
+    // keep the ref of insert_and_get to check the ref held by hashmap
+    EXPECT_EQ(OB_SUCCESS, map.insert_and_get(ObTransID(i + 1), vals[i], &v));
+  }
+  // 1 the ref held by hashmap is released after a batch of values are deleted
+  for (int64_t i = 0; i < BATCH_CNT - 1; i++) {
+    EXPECT_EQ(OB_SUCCESS, map.del(ObTransID(i + 1), vals[i]));
+    EXPECT_EQ(OB_ENTRY_NOT_EXIST, map.get(ObTransID(i + 1), v));
+    EXPECT_EQ(2, vals[i]->get_ref());
+  }
+  EXPECT_EQ(OB_SUCCESS, map.del(ObTransID(BATCH_CNT), vals[BATCH_CNT - 1]));
+  EXPECT_EQ(0, map.count());
+  for (int64_t i = 0; i < BATCH_CNT; i++) {
+    EXPECT_EQ(1, vals[i]->get_ref());
+  }
+
+  // 2 insert the deleted value again
+  EXPECT_EQ(OB_SUCCESS, map.insert_and_get(ObTransID(1), vals[0], &v));
+  map.revert(vals[0]);
+  EXPECT_EQ(OB_SUCCESS, map.del(ObTransID(1), vals[0]));
+  EXPECT_EQ(2, vals[0]->get_ref());
+  // the ref held by hashmap before is released first
+  EXPECT_EQ(OB_SUCCESS, map.insert_and_get(ObTransID(1), vals[0], &v));
+  EXPECT_EQ(3, vals[0]->get_ref());
+  map.revert(vals[0]);
+  EXPECT_EQ(OB_SUCCESS, map.get(ObTransID(1), v));
+  EXPECT_EQ(vals[0], v);
+  map.revert(v);
+  EXPECT_EQ(1, map.count());
+
+  // 3 reclaim the values deleted
+  EXPECT_EQ(OB_SUCCESS, map.del(ObTransID(1), vals[0]));
+  EXPECT_EQ(2, vals[0]->get_ref());
+  map.reclaim_deleted();
+  EXPECT_EQ(1, vals[0]->get_ref());
+
+  // 4 reset reclaims the values deleted
+  EXPECT_EQ(OB_SUCCESS, map.insert_and_get(ObTransID(1), vals[0], &v));
+  map.revert(vals[0]);
+  EXPECT_EQ(OB_SUCCESS, map.del(ObTransID(1), vals[0]));
+  EXPECT_EQ(2, vals[0]->get_ref());
+  map.reset();
+  EXPECT_EQ(1, vals[0]->get_ref());
+  for (int64_t i = 0; i < BATCH_CNT; i++) {
+    map.revert(vals[i]);
+  }
+}
+
 }//end of unittest
 }//end of oceanbase
 
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define protected public
+#define private public
+
+#include <thread>
+#include <vector>
+#include "storage/tx_table/ob_tx_data_lookup_cache.h"
+
+namespace oceanbase
+{
+using namespace ::testing;
+using namespace transaction;
+using namespace storage;
+using namespace share;
+
+namespace unittest
+{
+
+class TestTxDataLookupCache : public ::testing::Test
+{
+public:
+  TestTxDataLookupCache() : cache_() {}
+  virtual void SetUp() override {}
+  virtual void TearDown() override { cache_.destroy(); }
+
+  static void make_tx_data(const int64_t tx_id, const int32_t state, ObTxData &tx_data)
+  {
+    tx_data.reset();
+    tx_data.tx_id_ = tx_id;
+    tx_data.state_ = state;
+    tx_data.start_scn_.convert_for_tx(tx_id);
+    tx_data.commit_version_.convert_for_tx(tx_id * 10);
+    tx_data.end_scn_ = tx_data.commit_version_;
+  }
+  // find another tx id which is mapped to the same slot of tx_id
+  int64_t get_collided_tx_id(const int64_t tx_id)
+  {
+    int64_t other = tx_id + 1;
+    while ((ObTransID(other).hash() & cache_.slot_mask_) != (ObTransID(tx_id).hash() & cache_.slot_mask_)) {
+      other++;
+    }
+    return other;
+  }
+
+protected:
+  ObTxDataLookupCache cache_;
+};
+
+TEST_F(TestTxDataLookupCache, hit_and_miss)
+{
+  ObTxData tx_data;
+  ObTxCommitData commit_data;
+
+  ASSERT_FALSE(cache_.get(ObTransID(1), commit_data));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.init(OB_SERVER_TENANT_ID, 100));
+  ASSERT_EQ(OB_SUCCESS, cache_.init(OB_SERVER_TENANT_ID));
+  ASSERT_EQ(OB_INIT_TWICE, cache_.init(OB_SERVER_TENANT_ID));
+  // slots are allocated by the first put
+  ASSERT_EQ(nullptr, cache_.slots_);
+  ASSERT_FALSE(cache_.get(ObTransID(1), commit_data));
+
+  make_tx_data(1, ObTxData::COMMIT, tx_data);
+  cache_.put(tx_data);
+  ASSERT_NE(nullptr, cache_.slots_);
+  make_tx_data(2, ObTxData::ABORT, tx_data);
+  cache_.put(tx_data);
+  // undecided tx data is not cached
+  make_tx_data(3, ObTxData::RUNNING, tx_data);
+  cache_.put(tx_data);
+
+  ASSERT_TRUE(cache_.get(ObTransID(1), commit_data));
+  ASSERT_EQ(ObTransID(1), commit_data.tx_id_);
+  ASSERT_EQ((int32_t)ObTxData::COMMIT, commit_data.state_);
+  ASSERT_EQ(10, commit_data.commit_version_.get_val_for_tx());
+  ASSERT_TRUE(cache_.get(ObTransID(2), commit_data));
+  ASSERT_EQ((int32_t)ObTxData::ABORT, commit_data.state_);
+  ASSERT_FALSE(cache_.get(ObTransID(3), commit_data));
+  ASSERT_FALSE(cache_.get(ObTransID(4), commit_data));
+
+  cache_.clear();
+  ASSERT_FALSE(cache_.get(ObTransID(1), commit_data));
+  ASSERT_FALSE(cache_.get(ObTransID(2), commit_data));
+}
+
+TEST_F(TestTxDataLookupCache, overwrite_on_collision)
+{
+  ObTxData tx_data;
+  ObTxCommitData commit_data;
+  ASSERT_EQ(OB_SUCCESS, cache_.init(OB_SERVER_TENANT_ID, 4));
+  const int64_t tx_id = 1;
+  const int64_t collided_tx_id = get_collided_tx_id(tx_id);
+
+  make_tx_data(tx_id, ObTxData::COMMIT, tx_data);
+  cache_.put(tx_data);
+  ASSERT_TRUE(cache_.get(ObTransID(tx_id), commit_data));
+  make_tx_data(collided_tx_id, ObTxData::COMMIT, tx_data);
+  cache_.put(tx_data);
+  ASSERT_FALSE(cache_.get(ObTransID(tx_id), commit_data));
+  ASSERT_TRUE(cache_.get(ObTransID(collided_tx_id), commit_data));
+  ASSERT_EQ(collided_tx_id * 10, commit_data.commit_version_.get_val_for_tx());
+}
+
+TEST_F(TestTxDataLookupCache, miss_is_not_cached)
+{
+  ObTxData tx_data;
+  ObTxCommitData commit_data;
+  ASSERT_EQ(OB_SUCCESS, cache_.init(OB_SERVER_TENANT_ID, 4));
+
+  // a tx not found in tx data sstables may be flushed into them later, it must not be a hit
+  ASSERT_FALSE(cache_.get(ObTransID(1), commit_data));
+  make_tx_data(1, ObTxData::RUNNING, tx_data);
+  cache_.put(tx_data);
+  ASSERT_FALSE(cache_.get(ObTransID(1), commit_data));
+  // found after the tx data memtable is flushed
+  make_tx_data(1, ObTxData::COMMIT, tx_data);
+  cache_.put(tx_data);
+  ASSERT_TRUE(cache_.get(ObTransID(1), commit_data));
+  ASSERT_EQ((int32_t)ObTxData::COMMIT, commit_data.state_);
+}
+
+TEST_F(TestTxDataLookupCache, concurrent_read_write)
+{
+  static const int64_t WRITER_CNT = 4;
+  static const int64_t READER_CNT = 4;
+  static const int64_t TX_CNT = 1024;
+  static const int64_t LOOP_CNT = 100000;
+  // few slots to make writers and readers meet on the same slots
+  ASSERT_EQ(OB_SUCCESS, cache_.init(OB_SERVER_TENANT_ID, 16));
+
+  std::vector<std::thread> threads;
+  int64_t hit_cnt = 0;
+  int64_t wrong_cnt = 0;
+  for (int64_t i = 0; i < WRITER_CNT; i++) {
+    threads.push_back(std::thread([&, i]() {
+      ObTxData tx_data;
+      for (int64_t j = 0; j < LOOP_CNT; j++) {
+        const int64_t tx_id = (i + j * WRITER_CNT) % TX_CNT + 1;
+        make_tx_data(tx_id, 0 == tx_id % 3 ? ObTxData::ABORT : ObTxData::COMMIT, tx_data);
+        cache_.put(tx_data);
+      }
+    }));
+  }
+  for (int64_t i = 0; i < READER_CNT; i++) {
+    threads.push_back(std::thread([&, i]() {
+      ObTxCommitData commit_data;
+      for (int64_t j = 0; j < LOOP_CNT; j++) {
+        const int64_t tx_id = (i + j * READER_CNT) % TX_CNT + 1;
+        if (cache_.get(ObTransID(tx_id), commit_data)) {
+          ATOMIC_INC(&hit_cnt);
+          // a hit never returns a torn slot
+          if (ObTransID(tx_id) != commit_data.tx_id_
+              || (0 == tx_id % 3 ? ObTxData::ABORT : ObTxData::COMMIT) != commit_data.state_
+              || commit_data.commit_version_.get_val_for_tx() != tx_id * 10
+              || commit_data.start_scn_.get_val_for_tx() != tx_id) {
+            ATOMIC_INC(&wrong_cnt);
+          }
+        }
+      }
+    }));
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  STORAGE_LOG(INFO, "concurrent read write finish", K(hit_cnt), K(wrong_cnt));
+  ASSERT_EQ(0, wrong_cnt);
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_tx_data_lookup_cache.log*");
+  OB_LOGGER.set_file_name("test_tx_data_lookup_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}